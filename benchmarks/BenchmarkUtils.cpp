@@ -0,0 +1,42 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkUtils.h"
+
+namespace LiveKitCpp
+{
+
+void addResolutions(benchmark::internal::Benchmark* benchmark)
+{
+    if (benchmark) {
+        benchmark->ArgNames({"width", "height"});
+        benchmark->Args({640, 360});
+        benchmark->Args({1280, 720});
+        benchmark->Args({1920, 1080});
+        benchmark->Args({3840, 2160});
+        benchmark->Unit(benchmark::kMicrosecond);
+    }
+}
+
+void setFrameCounters(benchmark::State& state, size_t bytesPerFrame)
+{
+    const auto frames = state.iterations();
+    state.SetItemsProcessed(frames);
+    state.SetBytesProcessed(frames * static_cast<int64_t>(bytesPerFrame));
+    // rate with inversion gives elapsed time per given value: seconds / (frames * 1e-9)
+    state.counters["ns_per_frame"] = benchmark::Counter(static_cast<double>(frames) * 1e-9,
+                                                        benchmark::Counter::kIsRate |
+                                                        benchmark::Counter::kInvert);
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,29 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // BenchmarkUtils.h
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace LiveKitCpp
+{
+
+// 360p, 720p, 1080p & 4K, arguments are [width, height]
+void addResolutions(benchmark::internal::Benchmark* benchmark);
+inline int benchmarkWidth(const benchmark::State& state) { return static_cast<int>(state.range(0)); }
+inline int benchmarkHeight(const benchmark::State& state) { return static_cast<int>(state.range(1)); }
+// one iteration is one frame: reports [bytes_per_second] (MB/s in console output)
+// for given amount of processed bytes per frame & [ns_per_frame]
+void setFrameCounters(benchmark::State& state, size_t bytesPerFrame);
+
+} // namespace LiveKitCpp
@@ -0,0 +1,222 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkVideoFrame.h"
+#include "RgbGenericVideoFrameBuffer.h"
+#include <cstdio> // required by jpeglib.h
+#include <cstdlib>
+#include <cstring>
+#include <jpeglib.h>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+struct PlaneLayout
+{
+    int _columns = 0; // in samples
+    int _rows = 0;
+    int _sampleSize = 1; // in bytes
+};
+
+std::vector<PlaneLayout> planesLayout(VideoFrameType type, int width, int height);
+// smooth gradient with a bit of noise, close to natural content
+uint8_t pattern(int x, int y, int plane);
+std::vector<std::byte> encodeJpeg(int width, int height, int quality);
+
+}
+
+namespace LiveKitCpp
+{
+
+BenchmarkVideoFrame::BenchmarkVideoFrame(VideoFrameType type, int width, int height,
+                                         std::vector<Plane> planes)
+    : VideoFrame(type, 0)
+    , _width(width)
+    , _height(height)
+    , _planes(std::move(planes))
+{
+}
+
+std::shared_ptr<BenchmarkVideoFrame> BenchmarkVideoFrame::create(VideoFrameType type,
+                                                                 int width, int height)
+{
+    if (width > 0 && height > 0) {
+        const auto layout = planesLayout(type, width, height);
+        if (!layout.empty()) {
+            std::vector<Plane> planes(layout.size());
+            for (size_t i = 0U; i < layout.size(); ++i) {
+                const auto& l = layout[i];
+                auto& plane = planes[i];
+                plane._stride = l._columns;
+                plane._data.resize(size_t(l._columns) * l._rows * l._sampleSize);
+                for (int y = 0; y < l._rows; ++y) {
+                    for (int x = 0; x < l._columns; ++x) {
+                        const auto value = pattern(x, y, int(i));
+                        const auto offset = (size_t(y) * l._columns + x) * l._sampleSize;
+                        if (2 == l._sampleSize) {
+                            // 10 bits in low bits of 16-bit sample
+                            const uint16_t sample = uint16_t(value) << 2U;
+                            std::memcpy(&plane._data[offset], &sample, sizeof(sample));
+                        }
+                        else {
+                            std::memset(&plane._data[offset], value, l._sampleSize);
+                        }
+                    }
+                }
+            }
+            if (isRGB(type)) {
+                // stride of packed formats is in bytes
+                planes.front()._stride *= layout.front()._sampleSize;
+            }
+            return std::shared_ptr<BenchmarkVideoFrame>(new BenchmarkVideoFrame(type, width, height,
+                                                                                std::move(planes)));
+        }
+    }
+    return {};
+}
+
+std::shared_ptr<BenchmarkVideoFrame> BenchmarkVideoFrame::createMJpeg(int width, int height, int quality)
+{
+    if (width > 0 && height > 0) {
+        auto jpeg = encodeJpeg(width, height, quality);
+        if (!jpeg.empty()) {
+            std::vector<Plane> planes(1U);
+            planes.front()._data = std::move(jpeg);
+            return std::shared_ptr<BenchmarkVideoFrame>(new BenchmarkVideoFrame(VideoFrameType::MJPEG,
+                                                                                width, height,
+                                                                                std::move(planes)));
+        }
+    }
+    return {};
+}
+
+size_t BenchmarkVideoFrame::totalSize() const
+{
+    size_t size = 0U;
+    for (const auto& plane : _planes) {
+        size += plane._data.size();
+    }
+    return size;
+}
+
+int BenchmarkVideoFrame::stride(size_t planeIndex) const
+{
+    if (planeIndex < _planes.size()) {
+        return _planes[planeIndex]._stride;
+    }
+    return 0;
+}
+
+const std::byte* BenchmarkVideoFrame::data(size_t planeIndex) const
+{
+    if (planeIndex < _planes.size()) {
+        return _planes[planeIndex]._data.data();
+    }
+    return nullptr;
+}
+
+int BenchmarkVideoFrame::dataSize(size_t planeIndex) const
+{
+    if (planeIndex < _planes.size()) {
+        return static_cast<int>(_planes[planeIndex]._data.size());
+    }
+    return 0;
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+std::vector<PlaneLayout> planesLayout(VideoFrameType type, int width, int height)
+{
+    const int halfWidth = (width + 1) / 2, halfHeight = (height + 1) / 2;
+    switch (type) {
+        case VideoFrameType::RGB24:
+        case VideoFrameType::BGR24:
+        case VideoFrameType::BGRA32:
+        case VideoFrameType::ARGB32:
+        case VideoFrameType::RGBA32:
+        case VideoFrameType::ABGR32:
+            return {{width, height, RgbGenericVideoFrameBuffer::bytesPerPixel(type)}};
+        case VideoFrameType::NV12:
+            // interleaved UV, see NV12VideoFrameBuffer::strideUV
+            return {{width, height}, {width + width % 2, halfHeight}};
+        case VideoFrameType::I420:
+            return {{width, height}, {halfWidth, halfHeight}, {halfWidth, halfHeight}};
+        case VideoFrameType::I422:
+            return {{width, height}, {halfWidth, height}, {halfWidth, height}};
+        case VideoFrameType::I444:
+            return {{width, height}, {width, height}, {width, height}};
+        case VideoFrameType::I010:
+            return {{width, height, 2}, {halfWidth, halfHeight, 2}, {halfWidth, halfHeight, 2}};
+        case VideoFrameType::I210:
+            return {{width, height, 2}, {halfWidth, height, 2}, {halfWidth, height, 2}};
+        case VideoFrameType::I410:
+            return {{width, height, 2}, {width, height, 2}, {width, height, 2}};
+        default:
+            break;
+    }
+    return {};
+}
+
+uint8_t pattern(int x, int y, int plane)
+{
+    // cheap deterministic noise, doesn't depend on RNG implementation
+    const auto noise = (uint32_t(x) * 2654435761U) ^ (uint32_t(y) * 40503U);
+    return static_cast<uint8_t>((x + y + plane * 64) / 4 + (noise >> 29U));
+}
+
+std::vector<std::byte> encodeJpeg(int width, int height, int quality)
+{
+    std::vector<std::byte> jpeg;
+    jpeg_compress_struct cinfo = {};
+    jpeg_error_mgr jerr = {};
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    unsigned char* output = nullptr;
+    unsigned long outputSize = 0UL;
+    jpeg_mem_dest(&cinfo, &output, &outputSize);
+    cinfo.image_width = static_cast<JDIMENSION>(width);
+    cinfo.image_height = static_cast<JDIMENSION>(height);
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo); // YCbCr 4:2:0, like most of MJPEG cameras
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    jpeg_start_compress(&cinfo, TRUE);
+    std::vector<JSAMPLE> row(size_t(width) * 3U);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        const int y = static_cast<int>(cinfo.next_scanline);
+        for (int x = 0; x < width; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                row[size_t(x) * 3U + c] = pattern(x, y, c);
+            }
+        }
+        JSAMPROW rowPointer = row.data();
+        jpeg_write_scanlines(&cinfo, &rowPointer, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    if (output) {
+        if (outputSize) {
+            const auto bytes = reinterpret_cast<const std::byte*>(output);
+            jpeg.assign(bytes, bytes + outputSize);
+        }
+        std::free(output);
+    }
+    return jpeg;
+}
+
+}
@@ -0,0 +1,54 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // BenchmarkVideoFrame.h
+#include "livekit/rtc/media/VideoFrame.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// frame with synthetic content in client memory, emulates frames
+// pushed by external sources (cameras, decoders, pixel buffers, etc.)
+class BenchmarkVideoFrame : public VideoFrame
+{
+    struct Plane
+    {
+        std::vector<std::byte> _data;
+        int _stride = 0; // in samples, like in WebRTC buffers
+    };
+public:
+    // all types of VideoFrameImpl::create except MJPEG & RGB565 are supported
+    static std::shared_ptr<BenchmarkVideoFrame> create(VideoFrameType type, int width, int height);
+    // baseline JPEG with 4:2:0 subsampling
+    static std::shared_ptr<BenchmarkVideoFrame> createMJpeg(int width, int height, int quality = 90);
+    // total size of all planes, in bytes
+    size_t totalSize() const;
+    // impl. of VideoFrame
+    size_t planesCount() const final { return _planes.size(); }
+    int width() const final { return _width; }
+    int height() const final { return _height; }
+    int stride(size_t planeIndex) const final;
+    const std::byte* data(size_t planeIndex) const final;
+    int dataSize(size_t planeIndex) const final;
+private:
+    BenchmarkVideoFrame(VideoFrameType type, int width, int height, std::vector<Plane> planes);
+private:
+    const int _width;
+    const int _height;
+    const std::vector<Plane> _planes;
+};
+
+} // namespace LiveKitCpp
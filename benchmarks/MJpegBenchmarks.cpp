@@ -0,0 +1,71 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkUtils.h"
+#include "BenchmarkVideoFrame.h"
+#include "NV12VideoFrameBuffer.h"
+#include "VideoFrameBufferPoolSource.h"
+#include "VideoFrameImpl.h"
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+// decoding of MJPEG frames from cameras, [toNV12] adds the conversion
+// required for platform encoders
+void decodeMJpeg(benchmark::State& state, bool toNV12);
+
+}
+
+BENCHMARK_CAPTURE(decodeMJpeg, I420, false)->Apply(addResolutions);
+BENCHMARK_CAPTURE(decodeMJpeg, NV12, true)->Apply(addResolutions);
+
+namespace
+{
+
+void decodeMJpeg(benchmark::State& state, bool toNV12)
+{
+    const auto width = benchmarkWidth(state), height = benchmarkHeight(state);
+    const auto source = BenchmarkVideoFrame::createMJpeg(width, height);
+    if (!source) {
+        state.SkipWithError("failed to encode JPEG image");
+        return;
+    }
+    const auto poolSource = VideoFrameBufferPoolSource::create();
+    const VideoFrameBufferPool pool(poolSource);
+    for (auto _ : state) {
+        const auto frame = VideoFrameImpl::create(source, pool);
+        if (!frame) {
+            state.SkipWithError("failed to wrap MJPEG frame");
+            break;
+        }
+        webrtc::scoped_refptr<webrtc::VideoFrameBuffer> decoded;
+        if (toNV12) {
+            decoded = NV12VideoFrameBuffer::toNV12(frame->video_frame_buffer(), pool);
+        }
+        else {
+            decoded = frame->video_frame_buffer()->ToI420();
+        }
+        if (!decoded) {
+            state.SkipWithError("MJPEG decoding failed");
+            break;
+        }
+        benchmark::DoNotOptimize(decoded.get());
+    }
+    // compressed size, throughput of the decoder input
+    state.counters["jpeg_bytes"] = static_cast<double>(source->totalSize());
+    setFrameCounters(state, source->totalSize());
+}
+
+}
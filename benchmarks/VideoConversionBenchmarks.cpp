@@ -0,0 +1,120 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkUtils.h"
+#include "BenchmarkVideoFrame.h"
+#include "NV12VideoFrameBuffer.h"
+#include "VideoFrameBufferPoolSource.h"
+#include "VideoFrameImpl.h"
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+// external frame -> I420, the path of frames pushed by clients to encoders & renderers
+void convertToI420(benchmark::State& state, VideoFrameType type);
+// external frame -> NV12, the path of frames for platform (hardware) encoders
+void convertToNV12(benchmark::State& state, VideoFrameType type);
+// source frames for both paths, both frames & pool are created outside of measurement
+std::shared_ptr<BenchmarkVideoFrame> createSource(benchmark::State& state, VideoFrameType type);
+
+}
+
+// all external frame types accepted by VideoFrameImpl::create, MJPEG is measured by MJpegBenchmarks,
+// RGB565, UYVY, YUY2, YV12 & IYUV frames can't be pushed by clients
+BENCHMARK_CAPTURE(convertToI420, RGB24, VideoFrameType::RGB24)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, BGR24, VideoFrameType::BGR24)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, BGRA32, VideoFrameType::BGRA32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, ARGB32, VideoFrameType::ARGB32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, RGBA32, VideoFrameType::RGBA32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, ABGR32, VideoFrameType::ABGR32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, NV12, VideoFrameType::NV12)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, I422, VideoFrameType::I422)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, I444, VideoFrameType::I444)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, I010, VideoFrameType::I010)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, I210, VideoFrameType::I210)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToI420, I410, VideoFrameType::I410)->Apply(addResolutions);
+
+BENCHMARK_CAPTURE(convertToNV12, RGB24, VideoFrameType::RGB24)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, BGR24, VideoFrameType::BGR24)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, BGRA32, VideoFrameType::BGRA32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, ARGB32, VideoFrameType::ARGB32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, RGBA32, VideoFrameType::RGBA32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, ABGR32, VideoFrameType::ABGR32)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, I420, VideoFrameType::I420)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, I422, VideoFrameType::I422)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, I444, VideoFrameType::I444)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, I010, VideoFrameType::I010)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, I210, VideoFrameType::I210)->Apply(addResolutions);
+BENCHMARK_CAPTURE(convertToNV12, I410, VideoFrameType::I410)->Apply(addResolutions);
+
+namespace
+{
+
+void convertToI420(benchmark::State& state, VideoFrameType type)
+{
+    const auto source = createSource(state, type);
+    if (!source) {
+        return;
+    }
+    // warm pool, measure of conversion without allocations
+    const auto poolSource = VideoFrameBufferPoolSource::create();
+    const VideoFrameBufferPool pool(poolSource);
+    for (auto _ : state) {
+        // ToI420() result is cached by buffer, so the new wrapper for each frame
+        webrtc::scoped_refptr<webrtc::I420BufferInterface> i420;
+        if (const auto frame = VideoFrameImpl::create(source, pool)) {
+            i420 = frame->video_frame_buffer()->ToI420();
+        }
+        if (!i420) {
+            state.SkipWithError("conversion to I420 failed");
+            break;
+        }
+        benchmark::DoNotOptimize(i420->DataY());
+    }
+    setFrameCounters(state, source->totalSize());
+}
+
+void convertToNV12(benchmark::State& state, VideoFrameType type)
+{
+    const auto source = createSource(state, type);
+    if (!source) {
+        return;
+    }
+    const auto poolSource = VideoFrameBufferPoolSource::create();
+    const VideoFrameBufferPool pool(poolSource);
+    for (auto _ : state) {
+        webrtc::scoped_refptr<webrtc::NV12BufferInterface> nv12;
+        if (const auto frame = VideoFrameImpl::create(source, pool)) {
+            nv12 = NV12VideoFrameBuffer::toNV12(frame->video_frame_buffer(), pool);
+        }
+        if (!nv12) {
+            state.SkipWithError("conversion to NV12 failed");
+            break;
+        }
+        benchmark::DoNotOptimize(nv12->DataY());
+    }
+    setFrameCounters(state, source->totalSize());
+}
+
+std::shared_ptr<BenchmarkVideoFrame> createSource(benchmark::State& state, VideoFrameType type)
+{
+    auto source = BenchmarkVideoFrame::create(type, benchmarkWidth(state), benchmarkHeight(state));
+    if (!source) {
+        state.SkipWithError("failed to create source frame");
+    }
+    return source;
+}
+
+}
@@ -0,0 +1,72 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkUtils.h"
+#include "VideoFrameBufferPoolSource.h"
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+// request of I420 buffer when free buffer of the same size class is in the pool
+void poolHit(benchmark::State& state);
+// request of I420 buffer when pool can't retain buffers (memory limit is zero),
+// each request leads to allocation & release of buffer
+void poolMiss(benchmark::State& state);
+// size of I420 buffer, in bytes
+size_t i420Size(int width, int height);
+
+}
+
+BENCHMARK(poolHit)->Apply(addResolutions)->Unit(benchmark::kNanosecond);
+BENCHMARK(poolMiss)->Apply(addResolutions)->Unit(benchmark::kNanosecond);
+
+namespace
+{
+
+void poolHit(benchmark::State& state)
+{
+    const auto width = benchmarkWidth(state), height = benchmarkHeight(state);
+    const auto pool = VideoFrameBufferPoolSource::create();
+    // warm up, buffer is returned to the pool after release of the last reference
+    pool->createI420(width, height);
+    for (auto _ : state) {
+        auto buffer = pool->createI420(width, height);
+        benchmark::DoNotOptimize(buffer.get());
+    }
+    const auto stats = pool->stats();
+    state.counters["misses"] = static_cast<double>(stats._misses);
+    setFrameCounters(state, i420Size(width, height));
+}
+
+void poolMiss(benchmark::State& state)
+{
+    const auto width = benchmarkWidth(state), height = benchmarkHeight(state);
+    const auto pool = VideoFrameBufferPoolSource::create(1U, 0U);
+    for (auto _ : state) {
+        auto buffer = pool->createI420(width, height);
+        benchmark::DoNotOptimize(buffer.get());
+    }
+    const auto stats = pool->stats();
+    state.counters["hits"] = static_cast<double>(stats._hits);
+    setFrameCounters(state, i420Size(width, height));
+}
+
+size_t i420Size(int width, int height)
+{
+    const size_t chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+    return size_t(width) * height + 2U * chromaWidth * chromaHeight;
+}
+
+}
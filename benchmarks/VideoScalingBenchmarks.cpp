@@ -0,0 +1,138 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BenchmarkUtils.h"
+#include "BenchmarkVideoFrame.h"
+#include "NV12VideoFrameBuffer.h"
+#include "RgbGenericVideoFrameBuffer.h"
+#include "VideoFrameBufferPoolSource.h"
+#include "VideoFrameImpl.h"
+#include "VideoUtils.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+// CropAndScale of external buffers, the path of simulcast layers & sinks adaptation
+void cropAndScale(benchmark::State& state, VideoFrameType type, bool crop);
+// scale kernels (cpuScale* via scaleNV12 / scaleRGB*) without buffers management
+void scaleNV12Kernel(benchmark::State& state, VideoContentHint hint);
+void scaleRGBKernel(benchmark::State& state, VideoFrameType type, VideoContentHint hint);
+// half of each dimension, like 'h' simulcast layer
+inline int scaled(int size) { return std::max(2, size / 2); }
+
+}
+
+BENCHMARK_CAPTURE(cropAndScale, NV12, VideoFrameType::NV12, false)->Apply(addResolutions);
+BENCHMARK_CAPTURE(cropAndScale, NV12_crop, VideoFrameType::NV12, true)->Apply(addResolutions);
+BENCHMARK_CAPTURE(cropAndScale, I420, VideoFrameType::I420, false)->Apply(addResolutions);
+BENCHMARK_CAPTURE(cropAndScale, I420_crop, VideoFrameType::I420, true)->Apply(addResolutions);
+BENCHMARK_CAPTURE(cropAndScale, RGB24, VideoFrameType::RGB24, false)->Apply(addResolutions);
+BENCHMARK_CAPTURE(cropAndScale, BGRA32, VideoFrameType::BGRA32, false)->Apply(addResolutions);
+BENCHMARK_CAPTURE(cropAndScale, BGRA32_crop, VideoFrameType::BGRA32, true)->Apply(addResolutions);
+
+BENCHMARK_CAPTURE(scaleNV12Kernel, none, VideoContentHint::None)->Apply(addResolutions);
+BENCHMARK_CAPTURE(scaleNV12Kernel, motion, VideoContentHint::Motion)->Apply(addResolutions);
+BENCHMARK_CAPTURE(scaleNV12Kernel, text, VideoContentHint::Text)->Apply(addResolutions);
+BENCHMARK_CAPTURE(scaleRGBKernel, RGB24, VideoFrameType::RGB24, VideoContentHint::None)->Apply(addResolutions);
+BENCHMARK_CAPTURE(scaleRGBKernel, BGRA32, VideoFrameType::BGRA32, VideoContentHint::None)->Apply(addResolutions);
+BENCHMARK_CAPTURE(scaleRGBKernel, BGRA32_text, VideoFrameType::BGRA32, VideoContentHint::Text)->Apply(addResolutions);
+
+namespace
+{
+
+void cropAndScale(benchmark::State& state, VideoFrameType type, bool crop)
+{
+    const auto width = benchmarkWidth(state), height = benchmarkHeight(state);
+    const auto source = BenchmarkVideoFrame::create(type, width, height);
+    if (!source) {
+        state.SkipWithError("failed to create source frame");
+        return;
+    }
+    const auto poolSource = VideoFrameBufferPoolSource::create();
+    const VideoFrameBufferPool pool(poolSource);
+    const auto frame = VideoFrameImpl::create(source, pool);
+    if (!frame) {
+        state.SkipWithError("failed to wrap source frame");
+        return;
+    }
+    const auto buffer = frame->video_frame_buffer();
+    // 16:9 -> 4:3 center crop
+    const int cropWidth = crop ? (height * 4 / 3) & ~1 : width;
+    const int offsetX = (width - cropWidth) / 2;
+    for (auto _ : state) {
+        auto result = buffer->CropAndScale(offsetX, 0, cropWidth, height,
+                                           scaled(cropWidth), scaled(height));
+        if (!result) {
+            state.SkipWithError("crop & scale failed");
+            break;
+        }
+        benchmark::DoNotOptimize(result.get());
+    }
+    setFrameCounters(state, source->totalSize());
+}
+
+void scaleNV12Kernel(benchmark::State& state, VideoContentHint hint)
+{
+    const auto width = benchmarkWidth(state), height = benchmarkHeight(state);
+    const auto source = BenchmarkVideoFrame::create(VideoFrameType::NV12, width, height);
+    if (!source) {
+        state.SkipWithError("failed to create source frame");
+        return;
+    }
+    const auto dstWidth = scaled(width), dstHeight = scaled(height);
+    const auto dstStrideY = NV12VideoFrameBuffer::strideY(dstWidth);
+    const auto dstStrideUV = NV12VideoFrameBuffer::strideUV(dstWidth);
+    std::vector<uint8_t> dst(size_t(dstStrideY) * dstHeight + size_t(dstStrideUV) * ((dstHeight + 1) / 2));
+    const auto dstUV = dst.data() + size_t(dstStrideY) * dstHeight;
+    for (auto _ : state) {
+        const auto ok = scaleNV12(reinterpret_cast<const uint8_t*>(source->data(0U)), source->stride(0U),
+                                  reinterpret_cast<const uint8_t*>(source->data(1U)), source->stride(1U),
+                                  width, height,
+                                  dst.data(), dstStrideY, dstUV, dstStrideUV,
+                                  dstWidth, dstHeight, hint);
+        if (!ok) {
+            state.SkipWithError("NV12 scale failed");
+            break;
+        }
+        benchmark::ClobberMemory();
+    }
+    setFrameCounters(state, source->totalSize());
+}
+
+void scaleRGBKernel(benchmark::State& state, VideoFrameType type, VideoContentHint hint)
+{
+    const auto width = benchmarkWidth(state), height = benchmarkHeight(state);
+    const auto source = BenchmarkVideoFrame::create(type, width, height);
+    if (!source) {
+        state.SkipWithError("failed to create source frame");
+        return;
+    }
+    const auto dstWidth = scaled(width), dstHeight = scaled(height);
+    const auto dstStride = dstWidth * RgbGenericVideoFrameBuffer::bytesPerPixel(type);
+    std::vector<std::byte> dst(size_t(dstStride) * dstHeight);
+    for (auto _ : state) {
+        if (!scaleRGB(type, source->data(0U), source->stride(0U), width, height,
+                      dst.data(), dstStride, dstWidth, dstHeight, hint)) {
+            state.SkipWithError("RGB scale failed");
+            break;
+        }
+        benchmark::ClobberMemory();
+    }
+    setFrameCounters(state, source->totalSize());
+}
+
+}
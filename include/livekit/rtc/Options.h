@@ -15,6 +15,7 @@
 #include "livekit/signaling/sfu/ClientInfo.h"
 #include "livekit/signaling/sfu/ICEServer.h"
 #include "livekit/signaling/sfu/ICETransportPolicy.h"
+#include "livekit/rtc/media/VideoSimulcastLayer.h"
 #include <chrono>
 #include <optional>
 #include <memory>
@@ -37,10 +38,23 @@ struct Options
     /// Defaults to true.
     bool _autoSubscribe = true;
     
+    /// Resolution & pausing of subscribed video tracks are driven by
+    /// size and visibility of their sinks (see ``VideoSink``).
     bool _adaptiveStream = true; // maybe std::optional<>?
     
+    /// Delay for collecting of sink changes before sending of track settings to the server.
+    std::chrono::milliseconds _adaptiveStreamDebounce = 100ms;
+    
     std::string _publish;
     
+    /// Publish camera tracks as simulcast (several encodings of different resolution),
+    /// the SFU forwards to each subscriber the layer fitting its bandwidth & view size.
+    /// Screen sharing tracks are always published with a single encoding.
+    bool _simulcast = false;
+    
+    /// Simulcast encodings of camera tracks, up to 3 layers with unique qualities.
+    std::vector<VideoSimulcastLayer> _simulcastLayers = defaultVideoSimulcastLayers();
+    
     std::optional<ClientInfo> _clientsInfo;
     
     std::string _prefferedAudioEncoder;
@@ -74,8 +88,23 @@ struct Options
     /// The number of attempts to reconnect when the network disconnects.
     int _reconnectAttempts = 3;
     
-    /// The delay between reconnect attempts.
+    /// The delay before the first reconnect attempt.
     std::chrono::milliseconds _reconnectAttemptDelay = 2s;
+    
+    /// Multiplier applied to the delay after each failed reconnect attempt,
+    /// 1 means constant delay between attempts.
+    double _reconnectBackoffFactor = 2.;
+    
+    /// Upper limit of the delay between reconnect attempts.
+    std::chrono::milliseconds _reconnectMaxAttemptDelay = 30s;
+    
+    /// Random spread of each reconnect delay, as a fraction of the delay ([0..1]),
+    /// avoids simultaneous reconnection of many clients after a server restart.
+    double _reconnectJitter = 0.2;
+    
+    /// Time limit for all reconnect attempts since the connection loss,
+    /// 0 (zero) means no limit.
+    std::chrono::milliseconds _reconnectMaxTotalTime = 60s;
 
     /// The timeout interval for the initial websocket connection.
     /*std::chrono::milliseconds _socketConnectTimeoutInterval = 10s;
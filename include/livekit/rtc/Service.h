@@ -22,6 +22,8 @@
 #include "livekit/rtc/media/AudioRecordingOptions.h"
 #include "livekit/rtc/media/MediaAuthorizationLevel.h"
 #include "livekit/rtc/media/MediaDeviceInfo.h"
+#include "livekit/rtc/media/PushAudioSource.h"
+#include "livekit/rtc/media/PushVideoSource.h"
 #include <memory>
 #include <vector>
 #include <stdio.h>
@@ -51,6 +53,17 @@ public:
     std::unique_ptr<LocalVideoDevice> createCamera(MediaDeviceInfo info = {}, VideoOptions options = {}) const;
     std::unique_ptr<LocalVideoDevice> createSharing(bool previewMode,
                                                     MediaDeviceInfo info = {}, VideoOptions options = {}) const;
+    // source of application-generated frames and its device (only one per source),
+    // [options] define expected resolution & max FPS of pushed frames
+    std::shared_ptr<PushVideoSource> createPushVideoSource(bool screencast = false) const;
+    std::unique_ptr<LocalVideoDevice> createPushVideoDevice(const std::shared_ptr<PushVideoSource>& source,
+                                                            MediaDeviceInfo info = {},
+                                                            VideoOptions options = {}) const;
+    // source of application-generated PCM and its device (only one per source),
+    // platform ADM is not involved, [options] enable APM processing of pushed samples
+    // (echo cancellation is ignored, there is no playout reference)
+    std::shared_ptr<PushAudioSource> createPushAudioSource(const AudioRecordingOptions& options = {}) const;
+    std::unique_ptr<AudioDevice> createPushAudioDevice(const std::shared_ptr<PushAudioSource>& source) const;
     // global media
     MediaDeviceInfo defaultAudioRecordingDevice() const;
     MediaDeviceInfo defaultAudioPlayoutDevice() const;
@@ -90,6 +103,10 @@ public:
     void enableAudioPlayoutProcessing(bool enable);
     bool audioRecordingProcessingEnabled() const;
     bool audioPlayoutProcessingEnabled() const;
+    // voice activity probability [0...1] of the last processed microphone frame,
+    // available only if RNNoise suppressor is enabled at init (ServiceInitInfo::_enableRNNoiseSuppressor)
+    // and noise suppression is enabled, zero otherwise
+    float audioRecordingVoiceProbability() const;
     // AEC
     // Starts AEC dump using existing file. Takes ownership of `file` and passes
     // it on to VoiceEngine (via other objects) immediately, which will take
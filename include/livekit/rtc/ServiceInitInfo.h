@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once // ServiceInitInfo.h
+#include "livekit/rtc/media/VirtualAudioOptions.h"
 #include <optional>
 #include <memory>
 
@@ -32,6 +33,8 @@ struct ServiceInitInfo
     std::optional<bool> _disableAudioRed;
     // https://jmvalin.ca/demo/rnnoise/
     bool _enableRNNoiseSuppressor = true;
+    // virtual audio device instead of the platform ADM, for hosts without sound hardware
+    std::optional<VirtualAudioOptions> _virtualAudio;
 };
 
 } // namespace LiveKitCpp
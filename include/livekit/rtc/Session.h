@@ -23,6 +23,7 @@
 #include "livekit/rtc/stats/StatsSource.h"
 #include "livekit/signaling/sfu/EncryptionType.h"
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -74,6 +75,7 @@ public:
     // given participant by index or server ID
     std::shared_ptr<RemoteParticipant> remoteParticipant(size_t index) const;
     std::shared_ptr<RemoteParticipant> remoteParticipant(const std::string& sid) const;
+    std::shared_ptr<RemoteParticipant> remoteParticipantByIdentity(const std::string& identity) const;
     // e2e
     void setAesCgmKeyProvider(std::unique_ptr<KeyProvider> provider = {});
     void setAesCgmKeyProvider(KeyProviderOptions options);
@@ -110,6 +112,31 @@ public:
                          bool deleted = false,
                          bool generated = false,
                          const std::vector<std::string>& destinationIdentities = {});
+    /**
+      * Outgoing data streams, always sent via the reliable data channel.
+      * Open functions return ID of the new stream or empty string if failed,
+      * the stream should be closed by [closeStream] after the last write.
+      * [totalLength] is known size of the stream data (optional).
+      */
+    std::string openTextStream(std::string topic,
+                               const std::vector<std::string>& destinationIdentities = {},
+                               const std::optional<uint64_t>& totalLength = {});
+    // [name] is file name, [mimeType] is 'application/octet-stream' if empty
+    std::string openByteStream(std::string topic, std::string name,
+                               std::string mimeType = {},
+                               const std::vector<std::string>& destinationIdentities = {},
+                               const std::optional<uint64_t>& totalLength = {});
+    // data is splitted into chunks and queued, chunks are passed to the data channel
+    // as soon as its buffered amount allows, so other reliable messages are not blocked;
+    // returns false without writing of anything if too much data is queued already (16 Mb),
+    // retry later, or if the stream was aborted because of send failure (close it then)
+    bool writeStream(const std::string& streamId, std::string data);
+    // empty [reason] means the expected end of stream,
+    // returns false if the stream was aborted because of send failure
+    bool closeStream(const std::string& streamId, std::string reason = {});
+    // amount of bytes written to data streams but not passed to the data channel yet,
+    // can be used for back-pressure of writers
+    uint64_t streamsBufferedAmount() const;
     // connect & state
     SessionState state() const;
     bool connect(std::string host, std::string authToken);
@@ -125,6 +152,7 @@ public:
     void addStatsListener(StatsListener* listener) final;
     void removeStatsListener(StatsListener* listener) final;
     void queryStats() const final;
+    bool queryStats(const std::shared_ptr<StatsListener>& listener) const final;
 private:
     Session(std::unique_ptr<Websocket::EndPoint> socket,
             PeerConnectionFactory* pcf, Options options,
@@ -17,6 +17,7 @@
 #include "livekit/rtc/SessionState.h"
 #include "livekit/signaling/sfu/ChatMessage.h"
 #include "livekit/signaling/sfu/UserPacket.h"
+#include <chrono>
 #include <string>
 
 namespace LiveKitCpp
@@ -31,6 +32,12 @@ public:
     virtual void onRefreshToken(std::string /*authToken*/) {}
     virtual void onStateChanged(SessionState /*state*/) {}
     virtual void onError(LiveKitError /*error*/, const std::string& /*what*/ = {}) {}
+    // reconnection after the server-initiated leave, [attempt] is 1-based
+    virtual void onReconnectScheduled(uint32_t /*attempt*/, uint32_t /*maxAttempts*/,
+                                      std::chrono::milliseconds /*delay*/) {}
+    virtual void onReconnectAttempt(uint32_t /*attempt*/, bool /*started*/) {}
+    // number of attempts or total time limit has been exceeded
+    virtual void onReconnectFailed() {}
     virtual void onLocalParticipantJoined() {}
     virtual void onLocalParticipantLeaved() {}
     virtual void onLocalAudioTrackAdded(const std::shared_ptr<LocalAudioTrack>& /*track*/) {}
@@ -37,6 +37,12 @@ public:
     std::shared_ptr<E2EKeyHandler> clone() const;
     virtual std::vector<uint8_t> ratchetKey(const std::optional<uint8_t>& keyIndex = {});
     virtual std::shared_ptr<KeySet> keySet(const std::optional<uint8_t>& keyIndex = {}) const;
+    // key set after [step] ratchets (starting from 1) of the current key in [keyIndex] slot,
+    // the ratchet window is derived ahead on background queue after each key change,
+    // null if [step] is out of window or is not derived yet
+    std::shared_ptr<KeySet> ratchetedKeySet(uint8_t keyIndex, size_t step) const;
+    // makes ratcheted key set current, the rest of the derived window is kept
+    bool commitRatchet(uint8_t keyIndex, size_t step);
     virtual void setKey(std::vector<uint8_t> password,
                         const std::optional<uint8_t>& keyIndex = {});
     void setKey(std::string_view password, const std::optional<uint8_t>& keyIndex = {});
@@ -55,9 +61,10 @@ public:
                             const std::optional<uint8_t>& keyIndex = {});
     bool decryptionFailure();
 private:
-    E2EKeyHandler(std::unique_ptr<Impl> impl);
+    E2EKeyHandler(std::shared_ptr<Impl> impl);
 private:
-    const std::unique_ptr<Impl> _impl;
+    // shared with background derivation tasks
+    const std::shared_ptr<Impl> _impl;
 };
 
 } // namespace LiveKitCpp
@@ -0,0 +1,30 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AudioFramesFileOptions.h
+#include <cstdint>
+
+namespace LiveKitCpp
+{
+
+struct AudioFramesFileOptions
+{
+    // capacity of the queue between audio thread and file I/O thread, in milliseconds,
+    // frames are dropped if the disk can't keep up
+    uint32_t _bufferMs = 2000U;
+    // continue recording into the next file (name_1.ext, name_2.ext, ...)
+    // after this number of seconds, 0 - no rotation
+    uint32_t _rotationSec = 0U;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,35 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AudioFramesReader.h
+#include <cstddef>
+#include <cstdint>
+
+namespace LiveKitCpp
+{
+
+// provider of recorded samples for the virtual audio device
+class AudioFramesReader
+{
+public:
+    virtual void onStarted() {}
+    virtual void onStopped() {}
+    // fill [numberOfFrames] x [numberOfChannels] interleaved Int16 samples (10 ms),
+    // returns false if no data available, silence is recorded in this case
+    virtual bool read(int16_t* audioData, int sampleRate,
+                      size_t numberOfChannels, size_t numberOfFrames) = 0;
+protected:
+    virtual ~AudioFramesReader() = default;
+};
+
+} // namespace LiveKitCpp
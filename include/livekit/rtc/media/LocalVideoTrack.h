@@ -18,6 +18,7 @@
 #include "livekit/rtc/media/MediaDeviceInfo.h"
 #include "livekit/rtc/media/DegradationPreference.h"
 #include "livekit/rtc/media/VideoScalabilityMode.h"
+#include "livekit/rtc/media/VideoSenderUpdate.h"
 #include <optional>
 
 namespace LiveKitCpp
@@ -52,6 +53,10 @@ public:
     virtual void setMaxFramerate(const std::optional<int>& fps) = 0;
     virtual VideoScalabilityMode scalabilityMode() const = 0;
     virtual void setScalabilityMode(VideoScalabilityMode mode) = 0;
+    // Applies all changes of [update] by a single set of sender parameters,
+    // returns false if nothing changed. Failure is reported once through
+    // the same listener as for the single setters above.
+    virtual bool updateSender(const VideoSenderUpdate& update) = 0;
 };
 
 } // namespace LiveKitCpp
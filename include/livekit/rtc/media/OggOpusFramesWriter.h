@@ -0,0 +1,49 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // OggOpusFramesWriter.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include "livekit/rtc/media/AudioFramesFileOptions.h"
+#include "livekit/rtc/media/AudioFramesWriter.h"
+#include <memory>
+#include <string>
+
+namespace LiveKitCpp
+{
+
+// compressed recording into Ogg/Opus file (up to 2 channels, 48 kHz),
+// encoding and disk I/O are performed on own thread
+class LIVEKIT_RTC_API OggOpusFramesWriter : public AudioFramesWriter
+{
+    struct Impl;
+public:
+    OggOpusFramesWriter(std::string filename, int bitrate = 64000,
+                        AudioFramesFileOptions options = {});
+    OggOpusFramesWriter(const OggOpusFramesWriter&) = delete;
+    OggOpusFramesWriter(OggOpusFramesWriter&&) noexcept = delete;
+    ~OggOpusFramesWriter() final;
+    OggOpusFramesWriter& operator = (const OggOpusFramesWriter&) = delete;
+    OggOpusFramesWriter& operator = (OggOpusFramesWriter&&) noexcept = delete;
+    // number of frames dropped because of full queue
+    uint64_t overruns() const;
+    // impl. of AudioFramesWriter
+    void onStopped() final;
+    void onData(const int16_t* audioData, int bitsPerSample,
+                int sampleRate, size_t numberOfChannels,
+                size_t numberOfFrames,
+                const std::optional<int64_t>& absoluteCaptureTimestampMs) final;
+private:
+    const std::unique_ptr<Impl> _impl;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,43 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // PushAudioSource.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace LiveKitCpp
+{
+
+// source of PCM samples produced by application itself (TTS engines, bots, decoded files),
+// works without platform audio device, created by Service::createPushAudioSource,
+// published through the audio device returned by Service::createPushAudioDevice
+class LIVEKIT_RTC_API PushAudioSource
+{
+public:
+    virtual ~PushAudioSource() = default;
+    // Thread-safe, [data] contains interleaved samples: [frames] x [channels],
+    // any sample rate multiple of 10 Hz or 25 Hz (11025, 22050 Hz, etc.) & any number of channels are accepted,
+    // more than 2 channels are downmixed to stereo (standard layouts up to 7.1, otherwise first 2 channels are published).
+    // Samples are resampled & re-chunked into 10 ms frames internally, the tail less than one block
+    // (10 ms for rates multiple of 100 Hz, up to 100 ms otherwise) is kept until the next call.
+    // Returns false if samples were dropped: device is not published or muted,
+    // or format is not supported.
+    virtual bool pushFrames(const int16_t* data, int sampleRate,
+                            size_t channels, size_t frames) = 0;
+    // float samples are expected in range [-1, 1]
+    virtual bool pushFrames(const float* data, int sampleRate,
+                            size_t channels, size_t frames) = 0;
+};
+
+} // namespace LiveKitCpp
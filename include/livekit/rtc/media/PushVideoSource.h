@@ -0,0 +1,40 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // PushVideoSource.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include <memory>
+
+namespace LiveKitCpp
+{
+
+class VideoFrame;
+
+// source of frames produced by application itself (decoded files, rendered scenes, test patterns),
+// created by Service::createPushVideoSource, published through the local video device
+// returned by Service::createPushVideoDevice
+class LIVEKIT_RTC_API PushVideoSource
+{
+public:
+    virtual ~PushVideoSource() = default;
+    // Thread-safe, frame of any supported type is wrapped without copying if possible,
+    // conversion buffers are taken from the internal pool. Timestamps are made strictly
+    // increasing, frames above of max FPS from device options are skipped.
+    // Frame is referenced (not copied) until encoder and other sinks release it.
+    // Returns false if frame was dropped: device is not published or muted,
+    // frame rate is exceeded, another call of [pushFrame] is in progress or
+    // too many previously pushed frames are still queued for encoding (producer is faster than encoder).
+    virtual bool pushFrame(const std::shared_ptr<VideoFrame>& frame) = 0;
+};
+
+} // namespace LiveKitCpp
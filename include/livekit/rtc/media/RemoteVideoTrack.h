@@ -29,6 +29,10 @@ public:
     virtual uint32_t originalHeight() const = 0;
     virtual std::vector<VideoLayer> layers() const = 0;
     virtual std::vector<SimulcastCodecInfo> codecs() const = 0;
+    // adaptive stream: call it after changes of view size or visibility of attached sinks,
+    // see VideoSink::viewWidth(), VideoSink::viewHeight() & VideoSink::viewVisible(),
+    // adding or removing of sinks is tracked automatically
+    virtual void updateSinksView() = 0;
 };
 
 } // namespace LiveKitCpp
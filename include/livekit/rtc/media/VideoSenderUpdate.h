@@ -0,0 +1,33 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // VideoSenderUpdate.h
+#include "livekit/rtc/media/DegradationPreference.h"
+#include "livekit/rtc/media/VideoScalabilityMode.h"
+#include <optional>
+
+namespace LiveKitCpp
+{
+
+// batch of video sender changes, applied by one reconfiguration of encoder:
+// unset fields are kept as is, negative bitrate or framerate resets the limit
+struct VideoSenderUpdate
+{
+    std::optional<DegradationPreference> _degradationPreference;
+    std::optional<int> _maxBitrateBps;
+    std::optional<int> _minBitrateBps;
+    std::optional<int> _maxFramerate;
+    std::optional<VideoScalabilityMode> _scalabilityMode;
+};
+
+} // namespace LiveKitCpp
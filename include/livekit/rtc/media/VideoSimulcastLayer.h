@@ -0,0 +1,40 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // VideoSimulcastLayer.h
+#include "livekit/signaling/sfu/VideoQuality.h"
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// encoding of simulcast stream for local camera tracks,
+// RID of layer is defined by quality: 'q' - low, 'h' - medium, 'f' - high
+struct VideoSimulcastLayer
+{
+    VideoQuality _quality = VideoQuality::High;
+    // downscaling factor relative to the captured resolution, 1 - original size
+    double _scaleResolutionDownBy = 1.;
+    // 0 - defined by encoder
+    int _maxBitrateBps = 0;
+    int _maxFramerate = 0;
+};
+
+// 1/4, 1/2 & full resolution of camera (180p, 360p, 720p for HD capture)
+inline std::vector<VideoSimulcastLayer> defaultVideoSimulcastLayers() {
+    return {{VideoQuality::Low, 4., 160'000, 15},
+            {VideoQuality::Medium, 2., 450'000, 20},
+            {VideoQuality::High, 1., 1'700'000, 30}};
+}
+
+} // namespace LiveKitCpp
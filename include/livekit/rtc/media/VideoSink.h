@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once // VideoSink.h
+#include <cstdint>
 #include <memory>
 
 namespace LiveKitCpp
@@ -23,6 +24,12 @@ class VideoSink
 {
 public:
     virtual void onFrame(const std::shared_ptr<VideoFrame>& frame) = 0;
+    // hints for adaptive stream of remote video tracks,
+    // size of view in pixels, zero means unknown (full resolution is requested)
+    virtual uint32_t viewWidth() const { return 0U; }
+    virtual uint32_t viewHeight() const { return 0U; }
+    // remote video track is paused by SFU if none of its sinks are visible
+    virtual bool viewVisible() const { return true; }
 protected:
     virtual ~VideoSink() = default;
 };
@@ -0,0 +1,47 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // VirtualAudioOptions.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace LiveKitCpp
+{
+
+class AudioFramesReader;
+class AudioFramesWriter;
+
+// audio device without sound hardware, replaces the platform ADM (headless servers, load tests),
+// recording & playout are paced by own thread with 10 ms period
+struct VirtualAudioOptions
+{
+    // recording source, in order of priority: WAV file, reader, silence
+    std::string _recordingFilename;
+    // restart WAV file from the beginning when it ends, otherwise silence is recorded
+    bool _loopRecording = true;
+    std::shared_ptr<AudioFramesReader> _recordingReader;
+    // playout target, in order of priority: WAV file, writer, nothing (samples are discarded)
+    std::string _playoutFilename;
+    std::shared_ptr<AudioFramesWriter> _playoutWriter;
+    // format of reader & playout, format of WAV file is used for file recording
+    int _sampleRate = 48000;
+    size_t _recordingChannels = 1U;
+    size_t _playoutChannels = 2U;
+    // 1 - real time, N - N times faster than real time, 0 - as fast as possible (tests)
+    uint32_t _speed = 1U;
+    LIVEKIT_RTC_API VirtualAudioOptions();
+};
+
+} // namespace LiveKitCpp
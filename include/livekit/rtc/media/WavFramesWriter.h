@@ -13,22 +13,27 @@
 // limitations under the License.
 #pragma once // WavFramesWriter.h
 #include "livekit/rtc/LiveKitRtcExport.h"
+#include "livekit/rtc/media/AudioFramesFileOptions.h"
 #include "livekit/rtc/media/AudioFramesWriter.h"
 #include <memory>
+#include <string>
 
 namespace LiveKitCpp
 {
 
+// disk I/O is performed on own thread, the header is finalized when recording is stopped
 class LIVEKIT_RTC_API WavFramesWriter : public AudioFramesWriter
 {
     struct Impl;
 public:
-    WavFramesWriter(std::string filename);
+    WavFramesWriter(std::string filename, AudioFramesFileOptions options = {});
     WavFramesWriter(const WavFramesWriter&) = delete;
     WavFramesWriter(WavFramesWriter&&) noexcept = delete;
     ~WavFramesWriter() final;
     WavFramesWriter& operator = (const WavFramesWriter&) = delete;
     WavFramesWriter& operator = (WavFramesWriter&&) noexcept = delete;
+    // number of frames dropped because of full queue
+    uint64_t overruns() const;
     // impl. of AudioFramesWriter
     void onStopped() final;
     void onData(const int16_t* audioData, int bitsPerSample,
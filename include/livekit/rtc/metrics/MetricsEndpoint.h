@@ -0,0 +1,55 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // MetricsEndpoint.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace LiveKitCpp
+{
+
+struct MetricsEndpointOptions
+{
+    // IPv4 address, loopback by default
+    std::string _address = "127.0.0.1";
+    // 0 - any free port, see MetricsEndpoint::port()
+    uint16_t _port = 0U;
+    std::string _path = "/metrics";
+};
+
+// minimal HTTP listener serving MetricsRegistry::exposition() on GET [_path],
+// requests are handled sequentially on own thread
+class LIVEKIT_RTC_API MetricsEndpoint
+{
+    class Impl;
+public:
+    MetricsEndpoint(MetricsEndpointOptions options = {});
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint(MetricsEndpoint&&) noexcept = delete;
+    ~MetricsEndpoint();
+    MetricsEndpoint& operator = (const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator = (MetricsEndpoint&&) noexcept = delete;
+    // also enables MetricsRegistry, false if address or port is not available
+    bool start();
+    // restores the state of MetricsRegistry which it had before start
+    void stop();
+    bool started() const;
+    // actual listening port, 0 if not started
+    uint16_t port() const;
+private:
+    const std::unique_ptr<Impl> _impl;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,40 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // MetricsRegistry.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include <string>
+
+namespace LiveKitCpp
+{
+
+class StatsCollector;
+
+// process-wide registry of SDK health metrics: video frames pools, E2EE timings,
+// data channels, reconnections and RTP streams of attached stats collectors;
+// counters & histograms are updated only while registry is enabled (disabled by default),
+// gauges are tracked always
+class LIVEKIT_RTC_API MetricsRegistry
+{
+public:
+    static void setEnabled(bool enabled);
+    static bool enabled();
+    // RTP streams & candidate pairs gauges are read from [collector] on each scrape,
+    // [session] is used as label value, collector must be removed before destruction
+    static void addStatsCollector(const StatsCollector* collector, std::string session = {});
+    static void removeStatsCollector(const StatsCollector* collector);
+    // OpenMetrics text exposition, terminated by '# EOF'
+    static std::string exposition();
+};
+
+} // namespace LiveKitCpp
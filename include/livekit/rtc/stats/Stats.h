@@ -29,6 +29,7 @@
 #include "livekit/rtc/stats/StatsTransportExt.h"
 #include "livekit/rtc/stats/StatsVideoSourceExt.h"
 #include "livekit/rtc/stats/StatsType.h"
+#include "livekit/rtc/stats/StatsView.h"
 #include <chrono>
 #include <memory>
 #include <string>
@@ -62,6 +63,11 @@ public:
     // Returns all attributes of this stats object, i.e. a list of its individual
     // metrics as viewed via the Attribute wrapper.
     std::vector<StatsAttribute> attributes() const;
+    // allocation-free access to attributes, valid while this object is alive
+    StatsView view() const;
+    // null if attribute is missing, has no value or has another type
+    template <typename T>
+    const T* get(const StatsKey<T>& key) const { return view().get(key); }
     // specific data, see also StatsType description
     // StatsType::Codec
     std::shared_ptr<const StatsCodecExt> extCodec() const;
@@ -25,6 +25,7 @@ namespace LiveKitCpp
 class LIVEKIT_RTC_API StatsAttribute
 {
     friend class Stats;
+    friend class StatsView;
 public:
     using Value = std::variant<const std::optional<bool>*,
                                const std::optional<int32_t>*,
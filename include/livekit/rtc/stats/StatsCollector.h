@@ -0,0 +1,68 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsCollector.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include "livekit/rtc/stats/StatsSample.h"
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+class StatsDeltaListener;
+class StatsSource;
+
+struct StatsCollectorOptions
+{
+    uint64_t _intervalMs = 1000ULL;
+    // number of samples kept per stats object
+    size_t _historySize = 30U;
+};
+
+// polls [StatsSource] (session or track) on own interval and keeps bounded history of
+// RTP streams & candidate pairs counters, rates and deltas are computed on each poll,
+// reports of polls are not delivered to other listeners of the source
+// (if the source supports per-query delivery, see [StatsSource::queryStats]),
+// all collectors of the process share one polling thread
+class LIVEKIT_RTC_API StatsCollector
+{
+    class Impl;
+public:
+    // [source] must outlive the collector
+    StatsCollector(StatsSource* source, StatsCollectorOptions options = {});
+    StatsCollector(const StatsCollector&) = delete;
+    StatsCollector(StatsCollector&&) noexcept = delete;
+    ~StatsCollector();
+    StatsCollector& operator = (const StatsCollector&) = delete;
+    StatsCollector& operator = (StatsCollector&&) noexcept = delete;
+    void start();
+    void stop();
+    bool started() const;
+    void addListener(StatsDeltaListener* listener);
+    void removeListener(StatsDeltaListener* listener);
+    // latest deltas of stats changed since the previous call
+    std::vector<StatsDelta> takeChanges();
+    std::optional<StatsDelta> lastDelta(const std::string& statsId) const;
+    // latest deltas of all tracked stats, changes are not consumed
+    std::vector<StatsDelta> lastDeltas() const;
+    // oldest sample first
+    std::vector<StatsSample> history(const std::string& statsId) const;
+private:
+    // queries in progress refer to it weakly
+    const std::shared_ptr<Impl> _impl;
+};
+
+} // namespace LiveKitCpp
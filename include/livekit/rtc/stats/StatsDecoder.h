@@ -0,0 +1,47 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsDecoder.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include "livekit/rtc/stats/StatsReport.h"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// decodes reports produced by [StatsEncoder], see its description, not thread-safe
+class LIVEKIT_RTC_API StatsDecoder
+{
+    class Impl;
+public:
+    StatsDecoder();
+    StatsDecoder(const StatsDecoder&) = delete;
+    StatsDecoder(StatsDecoder&&) noexcept = delete;
+    ~StatsDecoder();
+    StatsDecoder& operator = (const StatsDecoder&) = delete;
+    StatsDecoder& operator = (StatsDecoder&&) noexcept = delete;
+    // std::nullopt if data is malformed or the previous report was missed,
+    // in that case decoding resumes from the next self-contained report;
+    // attributes unknown for this version of library are skipped
+    std::optional<StatsReport> decode(const uint8_t* data, size_t size);
+    std::optional<StatsReport> decode(const std::vector<uint8_t>& data);
+    // forget interned strings, wait for the next self-contained report
+    void reset();
+private:
+    const std::unique_ptr<Impl> _impl;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,57 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsEncoder.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+class StatsReport;
+
+struct StatsEncoderOptions
+{
+    // dictionary of interned strings (ids, attribute names & string values)
+    // is dropped when reaches this size, 0 - unlimited
+    size_t _maxDictionarySize = 4096U;
+    // each N-th report is self-contained, i.e. can be decoded without previous ones,
+    // 0 - only the first report and reports after dictionary overflow or reset()
+    size_t _resetInterval = 0U;
+};
+
+// compact binary encoding of stats reports, counterpart of [StatsDecoder],
+// strings are interned across successive reports, so reports must be decoded
+// in the same order by single decoder, not thread-safe
+class LIVEKIT_RTC_API StatsEncoder
+{
+    class Impl;
+public:
+    StatsEncoder(StatsEncoderOptions options = {});
+    StatsEncoder(const StatsEncoder&) = delete;
+    StatsEncoder(StatsEncoder&&) noexcept = delete;
+    ~StatsEncoder();
+    StatsEncoder& operator = (const StatsEncoder&) = delete;
+    StatsEncoder& operator = (StatsEncoder&&) noexcept = delete;
+    // appends encoded report to [output], false if report is empty
+    bool encode(const StatsReport& report, std::vector<uint8_t>& output);
+    std::vector<uint8_t> encode(const StatsReport& report);
+    // next report will be self-contained, call it when the receiving side has lost the stream
+    void reset();
+private:
+    const std::unique_ptr<Impl> _impl;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,76 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsKey.h
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// compile-time key of stats attribute, [T] must match the type of attribute,
+// see https://w3c.github.io/webrtc-stats for names
+template <typename T>
+struct StatsKey
+{
+    using Type = T;
+    std::string_view _name;
+};
+
+// frequently used counters
+namespace StatsKeys
+{
+// RTP streams
+inline constexpr StatsKey<uint32_t> ssrc{"ssrc"};
+inline constexpr StatsKey<std::string> kind{"kind"};
+inline constexpr StatsKey<std::string> codecId{"codecId"};
+inline constexpr StatsKey<uint64_t> bytesReceived{"bytesReceived"};
+inline constexpr StatsKey<uint32_t> packetsReceived{"packetsReceived"};
+inline constexpr StatsKey<int32_t> packetsLost{"packetsLost"};
+inline constexpr StatsKey<double> jitter{"jitter"};
+inline constexpr StatsKey<uint32_t> framesReceived{"framesReceived"};
+inline constexpr StatsKey<uint32_t> framesDecoded{"framesDecoded"};
+inline constexpr StatsKey<uint32_t> keyFramesDecoded{"keyFramesDecoded"};
+inline constexpr StatsKey<uint32_t> framesDropped{"framesDropped"};
+inline constexpr StatsKey<double> totalDecodeTime{"totalDecodeTime"};
+inline constexpr StatsKey<uint32_t> freezeCount{"freezeCount"};
+inline constexpr StatsKey<uint64_t> totalSamplesReceived{"totalSamplesReceived"};
+inline constexpr StatsKey<uint64_t> concealedSamples{"concealedSamples"};
+inline constexpr StatsKey<double> audioLevel{"audioLevel"};
+inline constexpr StatsKey<uint64_t> bytesSent{"bytesSent"};
+inline constexpr StatsKey<uint64_t> packetsSent{"packetsSent"};
+inline constexpr StatsKey<uint64_t> retransmittedPacketsSent{"retransmittedPacketsSent"};
+inline constexpr StatsKey<uint32_t> framesEncoded{"framesEncoded"};
+inline constexpr StatsKey<uint32_t> keyFramesEncoded{"keyFramesEncoded"};
+inline constexpr StatsKey<double> totalEncodeTime{"totalEncodeTime"};
+inline constexpr StatsKey<double> targetBitrate{"targetBitrate"};
+inline constexpr StatsKey<std::string> qualityLimitationReason{"qualityLimitationReason"};
+inline constexpr StatsKey<uint32_t> frameWidth{"frameWidth"};
+inline constexpr StatsKey<uint32_t> frameHeight{"frameHeight"};
+inline constexpr StatsKey<double> framesPerSecond{"framesPerSecond"};
+inline constexpr StatsKey<uint32_t> nackCount{"nackCount"};
+inline constexpr StatsKey<uint32_t> pliCount{"pliCount"};
+inline constexpr StatsKey<uint32_t> firCount{"firCount"};
+inline constexpr StatsKey<uint64_t> qpSum{"qpSum"};
+// remote inbound RTP streams
+inline constexpr StatsKey<double> roundTripTime{"roundTripTime"};
+inline constexpr StatsKey<double> fractionLost{"fractionLost"};
+// candidate pairs
+inline constexpr StatsKey<double> currentRoundTripTime{"currentRoundTripTime"};
+inline constexpr StatsKey<double> availableOutgoingBitrate{"availableOutgoingBitrate"};
+inline constexpr StatsKey<double> availableIncomingBitrate{"availableIncomingBitrate"};
+} // namespace StatsKeys
+
+} // namespace LiveKitCpp
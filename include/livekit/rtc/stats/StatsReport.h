@@ -16,6 +16,7 @@
 #include "livekit/rtc/stats/Stats.h"
 #include <chrono>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace LiveKitCpp
@@ -26,6 +27,9 @@ struct StatsReportData;
 class LIVEKIT_RTC_API StatsReport
 {
     friend class StatsSourceImpl;
+    friend class StatsCollector;
+    friend class StatsDecoder;
+    friend class StatsEncoder;
 public:
     class Iterator
     {
@@ -52,6 +56,13 @@ public:
     size_t size() const;
     Stats get(const std::string& id) const;
     Stats get(size_t index) const;
+    // allocation-free access, views are valid while this report is alive
+    StatsView view(const std::string& id) const;
+    // [visitor] is called with [StatsView] for each stats object of [type],
+    // StatsType::Uknown means all objects
+    template <class TVisitor>
+    void forEach(StatsType type, TVisitor&& visitor) const;
+    size_t count(StatsType type) const;
     // Creates a JSON readable string representation of the report,
     // listing all of its stats objects.
     std::string json() const;
@@ -61,10 +72,20 @@ public:
     Iterator end() const { return Iterator(*this, size()); }
 private:
     StatsReport(StatsReportData* data) noexcept;
+    void forEach(StatsType type, void(*callback)(void*, const StatsView&), void* context) const;
 private:
     std::shared_ptr<StatsReportData> _data;
 };
 
+template <class TVisitor>
+inline void StatsReport::forEach(StatsType type, TVisitor&& visitor) const
+{
+    using Visitor = std::remove_reference_t<TVisitor>;
+    forEach(type, [](void* context, const StatsView& stats) {
+        (*static_cast<Visitor*>(context))(stats);
+    }, const_cast<void*>(static_cast<const void*>(&visitor)));
+}
+
 inline StatsReport::Iterator::Iterator(const StatsReport& report, size_t index)
     : _report(report)
     , _index(index)
@@ -0,0 +1,67 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsSample.h
+#include "livekit/rtc/stats/StatsType.h"
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace LiveKitCpp
+{
+
+// cumulative counters of RTP stream or ICE candidate pair at the moment of poll
+struct StatsSample
+{
+    // Unix time
+    std::chrono::time_point<std::chrono::system_clock> _timestamp;
+    // sent or received, depending on the stats type, both for candidate pairs
+    uint64_t _bytes = 0ULL;
+    uint64_t _packets = 0ULL;
+    int64_t _packetsLost = 0;
+    // decoded for inbound streams, encoded for outbound
+    uint64_t _frames = 0ULL;
+    // seconds
+    std::optional<double> _jitter;
+    std::optional<double> _roundTripTime;
+    // remote-inbound streams only, [0..1]
+    std::optional<double> _fractionLost;
+};
+
+// difference between two consecutive samples of the same stats object
+struct StatsDelta
+{
+    std::string _id;
+    StatsType _type = StatsType::Uknown;
+    // Unix time of the latest sample
+    std::chrono::time_point<std::chrono::system_clock> _timestamp;
+    // seconds between samples
+    double _interval = 0.;
+    uint64_t _bytes = 0ULL;
+    uint64_t _packets = 0ULL;
+    int64_t _packetsLost = 0;
+    uint64_t _frames = 0ULL;
+    // bits per second
+    double _bitrate = 0.;
+    double _fps = 0.;
+    // percents of packets lost during the interval
+    std::optional<double> _packetLoss;
+    // latest values, seconds
+    std::optional<double> _jitter;
+    std::optional<double> _roundTripTime;
+    // slope of jitter over the stored history, seconds per second,
+    // positive value means growing jitter
+    std::optional<double> _jitterTrend;
+};
+
+} // namespace LiveKitCpp
@@ -13,6 +13,7 @@
 // limitations under the License.
 #pragma once // StatsSource.h
 #include "livekit/rtc/stats/StatsListener.h"
+#include <memory>
 
 namespace LiveKitCpp
 {
@@ -23,7 +24,12 @@ public:
     virtual ~StatsSource() = default;
     virtual void addStatsListener(StatsListener* listener) = 0;
     virtual void removeStatsListener(StatsListener* listener) = 0;
+    // report(s) are delivered to listeners added by [addStatsListener]
     virtual void queryStats() const = 0;
+    // report(s) of this query are delivered only to [listener], it's kept alive until delivery;
+    // returns false if the source doesn't support such queries (default),
+    // then [StatsCollector] falls back to [addStatsListener] & [queryStats()]
+    virtual bool queryStats(const std::shared_ptr<StatsListener>& /*listener*/) const { return false; }
 };
 
 } // namespace LiveKitCpp
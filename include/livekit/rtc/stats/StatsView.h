@@ -0,0 +1,81 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsView.h
+#include "livekit/rtc/LiveKitRtcExport.h"
+#include "livekit/rtc/stats/StatsAttribute.h"
+#include "livekit/rtc/stats/StatsKey.h"
+#include "livekit/rtc/stats/StatsType.h"
+#include <chrono>
+#include <string>
+
+namespace webrtc {
+class RTCStats;
+}
+
+namespace LiveKitCpp
+{
+
+// non-owning and allocation-free access to stats object,
+// valid while the owning StatsReport (or Stats) is alive
+class LIVEKIT_RTC_API StatsView
+{
+    friend class Stats;
+    friend class StatsReport;
+public:
+    StatsView() = default;
+    bool valid() const noexcept { return nullptr != _stats; }
+    explicit operator bool() const noexcept { return valid(); }
+    const std::string& id() const;
+    // Unix time in milliseconds
+    std::chrono::time_point<std::chrono::system_clock> timestamp() const;
+    StatsType type() const;
+    std::string_view name() const;
+    // attributes are listed in the same order as by Stats::attributes()
+    size_t attributesCount() const;
+    StatsAttribute attribute(size_t index) const;
+    // invalid attribute if not found
+    StatsAttribute attribute(std::string_view name) const;
+    // null if attribute is missing, has no value or has another type
+    template <typename T>
+    const T* get(const StatsKey<T>& key) const;
+    // [visitor] is called with [StatsAttribute] for each attribute, including ones without value
+    template <class TVisitor>
+    void forEachAttribute(TVisitor&& visitor) const;
+private:
+    StatsView(const webrtc::RTCStats* stats) : _stats(stats) {}
+private:
+    const webrtc::RTCStats* _stats = nullptr;
+};
+
+template <typename T>
+inline const T* StatsView::get(const StatsKey<T>& key) const
+{
+    const auto attr = attribute(key._name);
+    if (const auto ptr = std::get_if<const std::optional<T>*>(&attr.variant())) {
+        if (*ptr && (*ptr)->has_value()) {
+            return &(*ptr)->value();
+        }
+    }
+    return nullptr;
+}
+
+template <class TVisitor>
+inline void StatsView::forEachAttribute(TVisitor&& visitor) const
+{
+    for (size_t i = 0U, n = attributesCount(); i < n; ++i) {
+        visitor(attribute(i));
+    }
+}
+
+} // namespace LiveKitCpp
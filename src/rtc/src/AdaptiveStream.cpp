@@ -0,0 +1,98 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AdaptiveStream.h"
+#include "PeerConnectionFactory.h"
+#include "livekit/signaling/SignalClient.h"
+#include <algorithm>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+AdaptiveStream::AdaptiveStream(bool enabled, std::chrono::milliseconds debounceDelay,
+                               PeerConnectionFactory* pcf, const SignalClient* client)
+    : _enabled(enabled && client)
+    , _timerId(reinterpret_cast<uint64_t>(this))
+    , _debounceDelayMs(uint64_t(std::max<int64_t>(0, debounceDelay.count())))
+    , _client(client)
+    , _timer(pcf)
+{
+}
+
+AdaptiveStream::~AdaptiveStream()
+{
+    _timer.cancelSingleShot(_timerId);
+}
+
+void AdaptiveStream::setTrackSettings(UpdateTrackSettings settings)
+{
+    if (_enabled && 1U == settings._trackSids.size()) {
+        bool first = false;
+        {
+            LOCK_WRITE_SAFE_OBJ(_pending);
+            first = _pending->empty();
+            auto sid = settings._trackSids.front();
+            _pending->insert_or_assign(std::move(sid), std::move(settings));
+        }
+        if (first) {
+            // debounce window starts from the first change
+            _timer.singleShot([this]() { flush(); }, _debounceDelayMs, _timerId);
+        }
+    }
+}
+
+void AdaptiveStream::reset()
+{
+    _timer.cancelSingleShot(_timerId);
+    LOCK_WRITE_SAFE_OBJ(_pending);
+    _pending->clear();
+}
+
+void AdaptiveStream::flush()
+{
+    std::unordered_map<std::string, UpdateTrackSettings> pending;
+    {
+        LOCK_WRITE_SAFE_OBJ(_pending);
+        pending = _pending.take();
+    }
+    if (!pending.empty()) {
+        // tracks with identical settings are merged into one request
+        std::vector<UpdateTrackSettings> batches;
+        batches.reserve(pending.size());
+        for (auto it = pending.begin(); it != pending.end(); ++it) {
+            auto batch = std::find_if(batches.begin(), batches.end(),
+                                      [&it](const UpdateTrackSettings& b) {
+                return sameSettings(b, it->second);
+            });
+            if (batch == batches.end()) {
+                batches.push_back(std::move(it->second));
+            }
+            else {
+                batch->_trackSids.push_back(it->first);
+            }
+        }
+        for (auto& batch : batches) {
+            _client->sendTrackSettings(std::move(batch));
+        }
+    }
+}
+
+bool AdaptiveStream::sameSettings(const UpdateTrackSettings& l, const UpdateTrackSettings& r)
+{
+    return l._disabled == r._disabled && l._quality == r._quality &&
+        l._width == r._width && l._height == r._height &&
+        l._fps == r._fps && l._priority == r._priority;
+}
+
+} // namespace LiveKitCpp
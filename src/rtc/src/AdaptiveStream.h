@@ -0,0 +1,56 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AdaptiveStream.h
+#include "MediaTimer.h"
+#include "SafeObj.h"
+#include "livekit/signaling/sfu/UpdateTrackSettings.h"
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+namespace LiveKitCpp
+{
+
+class PeerConnectionFactory;
+class SignalClient;
+
+// client-side adaptive stream: collects settings of subscribed video tracks
+// (driven by size & visibility of their sinks), debounces changes
+// and sends them to SFU by batches of 'UpdateTrackSettings' requests
+class AdaptiveStream
+{
+public:
+    AdaptiveStream(bool enabled, std::chrono::milliseconds debounceDelay,
+                   PeerConnectionFactory* pcf, const SignalClient* client);
+    ~AdaptiveStream();
+    bool enabled() const noexcept { return _enabled; }
+    // [settings] should contain a single track SID,
+    // previous pending settings of the same track are replaced
+    void setTrackSettings(UpdateTrackSettings settings);
+    // drops pending settings
+    void reset();
+private:
+    void flush();
+    static bool sameSettings(const UpdateTrackSettings& l, const UpdateTrackSettings& r);
+private:
+    const bool _enabled;
+    const uint64_t _timerId;
+    const uint64_t _debounceDelayMs;
+    const SignalClient* const _client;
+    MediaTimer _timer;
+    // key is track SID
+    Bricks::SafeObj<std::unordered_map<std::string, UpdateTrackSettings>> _pending;
+};
+
+} // namespace LiveKitCpp
@@ -14,30 +14,66 @@
 #include "DataChannelsStorage.h"
 #include "DataExchangeListener.h"
 #include "DataChannelListener.h"
+#include "Metrics.h"
 #include "RtcUtils.h"
 #include "livekit/signaling/SignalClient.h"
 #include "livekit/signaling/sfu/ChatMessage.h"
 #include "livekit/signaling/sfu/DataPacket.h"
 #include "livekit/signaling/sfu/UserPacket.h"
 #include <rtc_base/time_utils.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <unordered_set>
 
 namespace {
 
+// same as in other LiveKit SDKs, fits into a single SCTP message with all protobuf overhead
+constexpr size_t g_streamChunkSize = 15000U;
+// rough upper bound of protobuf overhead for data stream packets
+constexpr size_t g_streamPacketOverhead = 256U;
+
 inline std::string dcType(bool local) { return local ? "local" : "remote"; }
 
+// limit of buffered amount for data streams, the rest of
+// the SCTP queue is reserved for other reliable traffic
+inline uint64_t maxStreamsBufferedAmount() {
+    return LiveKitCpp::DataChannel::maxSendQueueSize() / 2U;
+}
+
+// limit of data queued for data streams but not passed to the data channel yet,
+// writes beyond of the limit are rejected (backpressure)
+constexpr uint64_t g_maxStreamsPendingAmount = 16U * 1024U * 1024U;
+
+// size of the next chunk, UTF-8 sequences of text streams are not splitted
+size_t streamChunkSize(std::string_view data, bool text);
+
 }
 
 namespace LiveKitCpp
 {
 
+struct DataChannelsStorage::OutgoingStream
+{
+    bool _text = false;
+    uint64_t _nextChunkIndex = 0U;
+    std::vector<std::string> _destinationIdentities;
+};
+
 class DataChannelsStorage::Wrapper : public Bricks::LoggableS<DataChannelListener>
 {
+    struct PendingPacket
+    {
+        DataPacket _packet;
+        std::string _streamId;
+        size_t _size = 0U;
+    };
 public:
     Wrapper(webrtc::scoped_refptr<DataChannel> channel,
             ResponsesListener* listener,
             const std::shared_ptr<Bricks::Logger>& logger,
             const std::string& logCategory);
-    ~Wrapper() final { close(); }
+    ~Wrapper() final;
     void close();
     bool isOpen() const { return _channel && _channel->isOpen(); }
     bool local() const { return _channel && _channel->local(); }
@@ -47,6 +83,20 @@ public:
                          std::vector<std::string> destinationIdentities = {});
     bool sendUserPacket(std::string participantIdentity, UserPacket packet,
                         std::vector<std::string> destinationIdentities = {});
+    // reserves [size] bytes of pending amount for the following [enqueue] calls,
+    // returns false if the limit of pending data would be exceeded
+    bool reservePending(size_t size);
+    // paced sending of data stream packets, [size] is estimated amount of data in the packet,
+    // [reserved] is true if [size] was reserved by [reservePending] call
+    template <class TValue>
+    bool enqueue(std::string participantIdentity, TValue value,
+                 std::vector<std::string> destinationIdentities,
+                 size_t size, bool reserved = false);
+    uint64_t pendingAmount() const { return _pendingAmount; }
+    // true if any packet of the stream was not sent,
+    // the rest of stream packets were dropped from the queue
+    bool streamFailed(const std::string& streamId) const;
+    void resetStreamFailure(const std::string& streamId);
     // impl. of DataChannelListener
     void onStateChange(DataChannel* channel) final;
     void onMessage(DataChannel* channel, const webrtc::DataBuffer& buffer) final;
@@ -59,10 +109,23 @@ private:
     template <class TValue>
     DataPacket createDataPacket(std::string participantIdentity, TValue value,
                                 std::vector<std::string> destinationIdentities = {}) const;
+    std::optional<PendingPacket> nextPending();
+    void sendPending();
+    void failStream(const std::string& streamId);
+    void releasePending(size_t size);
+    // reflects the buffered amount of the channel in metrics
+    void updateBufferedAmount() const;
 private:
     const webrtc::scoped_refptr<DataChannel> _channel;
     const std::string _logCategory;
     SignalClient _client;
+    Bricks::SafeObj<std::deque<PendingPacket>> _pending;
+    Bricks::SafeObj<std::unordered_set<std::string>> _failedStreams;
+    std::atomic<uint64_t> _pendingAmount = 0U;
+    // the last buffered amount added to metrics
+    mutable std::atomic<uint64_t> _bufferedAmount = 0U;
+    std::atomic_bool _sending = false;
+    std::atomic_bool _resend = false;
 };
 
 DataChannelsStorage::DataChannelsStorage(const std::shared_ptr<Bricks::Logger>& logger,
@@ -208,6 +271,150 @@ bool DataChannelsStorage::sendChatMessage(std::string message, bool deleted, boo
     return false;
 }
 
+std::string DataChannelsStorage::openTextStream(std::string topic,
+                                                std::vector<std::string> destinationIdentities,
+                                                std::optional<uint64_t> totalLength)
+{
+    DataStreamHeader header;
+    header._topic = std::move(topic);
+    header._mimeType = "text/plain";
+    header._totalLength = std::move(totalLength);
+    header._contentHeader = DataStreamTextHeader{};
+    return openStream(std::move(header), std::move(destinationIdentities));
+}
+
+std::string DataChannelsStorage::openByteStream(std::string topic, std::string name,
+                                                std::string mimeType,
+                                                std::vector<std::string> destinationIdentities,
+                                                std::optional<uint64_t> totalLength)
+{
+    DataStreamHeader header;
+    header._topic = std::move(topic);
+    header._mimeType = mimeType.empty() ? "application/octet-stream" : std::move(mimeType);
+    header._totalLength = std::move(totalLength);
+    DataStreamByteHeader byteHeader;
+    byteHeader._name = std::move(name);
+    header._contentHeader = std::move(byteHeader);
+    return openStream(std::move(header), std::move(destinationIdentities));
+}
+
+bool DataChannelsStorage::writeStream(const std::string& streamId, std::string data)
+{
+    if (data.empty()) {
+        return true;
+    }
+    const auto dc = getChannelForSend(true);
+    if (!dc) {
+        return false;
+    }
+    // stream lock keeps order of chunks from concurrent writers
+    LOCK_WRITE_SAFE_OBJ(_outgoingStreams);
+    const auto it = _outgoingStreams->find(streamId);
+    if (it == _outgoingStreams->end()) {
+        if (canLogError()) {
+            logError("failed to write to data stream - stream '" + streamId + "' is not opened");
+        }
+        return false;
+    }
+    if (dc->streamFailed(streamId)) {
+        if (canLogError()) {
+            logError("failed to write to data stream - stream '" + streamId + "' was aborted");
+        }
+        return false;
+    }
+    auto& stream = it->second;
+    // whole [data] is accepted or rejected, so chunks indices stay contiguous
+    std::vector<size_t> sizes;
+    size_t total = 0U;
+    for (std::string_view rest(data); !rest.empty();) {
+        const auto size = streamChunkSize(rest, stream._text);
+        sizes.push_back(size);
+        total += size + g_streamPacketOverhead;
+        rest.remove_prefix(size);
+    }
+    if (!dc->reservePending(total)) {
+        if (canLogWarning()) {
+            logWarning("failed to write to data stream '" + streamId +
+                       "' - too much pending data, try later");
+        }
+        return false;
+    }
+    const auto identity = _identity();
+    std::string_view rest(data);
+    for (const auto size : sizes) {
+        DataStreamChunk chunk;
+        chunk._streamId = streamId;
+        chunk._chunkIndex = stream._nextChunkIndex++;
+        chunk._content = std::string(rest.substr(0U, size));
+        dc->enqueue(identity, std::move(chunk), stream._destinationIdentities,
+                    size + g_streamPacketOverhead, true);
+        rest.remove_prefix(size);
+    }
+    return true;
+}
+
+bool DataChannelsStorage::closeStream(const std::string& streamId, std::string reason)
+{
+    OutgoingStream stream;
+    {
+        LOCK_WRITE_SAFE_OBJ(_outgoingStreams);
+        const auto it = _outgoingStreams->find(streamId);
+        if (it == _outgoingStreams->end()) {
+            return false;
+        }
+        stream = std::move(it->second);
+        _outgoingStreams->erase(it);
+    }
+    if (const auto dc = getChannelForSend(true)) {
+        DataStreamTrailer trailer;
+        trailer._streamId = streamId;
+        trailer._reason = std::move(reason);
+        // receivers are notified about incomplete stream
+        const bool failed = dc->streamFailed(streamId);
+        if (failed) {
+            dc->resetStreamFailure(streamId);
+            if (trailer._reason.empty()) {
+                trailer._reason = "data stream was aborted due to send failure";
+            }
+        }
+        return dc->enqueue(_identity(), std::move(trailer),
+                           std::move(stream._destinationIdentities),
+                           g_streamPacketOverhead) && !failed;
+    }
+    return false;
+}
+
+uint64_t DataChannelsStorage::streamsBufferedAmount() const
+{
+    LOCK_READ_SAFE_OBJ(_dataChannels);
+    const auto it = _dataChannels->find(DataChannel::label(true));
+    if (it != _dataChannels->end()) {
+        return it->second->pendingAmount();
+    }
+    return 0U;
+}
+
+std::string DataChannelsStorage::openStream(DataStreamHeader header,
+                                            std::vector<std::string> destinationIdentities)
+{
+    if (const auto dc = getChannelForSend(true)) {
+        header._streamId = makeUuid();
+        header._timestamp = webrtc::TimeMillis();
+        OutgoingStream stream;
+        stream._text = std::holds_alternative<DataStreamTextHeader>(header._contentHeader);
+        stream._destinationIdentities = destinationIdentities;
+        auto streamId = header._streamId;
+        LOCK_WRITE_SAFE_OBJ(_outgoingStreams);
+        if (dc->enqueue(_identity(), std::move(header),
+                        std::move(destinationIdentities),
+                        g_streamPacketOverhead)) {
+            _outgoingStreams->insert(std::make_pair(streamId, std::move(stream)));
+            return streamId;
+        }
+    }
+    return {};
+}
+
 std::shared_ptr<DataChannelsStorage::Wrapper> DataChannelsStorage::
     getChannelForSend(bool reliable) const
 {
@@ -300,6 +507,72 @@ DataChannelsStorage::Wrapper::Wrapper(webrtc::scoped_refptr<DataChannel> channel
     }
 }
 
+bool DataChannelsStorage::Wrapper::reservePending(size_t size)
+{
+    if (_channel) {
+        auto amount = _pendingAmount.load();
+        do {
+            if (amount + size > g_maxStreamsPendingAmount) {
+                return false;
+            }
+        }
+        while (!_pendingAmount.compare_exchange_weak(amount, amount + size));
+        Metrics::instance()._dataStreamsPendingBytes.add(static_cast<int64_t>(size));
+        return true;
+    }
+    return false;
+}
+
+template <class TValue>
+bool DataChannelsStorage::Wrapper::enqueue(std::string participantIdentity, TValue value,
+                                           std::vector<std::string> destinationIdentities,
+                                           size_t size, bool reserved)
+{
+    if (_channel) {
+        PendingPacket pending;
+        pending._streamId = value._streamId;
+        pending._packet = createDataPacket(std::move(participantIdentity),
+                                           std::move(value),
+                                           std::move(destinationIdentities));
+        pending._size = size;
+        if (!reserved) {
+            // headers & trailers are small and not limited
+            _pendingAmount.fetch_add(size);
+            Metrics::instance()._dataStreamsPendingBytes.add(static_cast<int64_t>(size));
+        }
+        {
+            LOCK_WRITE_SAFE_OBJ(_pending);
+            _pending->push_back(std::move(pending));
+        }
+        sendPending();
+        return true;
+    }
+    if (reserved) {
+        releasePending(size);
+    }
+    return false;
+}
+
+bool DataChannelsStorage::Wrapper::streamFailed(const std::string& streamId) const
+{
+    LOCK_READ_SAFE_OBJ(_failedStreams);
+    return _failedStreams->count(streamId) > 0U;
+}
+
+void DataChannelsStorage::Wrapper::resetStreamFailure(const std::string& streamId)
+{
+    LOCK_WRITE_SAFE_OBJ(_failedStreams);
+    _failedStreams->erase(streamId);
+}
+
+DataChannelsStorage::Wrapper::~Wrapper()
+{
+    close();
+    // dropped packets
+    Metrics::instance()._dataStreamsPendingBytes.sub(static_cast<int64_t>(_pendingAmount.load()));
+    Metrics::instance()._dataChannelsBufferedBytes.sub(static_cast<int64_t>(_bufferedAmount.exchange(0U)));
+}
+
 void DataChannelsStorage::Wrapper::close()
 {
     if (_channel) {
@@ -311,7 +584,13 @@ void DataChannelsStorage::Wrapper::close()
 
 bool DataChannelsStorage::Wrapper::sendDataPacket(DataPacket packet) const
 {
-    return _client.sendDataPacket(std::move(packet));
+    if (_client.sendDataPacket(std::move(packet))) {
+        Metrics::instance()._dataPacketsSent.add();
+        updateBufferedAmount();
+        return true;
+    }
+    Metrics::instance()._dataSendErrors.add();
+    return false;
 }
 
 bool DataChannelsStorage::Wrapper::sendChatMessage(std::string participantIdentity,
@@ -340,10 +619,16 @@ bool DataChannelsStorage::Wrapper::sendUserPacket(std::string participantIdentit
 
 void DataChannelsStorage::Wrapper::onStateChange(DataChannel* channel)
 {
-    if (channel && canLogVerbose()) {
-        logVerbose(dcType(channel->local()) + " data channel '" +
-                          channel->label() + "' state has been changed to " +
-                          dataStateToString(channel->state()));
+    if (channel) {
+        if (canLogVerbose()) {
+            logVerbose(dcType(channel->local()) + " data channel '" +
+                       channel->label() + "' state has been changed to " +
+                       dataStateToString(channel->state()));
+        }
+        // packets may be queued before the channel opening
+        if (channel == _channel.get() && channel->isOpen()) {
+            sendPending();
+        }
     }
 }
 
@@ -357,6 +642,9 @@ void DataChannelsStorage::Wrapper::onMessage(DataChannel* channel,
                        " data channel");
         }
         const auto& data = buffer.data;
+        auto& metrics = Metrics::instance();
+        metrics._dataPacketsReceived.add();
+        metrics._dataBytesReceived.add(data.size());
         _client.parseProtobufData(data.data(), data.size());
     }
 }
@@ -364,10 +652,14 @@ void DataChannelsStorage::Wrapper::onMessage(DataChannel* channel,
 void DataChannelsStorage::Wrapper::onBufferedAmountChange(DataChannel* channel,
                                                           uint64_t sentDataSize)
 {
-    if (channel && canLogVerbose()) {
-        logVerbose(dcType(channel->local()) + " data channel '" +
-                   channel->label() + "' buffer amout has been changed to " +
-                   std::to_string(sentDataSize) + " bytes");
+    if (channel) {
+        if (canLogVerbose()) {
+            logVerbose(dcType(channel->local()) + " data channel '" +
+                       channel->label() + "' buffer amout has been changed to " +
+                       std::to_string(sentDataSize) + " bytes");
+        }
+        updateBufferedAmount();
+        sendPending();
     }
 }
 
@@ -375,6 +667,7 @@ void DataChannelsStorage::Wrapper::onSendError(DataChannel* channel,
                                                webrtc::RTCError error)
 {
     if (channel) {
+        Metrics::instance()._dataSendErrors.add();
         const auto label = channel->label();
         if (canLogError()) {
             logError("send operation failed for '" + label + "' " +
@@ -385,6 +678,92 @@ void DataChannelsStorage::Wrapper::onSendError(DataChannel* channel,
     }
 }
 
+std::optional<DataChannelsStorage::Wrapper::PendingPacket> DataChannelsStorage::Wrapper::nextPending()
+{
+    LOCK_WRITE_SAFE_OBJ(_pending);
+    if (!_pending->empty() && isOpen()) {
+        auto& front = _pending->front();
+        if (_channel->bufferedAmount() + front._size <= maxStreamsBufferedAmount()) {
+            auto pending = std::move(front);
+            _pending->pop_front();
+            return pending;
+        }
+    }
+    return std::nullopt;
+}
+
+void DataChannelsStorage::Wrapper::sendPending()
+{
+    // packets are sent outside of the queue lock because buffered amount
+    // notifications may come synchronously from the send call,
+    // the flag keeps a single sender and the order of packets
+    if (_sending.exchange(true)) {
+        _resend = true;
+        return;
+    }
+    do {
+        _resend = false;
+        while (auto pending = nextPending()) {
+            releasePending(pending->_size);
+            if (!sendDataPacket(std::move(pending->_packet))) {
+                failStream(pending->_streamId);
+            }
+        }
+    }
+    while (_resend.exchange(false));
+    _sending = false;
+    // the notification may arrive between the last check and the reset of the flag
+    if (_resend.exchange(false)) {
+        sendPending();
+    }
+}
+
+void DataChannelsStorage::Wrapper::failStream(const std::string& streamId)
+{
+    {
+        LOCK_WRITE_SAFE_OBJ(_failedStreams);
+        if (!_failedStreams->insert(streamId).second) {
+            return;
+        }
+    }
+    // the rest of the stream is useless for receivers without lost chunk
+    size_t dropped = 0U;
+    {
+        LOCK_WRITE_SAFE_OBJ(_pending);
+        const auto it = std::remove_if(_pending->begin(), _pending->end(),
+                                       [&streamId, &dropped](const PendingPacket& pending) {
+            if (pending._streamId == streamId) {
+                dropped += pending._size;
+                return true;
+            }
+            return false;
+        });
+        _pending->erase(it, _pending->end());
+    }
+    releasePending(dropped);
+    if (canLogError()) {
+        logError("failed to send packet of data stream '" + streamId + "', the stream was aborted");
+    }
+}
+
+void DataChannelsStorage::Wrapper::releasePending(size_t size)
+{
+    if (size) {
+        _pendingAmount.fetch_sub(size);
+        Metrics::instance()._dataStreamsPendingBytes.sub(static_cast<int64_t>(size));
+    }
+}
+
+void DataChannelsStorage::Wrapper::updateBufferedAmount() const
+{
+    if (_channel) {
+        const auto amount = _channel->bufferedAmount();
+        const auto previous = _bufferedAmount.exchange(amount);
+        Metrics::instance()._dataChannelsBufferedBytes.add(static_cast<int64_t>(amount) -
+                                                           static_cast<int64_t>(previous));
+    }
+}
+
 template <class TValue>
 DataPacket DataChannelsStorage::Wrapper::createDataPacket(std::string participantIdentity,
                                                           TValue value,
@@ -399,3 +778,24 @@ DataPacket DataChannelsStorage::Wrapper::createDataPacket(std::string participan
 }
 
 } // namespace LiveKitCpp
+
+namespace
+{
+
+size_t streamChunkSize(std::string_view data, bool text)
+{
+    auto size = std::min(data.size(), g_streamChunkSize);
+    if (text && size < data.size()) {
+        // step back to the start of UTF-8 sequence (skip continuation bytes)
+        auto boundary = size;
+        while (boundary > 0U && 0x80 == (uint8_t(data[boundary]) & 0xC0)) {
+            --boundary;
+        }
+        if (boundary > 0U) {
+            size = boundary;
+        }
+    }
+    return size;
+}
+
+}
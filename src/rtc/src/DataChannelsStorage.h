@@ -17,6 +17,7 @@
 #include "Listener.h"
 #include "SafeObj.h"
 #include "livekit/signaling/ResponsesListener.h"
+#include "livekit/signaling/sfu/DataStreamHeader.h"
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -30,8 +31,11 @@ class DataExchangeListener;
 class DataChannelsStorage : private Bricks::LoggableS<ResponsesListener>
 {
     class Wrapper;
+    struct OutgoingStream;
     // key is channel label
     using DataChannels = std::unordered_map<std::string, std::shared_ptr<Wrapper>>;
+    // key is stream ID
+    using OutgoingStreams = std::unordered_map<std::string, OutgoingStream>;
 public:
     DataChannelsStorage(const std::shared_ptr<Bricks::Logger>& logger = {},
                         std::string logCategory = "data_channels");
@@ -50,7 +54,23 @@ public:
     // from a participant's audio transcription
     bool sendChatMessage(std::string message, bool deleted, bool generated = false,
                          std::vector<std::string> destinationIdentities = {}) const;
+    // outgoing data streams (reliable channel only), return ID of the new stream or empty string
+    std::string openTextStream(std::string topic,
+                               std::vector<std::string> destinationIdentities = {},
+                               std::optional<uint64_t> totalLength = {});
+    std::string openByteStream(std::string topic, std::string name, std::string mimeType = {},
+                               std::vector<std::string> destinationIdentities = {},
+                               std::optional<uint64_t> totalLength = {});
+    // [data] is splitted to chunks and queued, the queue is drained
+    // according to the buffered amount of the data channel,
+    // all chunks are rejected if the queue limit is reached
+    bool writeStream(const std::string& streamId, std::string data);
+    // empty [reason] for the expected end of stream, false for aborted stream
+    bool closeStream(const std::string& streamId, std::string reason = {});
+    // amount of bytes queued for data streams but not passed to the data channel yet
+    uint64_t streamsBufferedAmount() const;
 private:
+    std::string openStream(DataStreamHeader header, std::vector<std::string> destinationIdentities);
     std::shared_ptr<Wrapper> getChannelForSend(bool reliable) const;
     // overrides of Bricks::LoggableS<>
     std::string_view logCategory() const final { return _logCategory; }
@@ -60,6 +80,7 @@ private:
 private:
     const std::string _logCategory;
     Bricks::SafeObj<DataChannels> _dataChannels;
+    Bricks::SafeObj<OutgoingStreams> _outgoingStreams;
     Bricks::Listener<DataExchangeListener*> _listener;
     // from owner
     Bricks::SafeObj<std::string> _identity;
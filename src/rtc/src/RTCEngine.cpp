@@ -15,21 +15,10 @@
 #include "RTCEngineImpl.h"
 #include "RemoteParticipantImpl.h"
 #include "WebsocketEndPoint.h"
-#include "Seq.h"
-#include "TrackInfoSeq.h"
 #include "livekit/rtc/e2e/KeyProvider.h"
 #include "livekit/rtc/media/AudioDevice.h"
 #include "livekit/rtc/media/LocalVideoDevice.h"
 
-namespace
-{
-
-inline bool compareTrackInfo(const LiveKitCpp::TrackInfo& l, const LiveKitCpp::TrackInfo& r) {
-    return l._sid == r._sid;
-}
-
-}
-
 namespace LiveKitCpp
 {
 
@@ -46,6 +35,7 @@ RTCEngine::RTCEngine(Options options, bool disableAudioRed,
 RTCEngine::~RTCEngine()
 {
     if (auto impl = dispose()) {
+        impl->cancelReconnect();
         impl->cleanup();
     }
 }
@@ -95,6 +85,7 @@ bool RTCEngine::connect(std::string url, std::string authToken)
 void RTCEngine::disconnect()
 {
     if (const auto impl = loadImpl()) {
+        impl->cancelReconnect();
         impl->disconnect();
     }
 }
@@ -132,6 +123,51 @@ bool RTCEngine::sendChatMessage(std::string message, bool deleted, bool generate
     return false;
 }
 
+std::string RTCEngine::openTextStream(std::string topic,
+                                      const std::vector<std::string>& destinationIdentities,
+                                      const std::optional<uint64_t>& totalLength)
+{
+    if (const auto impl = loadImpl()) {
+        return impl->openTextStream(std::move(topic), destinationIdentities, totalLength);
+    }
+    return {};
+}
+
+std::string RTCEngine::openByteStream(std::string topic, std::string name, std::string mimeType,
+                                      const std::vector<std::string>& destinationIdentities,
+                                      const std::optional<uint64_t>& totalLength)
+{
+    if (const auto impl = loadImpl()) {
+        return impl->openByteStream(std::move(topic), std::move(name), std::move(mimeType),
+                                    destinationIdentities, totalLength);
+    }
+    return {};
+}
+
+bool RTCEngine::writeStream(const std::string& streamId, std::string data)
+{
+    if (const auto impl = loadImpl()) {
+        return impl->writeStream(streamId, std::move(data));
+    }
+    return false;
+}
+
+bool RTCEngine::closeStream(const std::string& streamId, std::string reason)
+{
+    if (const auto impl = loadImpl()) {
+        return impl->closeStream(streamId, std::move(reason));
+    }
+    return false;
+}
+
+uint64_t RTCEngine::streamsBufferedAmount() const
+{
+    if (const auto impl = loadImpl()) {
+        return impl->streamsBufferedAmount();
+    }
+    return 0U;
+}
+
 void RTCEngine::queryStats(const webrtc::scoped_refptr<webrtc::RTCStatsCollectorCallback>& callback) const
 {
     if (callback) {
@@ -186,22 +222,4 @@ std::shared_ptr<const RemoteParticipants> RTCEngine::remoteParticipants() const
     return {};
 }
 
-void findDifference(const std::vector<TrackInfo>& currentTracksInfo,
-                    const std::vector<TrackInfo>& newTracksInfo,
-                    std::vector<TrackInfo>* added,
-                    std::vector<TrackInfo>* removed,
-                    std::vector<TrackInfo>* updated)
-{
-    using SeqType = Seq<TrackInfo>;
-    if (added) {
-        *added = SeqType::difference<std::vector>(newTracksInfo, currentTracksInfo, compareTrackInfo);
-    }
-    if (removed) {
-        *removed = SeqType::difference<std::vector>(currentTracksInfo, newTracksInfo, compareTrackInfo);
-    }
-    if (updated) {
-        *updated = SeqType::intersection<std::vector>(currentTracksInfo, newTracksInfo, compareTrackInfo);
-    }
-}
-
 } // namespace LiveKitCpp
@@ -16,6 +16,7 @@
 #include "livekit/rtc/Options.h"
 #include <api/scoped_refptr.h>
 #include <atomic>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -84,6 +85,16 @@ public:
                          bool deleted,
                          bool generated,
                          const std::vector<std::string>& destinationIdentities = {}) const;
+    // data streams
+    std::string openTextStream(std::string topic,
+                               const std::vector<std::string>& destinationIdentities = {},
+                               const std::optional<uint64_t>& totalLength = {});
+    std::string openByteStream(std::string topic, std::string name, std::string mimeType = {},
+                               const std::vector<std::string>& destinationIdentities = {},
+                               const std::optional<uint64_t>& totalLength = {});
+    bool writeStream(const std::string& streamId, std::string data);
+    bool closeStream(const std::string& streamId, std::string reason = {});
+    uint64_t streamsBufferedAmount() const;
     void queryStats(const webrtc::scoped_refptr<webrtc::RTCStatsCollectorCallback>& callback) const;
     std::string addTrackDevice(std::unique_ptr<AudioDevice> device, EncryptionType encryption);
     std::string addTrackDevice(std::unique_ptr<LocalVideoDevice> device, EncryptionType encryption);
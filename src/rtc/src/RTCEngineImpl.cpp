@@ -18,6 +18,7 @@
 #include "LocalVideoDeviceImpl.h"
 #include "LocalAudioTrackImpl.h"
 #include "LocalVideoTrackImpl.h"
+#include "Metrics.h"
 #include "PeerConnectionFactory.h"
 #include "RemoteParticipantImpl.h"
 #include "RoomUtils.h"
@@ -33,7 +34,6 @@
 #include "livekit/rtc/e2e/KeyProviderOptions.h"
 #include "livekit/signaling/sfu/UpdateLocalAudioTrack.h"
 #include <algorithm> // for std::min
-#include <thread>
 
 namespace {
 
@@ -78,6 +78,8 @@ RTCEngineImpl::RTCEngineImpl(Options options, bool disableAudioRed,
     , _localDcs(logger)
     , _remoteDcs(logger)
     , _client(std::move(socket), logger.get())
+    , _reconnectScheduler(_options, pcf)
+    , _adaptiveStream(_options._adaptiveStream, _options._adaptiveStreamDebounce, pcf, &_client)
 {
     _client.setAdaptiveStream(_options._adaptiveStream);
     _client.setAutoSubscribe(_options._autoSubscribe);
@@ -90,6 +92,7 @@ RTCEngineImpl::RTCEngineImpl(Options options, bool disableAudioRed,
 
 RTCEngineImpl::~RTCEngineImpl()
 {
+    cancelReconnect();
     _localParticipant->reset();
     _transportListener->set(nullptr);
     _client.setServerListener(nullptr);
@@ -182,6 +185,8 @@ bool RTCEngineImpl::connect(std::string url, std::string authToken)
         }
         return false;
     }
+    Metrics::instance()._sessionConnects.add();
+    _reconnectScheduler.reset();
     _client.setHost(std::move(url));
     _client.setAuthToken(std::move(authToken));
     return _client.connect();
@@ -201,6 +206,11 @@ void RTCEngineImpl::disconnect()
     }
 }
 
+void RTCEngineImpl::cancelReconnect()
+{
+    _reconnectScheduler.cancel();
+}
+
 bool RTCEngineImpl::sendUserPacket(std::string payload, bool reliable,
                                    const std::string& topic,
                                    const std::vector<std::string>& destinationSids,
@@ -217,6 +227,36 @@ bool RTCEngineImpl::sendChatMessage(std::string message,
     return _localDcs.sendChatMessage(std::move(message), deleted, generated, destinationIdentities);
 }
 
+std::string RTCEngineImpl::openTextStream(std::string topic,
+                                          const std::vector<std::string>& destinationIdentities,
+                                          const std::optional<uint64_t>& totalLength)
+{
+    return _localDcs.openTextStream(std::move(topic), destinationIdentities, totalLength);
+}
+
+std::string RTCEngineImpl::openByteStream(std::string topic, std::string name, std::string mimeType,
+                                          const std::vector<std::string>& destinationIdentities,
+                                          const std::optional<uint64_t>& totalLength)
+{
+    return _localDcs.openByteStream(std::move(topic), std::move(name), std::move(mimeType),
+                                    destinationIdentities, totalLength);
+}
+
+bool RTCEngineImpl::writeStream(const std::string& streamId, std::string data)
+{
+    return _localDcs.writeStream(streamId, std::move(data));
+}
+
+bool RTCEngineImpl::closeStream(const std::string& streamId, std::string reason)
+{
+    return _localDcs.closeStream(streamId, std::move(reason));
+}
+
+uint64_t RTCEngineImpl::streamsBufferedAmount() const
+{
+    return _localDcs.streamsBufferedAmount();
+}
+
 void RTCEngineImpl::queryStats(const webrtc::scoped_refptr<webrtc::RTCStatsCollectorCallback>& callback) const
 {
     if (callback) {
@@ -228,6 +268,7 @@ void RTCEngineImpl::queryStats(const webrtc::scoped_refptr<webrtc::RTCStatsColle
 
 void RTCEngineImpl::cleanup(const std::optional<LiveKitError>& error, const std::string& errorDetails)
 {
+    _adaptiveStream.reset();
     _remoteParicipants->reset();
     disconnect();
     if (error) {
@@ -289,6 +330,56 @@ void RTCEngineImpl::handleLocalParticipantDisconnection(DisconnectReason reason)
     }
 }
 
+void RTCEngineImpl::scheduleReconnect(bool resume)
+{
+    const auto attempt = _reconnectScheduler.attempts() + 1U;
+    const auto delay = _reconnectScheduler.schedule([resume, weak = weak_from_this()]() {
+        if (const auto self = weak.lock()) {
+            self->reconnect(resume);
+        }
+    });
+    if (delay) {
+        if (canLogInfo()) {
+            logInfo("reconnect attempt " + std::to_string(attempt) + " of " +
+                    std::to_string(_reconnectScheduler.maxAttempts()) + " in " +
+                    std::to_string(delay->count()) + " ms");
+        }
+        notify(&SessionListener::onReconnectScheduled, attempt,
+               _reconnectScheduler.maxAttempts(), delay.value());
+    }
+    else if (_reconnectScheduler.maxAttempts() > 0U) {
+        if (canLogWarning()) {
+            logWarning("Couldn't reconnect to server, all attempts are exhausted");
+        }
+        Metrics::instance()._sessionReconnectFailures.add();
+        _client.resetParticipantSid();
+        notify(&SessionListener::onReconnectFailed);
+    }
+}
+
+void RTCEngineImpl::reconnect(bool resume)
+{
+    if (resume) {
+        // should attempt a resume with `reconnect=1` in join URL
+        _client.setParticipantSid(_localParticipant->sid());
+    }
+    else {
+        _client.resetParticipantSid();
+    }
+    const auto attempt = _reconnectScheduler.attempts();
+    Metrics::instance()._sessionReconnectAttempts.add();
+    const bool started = _client.connect();
+    notify(&SessionListener::onReconnectAttempt, attempt, started);
+    if (!started) {
+        if (canLogWarning()) {
+            logWarning("Couldn't reconnect to server, attempt " +
+                       std::to_string(attempt) + " of " +
+                       std::to_string(_reconnectScheduler.maxAttempts()));
+        }
+        scheduleReconnect(resume);
+    }
+}
+
 void RTCEngineImpl::notifyAboutLocalParticipantJoinLeave(bool join)
 {
     if (!_localParticipant->sid().empty() && exchangeVal(join, _joined)) {
@@ -453,6 +544,8 @@ void RTCEngineImpl::createTransportManager(const JoinResponse& response,
                                                         response._participant._identity,
                                                         _options._prefferedAudioEncoder,
                                                         _options._prefferedVideoEncoder,
+                                                        _options._simulcast ? _options._simulcastLayers :
+                                                                              std::vector<VideoSimulcastLayer>{},
                                                         logger());
     pcManager->setListener(this);
     // both playout & recording are enabled by default
@@ -462,7 +555,7 @@ void RTCEngineImpl::createTransportManager(const JoinResponse& response,
     if (!audioRecordingEnabled()) {
         pcManager->setAudioRecording(false);
     }
-    _reconnectAttempts = 0U;
+    _reconnectScheduler.reset();
     std::atomic_store(&_pcManager, pcManager);
     _localParticipant->addDevicesToTransportManager(pcManager.get());
     pcManager->negotiate(false);
@@ -538,6 +631,11 @@ void RTCEngineImpl::notifyAboutSetRtpParametersFailure(const std::string& trackS
     }
 }
 
+void RTCEngineImpl::notifyAboutTrackSettings(UpdateTrackSettings settings)
+{
+    _adaptiveStream.setTrackSettings(std::move(settings));
+}
+
 std::optional<bool> RTCEngineImpl::stereoRecording() const
 {
     return _localParticipant->stereoRecording();
@@ -718,25 +816,8 @@ void RTCEngineImpl::onLeave(LeaveRequest leave)
     if (LeaveRequestAction::Disconnect == leave._action) {
         _client.resetParticipantSid();
     }
-    else if (_reconnectAttempts < _options._reconnectAttempts) {
-        // TODO: replace to media timer
-        std::this_thread::sleep_for(_options._reconnectAttemptDelay);
-        if (LeaveRequestAction::Resume == leave._action) {
-            // should attempt a resume with `reconnect=1` in join URL
-            _client.setParticipantSid(_localParticipant->sid());
-        }
-        else {
-            _client.resetParticipantSid();
-        }
-        // attempt to reconnect
-        if (_client.connect()) {
-            _reconnectAttempts.fetch_add(1U);
-        }
-        else if (canLogWarning()) {
-            logWarning("Couldn't reconnect to server, attempt " +
-                       std::to_string(_reconnectAttempts) + " of " +
-                       std::to_string(_options._reconnectAttempts));
-        }
+    else {
+        scheduleReconnect(LeaveRequestAction::Resume == leave._action);
     }
 }
 
@@ -18,6 +18,8 @@
 #include "TransportManagerListener.h"
 #include "RemoteParticipants.h"
 #include "RemoteParticipantsListener.h"
+#include "ReconnectScheduler.h"
+#include "AdaptiveStream.h"
 #include "DataChannelsStorage.h"
 #include "DataExchangeListener.h"
 #include "SafeObj.h"
@@ -108,6 +110,8 @@ public:
     SessionState state() const noexcept { return _state; }
     bool connect(std::string url, std::string authToken);
     void disconnect();
+    // stops pending reconnection after server-initiated leave (if any)
+    void cancelReconnect();
     bool sendUserPacket(std::string payload, bool reliable,
                         const std::string& topic = {},
                         const std::vector<std::string>& destinationSids = {},
@@ -116,6 +120,16 @@ public:
                          bool deleted,
                          bool generated,
                          const std::vector<std::string>& destinationIdentities = {}) const;
+    // data streams
+    std::string openTextStream(std::string topic,
+                               const std::vector<std::string>& destinationIdentities = {},
+                               const std::optional<uint64_t>& totalLength = {});
+    std::string openByteStream(std::string topic, std::string name, std::string mimeType = {},
+                               const std::vector<std::string>& destinationIdentities = {},
+                               const std::optional<uint64_t>& totalLength = {});
+    bool writeStream(const std::string& streamId, std::string data);
+    bool closeStream(const std::string& streamId, std::string reason = {});
+    uint64_t streamsBufferedAmount() const;
     void queryStats(const webrtc::scoped_refptr<webrtc::RTCStatsCollectorCallback>& callback) const;
     void cleanup(const std::optional<LiveKitError>& error = {}, const std::string& errorDetails = {});
 private:
@@ -128,6 +142,8 @@ private:
     std::shared_ptr<ParticipantAccessor> participant(const std::string& sid) const;
     void handleLocalParticipantDisconnection(DisconnectReason reason);
     void notifyAboutLocalParticipantJoinLeave(bool join);
+    void scheduleReconnect(bool resume);
+    void reconnect(bool resume);
     // search by cid or sid
     template <class TTrack>
     bool sendAddTrack(const std::shared_ptr<TTrack>& track);
@@ -161,6 +177,8 @@ private:
     // impl. TrackManager
     void notifyAboutMuteChanges(const std::string& trackSid, bool muted) final;
     void notifyAboutSetRtpParametersFailure(const std::string& trackSid, std::string_view details) final;
+    void notifyAboutTrackSettings(UpdateTrackSettings settings) final;
+    bool adaptiveStream() const final { return _adaptiveStream.enabled(); }
     std::optional<bool> stereoRecording() const final;
     // impl. of RemoteParticipantsListener
     void onParticipantAdded(const std::string& sid) final;
@@ -229,8 +247,10 @@ private:
     std::atomic_bool _playout = true;
     std::atomic_bool _recording = true;
     std::shared_ptr<TransportManager> _pcManager;
-    /** keeps track of how often an initial join connection has been tried */
-    std::atomic_uint _reconnectAttempts = 0U;
+    // reconnect attempts after server-initiated leave
+    ReconnectScheduler _reconnectScheduler;
+    // settings of subscribed video tracks driven by sinks
+    AdaptiveStream _adaptiveStream;
     std::atomic<SessionState> _state = SessionState::TransportDisconnected;
     Bricks::SafeObj<JoinResponse> _lastJoinResponse;
     std::atomic_bool _joined = false;
@@ -0,0 +1,107 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "ReconnectScheduler.h"
+#include "PeerConnectionFactory.h"
+#include "livekit/rtc/Options.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace
+{
+
+inline double uniformRandom(double from, double to)
+{
+    static thread_local std::mt19937 generator(std::random_device{}());
+    return std::uniform_real_distribution<double>(from, to)(generator);
+}
+
+}
+
+namespace LiveKitCpp
+{
+
+ReconnectScheduler::ReconnectScheduler(const Options& options, PeerConnectionFactory* pcf)
+    : _timerId(reinterpret_cast<uint64_t>(this))
+    , _maxAttempts(uint32_t(std::max(0, options._reconnectAttempts)))
+    , _initialDelay(std::max(std::chrono::milliseconds::zero(), options._reconnectAttemptDelay))
+    , _maxDelay(std::max(_initialDelay, options._reconnectMaxAttemptDelay))
+    , _maxTotalTime(std::max(std::chrono::milliseconds::zero(), options._reconnectMaxTotalTime))
+    , _backoffFactor(std::max(1., options._reconnectBackoffFactor))
+    , _jitter(std::clamp(options._reconnectJitter, 0., 1.))
+    , _timer(pcf)
+{
+}
+
+ReconnectScheduler::~ReconnectScheduler()
+{
+    cancel();
+}
+
+std::optional<std::chrono::milliseconds> ReconnectScheduler::
+    schedule(absl::AnyInvocable<void()&&> attempt)
+{
+    if (attempt) {
+        const auto number = _attempts.load();
+        if (number < _maxAttempts) {
+            const auto delay = this->delay(number);
+            {
+                LOCK_WRITE_SAFE_OBJ(_startTime);
+                const auto now = Clock::now();
+                if (!_startTime->has_value()) {
+                    _startTime->emplace(now);
+                }
+                else if (_maxTotalTime.count() > 0 &&
+                         now + delay - _startTime->value() > _maxTotalTime) {
+                    return std::nullopt;
+                }
+            }
+            _attempts.fetch_add(1U);
+            _pending = true;
+            _timer.cancelSingleShot(_timerId);
+            _timer.singleShot([this, attempt = std::move(attempt)]() mutable {
+                _pending = false;
+                std::move(attempt)();
+            }, uint64_t(delay.count()), _timerId);
+            return delay;
+        }
+    }
+    return std::nullopt;
+}
+
+void ReconnectScheduler::cancel()
+{
+    if (_pending.exchange(false)) {
+        _timer.cancelSingleShot(_timerId);
+    }
+}
+
+void ReconnectScheduler::reset()
+{
+    cancel();
+    _attempts = 0U;
+    _startTime(std::nullopt);
+}
+
+std::chrono::milliseconds ReconnectScheduler::delay(uint32_t attempt) const
+{
+    auto delay = double(_initialDelay.count()) * std::pow(_backoffFactor, attempt);
+    delay = std::min(delay, double(_maxDelay.count()));
+    if (_jitter > 0.) {
+        delay *= uniformRandom(1. - _jitter, 1. + _jitter);
+    }
+    return std::chrono::milliseconds(std::llround(delay));
+}
+
+} // namespace LiveKitCpp
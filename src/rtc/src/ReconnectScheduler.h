@@ -0,0 +1,64 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // ReconnectScheduler.h
+#include "MediaTimer.h"
+#include "SafeObj.h"
+#include <absl/functional/any_invocable.h>
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+namespace LiveKitCpp
+{
+
+class PeerConnectionFactory;
+struct Options;
+
+// non-blocking scheduler of reconnect attempts:
+// exponential backoff with jitter, limited by number of attempts & total time
+class ReconnectScheduler
+{
+    using Clock = std::chrono::steady_clock;
+public:
+    ReconnectScheduler(const Options& options, PeerConnectionFactory* pcf);
+    ~ReconnectScheduler();
+    uint32_t maxAttempts() const noexcept { return _maxAttempts; }
+    // number of scheduled attempts since last reset
+    uint32_t attempts() const noexcept { return _attempts; }
+    bool pending() const noexcept { return _pending; }
+    // returns delay before the attempt or null if limits are exceeded,
+    // previous pending attempt (if any) is replaced
+    std::optional<std::chrono::milliseconds> schedule(absl::AnyInvocable<void()&&> attempt);
+    // cancels pending attempt, counters stay unchanged
+    void cancel();
+    // cancels pending attempt and resets counters, should be called after successful connection
+    void reset();
+private:
+    std::chrono::milliseconds delay(uint32_t attempt) const;
+private:
+    const uint64_t _timerId;
+    const uint32_t _maxAttempts;
+    const std::chrono::milliseconds _initialDelay;
+    const std::chrono::milliseconds _maxDelay;
+    const std::chrono::milliseconds _maxTotalTime;
+    const double _backoffFactor;
+    const double _jitter;
+    MediaTimer _timer;
+    std::atomic<uint32_t> _attempts = 0U;
+    std::atomic_bool _pending = false;
+    // time of the 1st attempt scheduling
+    Bricks::SafeObj<std::optional<Clock::time_point>> _startTime;
+};
+
+} // namespace LiveKitCpp
@@ -170,7 +170,8 @@ void RemoteParticipantImpl::setInfo(const std::weak_ptr<TrackManager>& trackMana
 {
     bool sidChanged = false, identityChanged = false, nameChanged = false;
     bool metadataChanged = false, kindChanged = false;
-    std::vector<TrackInfo> added, removed, updated;
+    std::vector<TrackInfo> added, removed;
+    std::vector<TrackInfoUpdate> updated;
     {
         LOCK_WRITE_SAFE_OBJ(_info);
         findDifference(_info->_tracks, info._tracks, &added, &removed, &updated);
@@ -207,16 +208,17 @@ void RemoteParticipantImpl::setInfo(const std::weak_ptr<TrackManager>& trackMana
                 break;
         }
     }
-    // update existed
-    for (const auto& track : updated) {
+    // update changed only
+    for (const auto& update : updated) {
+        const auto& track = update._info;
         switch (track._type) {
             case TrackType::Audio:
-                if (!updateAudio(track)) {
+                if (!updateAudio(update)) {
                     addAudio(track._sid, trackManager);
                 }
                 break;
             case TrackType::Video:
-                if (!updateVideo(track)) {
+                if (!updateVideo(update)) {
                     addVideo(track._sid, trackManager);
                 }
                 break;
@@ -253,14 +255,14 @@ bool RemoteParticipantImpl::setRemoteSideTrackMute(const std::string& trackSid,
             if (TrackType::Audio == trackInfo->_type) {
                 LOCK_READ_SAFE_OBJ(_audioTracks);
                 if (const auto ndx = findBySid(trackSid, _audioTracks.constRef())) {
-                    _audioTracks->at(ndx.value())->setInfo(*trackInfo);
+                    _audioTracks->at(ndx.value())->setInfo(*trackInfo, uint32_t(TrackInfoChange::Muted));
                     return true;
                 }
             }
             if (TrackType::Video == trackInfo->_type) {
                 LOCK_READ_SAFE_OBJ(_videoTracks);
                 if (const auto ndx = findBySid(trackSid, _videoTracks.constRef())) {
-                    _videoTracks->at(ndx.value())->setInfo(*trackInfo);
+                    _videoTracks->at(ndx.value())->setInfo(*trackInfo, uint32_t(TrackInfoChange::Muted));
                     return true;
                 }
             }
@@ -390,24 +392,26 @@ std::string_view RemoteParticipantImpl::logCategory() const
     return "remote_participant";
 }
 
-bool RemoteParticipantImpl::updateAudio(const TrackInfo& trackInfo) const
+bool RemoteParticipantImpl::updateAudio(const TrackInfoUpdate& update) const
 {
+    const auto& trackInfo = update._info;
     if (TrackType::Audio == trackInfo._type && !trackInfo._sid.empty()) {
         LOCK_READ_SAFE_OBJ(_audioTracks);
         if (const auto ndx = findBySid(trackInfo._sid, _audioTracks.constRef())) {
-            _audioTracks->at(ndx.value())->setInfo(trackInfo);
+            _audioTracks->at(ndx.value())->setInfo(trackInfo, update._changes);
             return true;
         }
     }
     return false;
 }
 
-bool RemoteParticipantImpl::updateVideo(const TrackInfo& trackInfo) const
+bool RemoteParticipantImpl::updateVideo(const TrackInfoUpdate& update) const
 {
+    const auto& trackInfo = update._info;
     if (TrackType::Video == trackInfo._type && !trackInfo._sid.empty()) {
         LOCK_READ_SAFE_OBJ(_videoTracks);
         if (const auto ndx = findBySid(trackInfo._sid, _videoTracks.constRef())) {
-            _videoTracks->at(ndx.value())->setInfo(trackInfo);
+            _videoTracks->at(ndx.value())->setInfo(trackInfo, update._changes);
             return true;
         }
     }
@@ -36,6 +36,7 @@ class RemoteAudioTrackImpl;
 class RemoteVideoTrackImpl;
 class RtpReceiversStorage;
 class TrackManager;
+struct TrackInfoUpdate;
 
 class RemoteParticipantImpl : public Bricks::LoggableS<RemoteParticipant, ParticipantAccessor>
 {
@@ -84,8 +85,8 @@ protected:
     // impl. of Bricks::LoggableS<>
     std::string_view logCategory() const final;
 private:
-    bool updateAudio(const TrackInfo& trackInfo) const;
-    bool updateVideo(const TrackInfo& trackInfo) const;
+    bool updateAudio(const TrackInfoUpdate& update) const;
+    bool updateVideo(const TrackInfoUpdate& update) const;
     const TrackInfo* findBySid(const std::string& trackSid) const;
     TrackInfo* findBySid(const std::string& trackSid);
     template <class TTrack>
@@ -14,19 +14,15 @@
 #include "RemoteParticipants.h"
 #include "RemoteParticipantImpl.h"
 #include "DataChannel.h"
-#include "Seq.h"
 #include "RemoteParticipantsListener.h"
 #include "livekit/signaling/sfu/ParticipantInfo.h"
 #include <api/rtp_transceiver_interface.h>
+#include <unordered_set>
 
 namespace {
 
 using namespace LiveKitCpp;
 
-inline bool compareParticipantInfo(const ParticipantInfo& l, const ParticipantInfo& r) {
-    return l._sid == r._sid;
-}
-
 inline bool addToParticipant(const std::shared_ptr<RemoteParticipantImpl>& participant,
                              const std::string& trackSid,
                              const std::weak_ptr<TrackManager>& trackManager,
@@ -74,10 +70,8 @@ void RemoteParticipants::setRemoteSideTrackMute(const std::string& sid, bool mut
 {
     if (!sid.empty()) {
         LOCK_READ_SAFE_OBJ(_participants);
-        for (const auto& participant : _participants.constRef()) {
-            if (participant->setRemoteSideTrackMute(sid, mute)) {
-                break;
-            }
+        if (const auto participant = participantByTrackSid(sid)) {
+            participant->setRemoteSideTrackMute(sid, mute);
         }
     }
 }
@@ -88,7 +82,9 @@ void RemoteParticipants::setInfo(const std::weak_ptr<TrackManager>& trackManager
     LOCK_WRITE_SAFE_OBJ(_participants);
     clearParticipants();
     if (!infos.empty()) {
-        _participants->reserve(infos.size());
+        _participants->_list.reserve(infos.size());
+        _participants->_bySid.reserve(infos.size());
+        _participants->_byIdentity.reserve(infos.size());
         for (const auto& info : infos) {
             if (ParticipantState::Disconnected != info._state) {
                 auto participant = std::make_shared<RemoteParticipantImpl>(_nonBindedReceivers, logger());
@@ -103,30 +99,47 @@ void RemoteParticipants::updateInfo(const std::weak_ptr<TrackManager>& trackMana
                                     const std::vector<ParticipantInfo>& infos)
 {
     if (!infos.empty()) {
-        using SeqType = Seq<ParticipantInfo>;
         LOCK_WRITE_SAFE_OBJ(_participants);
-        const auto current = this->infos();
-        const auto added = SeqType::difference<std::vector>(infos, current, compareParticipantInfo);
-        const auto removed = SeqType::difference<std::vector>(current, infos, compareParticipantInfo);
-        const auto updated = SeqType::intersection<std::vector>(current, infos, compareParticipantInfo);
+        std::unordered_set<std::string> sids;
+        std::vector<const ParticipantInfo*> added, updated;
+        sids.reserve(infos.size());
+        for (const auto& info : infos) {
+            if (sids.insert(info._sid).second) {
+                if (_participants->_bySid.count(info._sid)) {
+                    updated.push_back(&info);
+                }
+                else {
+                    added.push_back(&info);
+                }
+            }
+        }
+        // remove missing
+        std::vector<std::string> removed;
+        for (const auto& participant : _participants->_list) {
+            auto sid = participant->sid();
+            if (!sids.count(sid)) {
+                removed.push_back(std::move(sid));
+            }
+        }
         // add new
-        for (const auto& info : added) {
+        for (const auto info : added) {
             auto participant = std::make_shared<RemoteParticipantImpl>(_nonBindedReceivers, logger());
-            participant->setInfo(trackManager, info);
+            participant->setInfo(trackManager, *info);
             addParticipant(participant);
         }
-        // remove
-        for (const auto& info : removed) {
-            removeParticipant(info._sid);
+        for (const auto& sid : removed) {
+            removeParticipant(sid);
         }
         // update existed
-        for (const auto& info : updated) {
-            if (const auto ndx = participantIndexBySid(info._sid)) {
-                const auto participant = _participants->at(ndx.value());
-                participant->setInfo(trackManager, info);
-                if (ParticipantState::Disconnected == info._state) {
-                    _participants->erase(_participants->begin() + ndx.value());
-                    dispose(participant);
+        for (const auto info : updated) {
+            if (const auto ndx = participantIndexBySid(info->_sid)) {
+                const auto participant = _participants->_list.at(ndx.value());
+                // identity & set of tracks may be changed
+                unindex(participant->info(), ndx.value());
+                participant->setInfo(trackManager, *info);
+                index(*info, ndx.value());
+                if (ParticipantState::Disconnected == info->_state) {
+                    removeParticipantAt(ndx.value());
                 }
             }
         }
@@ -141,16 +154,12 @@ bool RemoteParticipants::addMedia(const std::weak_ptr<TrackManager>& trackManage
         LOCK_READ_SAFE_OBJ(_participants);
         if (!participantSid.empty()) {
             const auto ndx = participantIndexBySid(participantSid);
-            if (ndx && addToParticipant(_participants->at(ndx.value()), trackSid, trackManager, receiver)) {
+            if (ndx && addToParticipant(_participants->_list.at(ndx.value()), trackSid, trackManager, receiver)) {
                 return true;
             }
         }
-        else {
-            for (const auto& participant : _participants.constRef()) {
-                if (addToParticipant(participant, trackSid, trackManager, receiver)) {
-                    return true;
-                }
-            }
+        else if (addToParticipant(participantByTrackSid(trackSid), trackSid, trackManager, receiver)) {
+            return true;
         }
         return _nonBindedReceivers->add(std::move(trackSid), receiver);
     }
@@ -164,17 +173,16 @@ bool RemoteParticipants::removeMedia(const webrtc::scoped_refptr<webrtc::RtpRece
         if (!sid.empty()) {
             _nonBindedReceivers->take(sid);
             LOCK_READ_SAFE_OBJ(_participants);
-            const auto type = receiver->media_type();
-            for (const auto& participant : _participants.constRef()) {
-                if (webrtc::MediaType::VIDEO == type) {
-                    if (participant->removeVideo(sid)) {
+            if (const auto participant = participantByTrackSid(sid)) {
+                switch (receiver->media_type()) {
+                    case webrtc::MediaType::VIDEO:
+                        participant->removeVideo(sid);
                         break;
-                    }
-                }
-                else if (webrtc::MediaType::AUDIO == type) {
-                    if (participant->removeAudio(sid)) {
+                    case webrtc::MediaType::AUDIO:
+                        participant->removeAudio(sid);
+                        break;
+                    default:
                         break;
-                    }
                 }
             }
             return true;
@@ -193,14 +201,14 @@ void RemoteParticipants::reset()
 size_t RemoteParticipants::count() const
 {
     LOCK_READ_SAFE_OBJ(_participants);
-    return _participants->size();
+    return _participants->_list.size();
 }
 
 std::shared_ptr<RemoteParticipantImpl> RemoteParticipants::at(size_t index) const
 {
     LOCK_READ_SAFE_OBJ(_participants);
-    if (index < _participants->size()) {
-        return _participants->at(index);
+    if (index < _participants->_list.size()) {
+        return _participants->_list.at(index);
     }
     return {};
 }
@@ -210,7 +218,19 @@ std::shared_ptr<RemoteParticipantImpl> RemoteParticipants::at(const std::string&
     if (!sid.empty()) {
         LOCK_READ_SAFE_OBJ(_participants);
         if (const auto ndx = participantIndexBySid(sid)) {
-            return _participants->at(ndx.value());
+            return _participants->_list.at(ndx.value());
+        }
+    }
+    return {};
+}
+
+std::shared_ptr<RemoteParticipantImpl> RemoteParticipants::byIdentity(const std::string& identity) const
+{
+    if (!identity.empty()) {
+        LOCK_READ_SAFE_OBJ(_participants);
+        const auto it = _participants->_byIdentity.find(identity);
+        if (it != _participants->_byIdentity.end()) {
+            return _participants->_list.at(it->second);
         }
     }
     return {};
@@ -244,23 +264,11 @@ void RemoteParticipants::requestSubscriptionChanges(const RemoteParticipantImpl*
     }
 }
 
-std::vector<ParticipantInfo> RemoteParticipants::infos() const
-{
-    if (const auto s = _participants->size()) {
-        std::vector<ParticipantInfo> output;
-        output.reserve(s);
-        for (const auto& participant : _participants.constRef()) {
-            output.push_back(participant->info());
-        }
-        return output;
-    }
-    return {};
-}
-
 void RemoteParticipants::addParticipant(const std::shared_ptr<RemoteParticipantImpl>& participant)
 {
     if (participant) {
-        _participants->push_back(participant);
+        _participants->_list.push_back(participant);
+        index(participant->info(), _participants->_list.size() - 1U);
         if (_autoSubscribe) {
             participant->addListener(this);
             requestSubscriptionChanges(participant.get(), true);
@@ -274,18 +282,35 @@ void RemoteParticipants::addParticipant(const std::shared_ptr<RemoteParticipantI
 void RemoteParticipants::removeParticipant(const std::string& sid)
 {
     if (!sid.empty()) {
-        std::shared_ptr<RemoteParticipantImpl> participant;
         if (const auto ndx = participantIndexBySid(sid)) {
-            participant = _participants->at(ndx.value());
-            _participants->erase(_participants->begin() + ndx.value());
+            removeParticipantAt(ndx.value());
+        }
+    }
+}
+
+void RemoteParticipants::removeParticipantAt(size_t position)
+{
+    auto& list = _participants->_list;
+    if (position < list.size()) {
+        const auto participant = list.at(position);
+        unindex(participant->info(), position);
+        // last one takes the place of removed, so only its position is changed
+        const auto last = list.size() - 1U;
+        if (position != last) {
+            const auto info = list.at(last)->info();
+            unindex(info, last);
+            list[position] = std::move(list[last]);
+            index(info, position);
         }
+        list.pop_back();
         dispose(participant);
     }
 }
 
 void RemoteParticipants::clearParticipants()
 {
-    for (const auto& participant : _participants.take()) {
+    const auto participants = _participants.take();
+    for (const auto& participant : participants._list) {
         dispose(participant);
     }
 }
@@ -309,17 +334,57 @@ void RemoteParticipants::dispose(const std::shared_ptr<RemoteParticipantImpl>& p
 std::optional<size_t> RemoteParticipants::participantIndexBySid(const std::string& sid) const
 {
     if (!sid.empty()) {
-        if (const auto s = _participants->size()) {
-            for (size_t i = 0U; i < s; ++i) {
-                if (sid == _participants->at(i)->sid()) {
-                    return i;
-                }
-            }
+        const auto it = _participants->_bySid.find(sid);
+        if (it != _participants->_bySid.end()) {
+            return it->second;
         }
     }
     return std::nullopt;
 }
 
+std::shared_ptr<RemoteParticipantImpl> RemoteParticipants::participantByTrackSid(const std::string& trackSid) const
+{
+    if (!trackSid.empty()) {
+        const auto it = _participants->_byTrackSid.find(trackSid);
+        if (it != _participants->_byTrackSid.end()) {
+            return it->second;
+        }
+    }
+    return {};
+}
+
+void RemoteParticipants::index(const ParticipantInfo& info, size_t position)
+{
+    const auto& participant = _participants->_list.at(position);
+    _participants->_bySid[info._sid] = position;
+    if (!info._identity.empty()) {
+        _participants->_byIdentity[info._identity] = position;
+    }
+    for (const auto& track : info._tracks) {
+        _participants->_byTrackSid[track._sid] = participant;
+    }
+}
+
+void RemoteParticipants::unindex(const ParticipantInfo& info, size_t position)
+{
+    // entries re-assigned to another participant are kept
+    const auto unindexPosition = [position](auto& map, const std::string& key) {
+        const auto it = map.find(key);
+        if (it != map.end() && position == it->second) {
+            map.erase(it);
+        }
+    };
+    unindexPosition(_participants->_bySid, info._sid);
+    unindexPosition(_participants->_byIdentity, info._identity);
+    const auto& participant = _participants->_list.at(position);
+    for (const auto& track : info._tracks) {
+        const auto it = _participants->_byTrackSid.find(track._sid);
+        if (it != _participants->_byTrackSid.end() && participant == it->second) {
+            _participants->_byTrackSid.erase(it);
+        }
+    }
+}
+
 void RemoteParticipants::onRemoteTrackAdded(const RemoteParticipant* participant, TrackType,
                                             EncryptionType, const std::string& sid)
 {
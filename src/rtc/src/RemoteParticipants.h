@@ -18,6 +18,7 @@
 #include "livekit/rtc/RemoteParticipantListener.h"
 #include <api/media_types.h>
 #include <api/scoped_refptr.h>
+#include <unordered_map>
 #include <vector>
 
 namespace webrtc {
@@ -38,7 +39,15 @@ enum class TrackType;
 
 class RemoteParticipants : private Bricks::LoggableS<RemoteParticipantListener>
 {
-    using Participants = std::vector<std::shared_ptr<RemoteParticipantImpl>>;
+    struct Participants
+    {
+        std::vector<std::shared_ptr<RemoteParticipantImpl>> _list;
+        // positions in [_list]
+        std::unordered_map<std::string, size_t> _bySid;
+        std::unordered_map<std::string, size_t> _byIdentity;
+        // track SID -> owner
+        std::unordered_map<std::string, std::shared_ptr<RemoteParticipantImpl>> _byTrackSid;
+    };
 public:
     RemoteParticipants(bool autoSubscribe, RemoteParticipantsListener* listener,
                        const std::shared_ptr<Bricks::Logger>& logger = {});
@@ -54,20 +63,23 @@ public:
     size_t count() const;
     std::shared_ptr<RemoteParticipantImpl> at(size_t index) const;
     std::shared_ptr<RemoteParticipantImpl> at(const std::string& sid) const;
+    std::shared_ptr<RemoteParticipantImpl> byIdentity(const std::string& identity) const;
 protected:
     // impl. of Bricks::LoggableS<>
     std::string_view logCategory() const final;
 private:
     void requestSubscriptionChanges(const RemoteParticipantImpl* participant, bool subscribe,
                                     std::vector<std::string> trackSids = {}) const;
-    // non thread-safe to [_participants]
-    std::vector<ParticipantInfo> infos() const;
     // service methods, non thread-safe to [_participants]
     void addParticipant(const std::shared_ptr<RemoteParticipantImpl>& participant);
     void removeParticipant(const std::string& sid);
+    void removeParticipantAt(size_t position);
     void clearParticipants();
     void dispose(const std::shared_ptr<RemoteParticipantImpl>& participant);
     std::optional<size_t> participantIndexBySid(const std::string& sid) const;
+    std::shared_ptr<RemoteParticipantImpl> participantByTrackSid(const std::string& trackSid) const;
+    void index(const ParticipantInfo& info, size_t position);
+    void unindex(const ParticipantInfo& info, size_t position);
     // impl. of RemoteParticipantListener
     void onRemoteTrackAdded(const RemoteParticipant* participant, TrackType,
                             EncryptionType, const std::string& sid) final;
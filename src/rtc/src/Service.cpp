@@ -15,13 +15,17 @@
 #include "AdmProxyListener.h"
 #include "AdmProxyFacade.h"
 #include "AsyncCameraSourceImpl.h"
+#include "AsyncPushAudioSourceImpl.h"
+#include "AsyncPushSourceImpl.h"
 #include "AsyncSharingSourceImpl.h"
+#include "AudioDeviceImpl.h"
 #include "CameraManager.h"
 #include "DefaultKeyProvider.h"
 #include "DesktopConfiguration.h"
 #include "DesktopCapturer.h"
 #include "FieldTrials.h"
 #include "Listeners.h"
+#include "LocalAudioRecorder.h"
 #include "LocalVideoDeviceImpl.h"
 #include "LocalWebRtcTrack.h"
 #include "Loggable.h"
@@ -29,6 +33,8 @@
 #include "MediaAuthorization.h"
 #include "MicAudioDevice.h"
 #include "PeerConnectionFactory.h"
+#include "PushAudioSourceImpl.h"
+#include "PushVideoSourceImpl.h"
 #include "RtcInitializer.h"
 #include "WebsocketEndPoint.h"
 #include "WebsocketFactory.h"
@@ -39,6 +45,7 @@
 #include "livekit/rtc/e2e/KeyProvider.h"
 #include "livekit/rtc/media/AudioRecordingOptions.h"
 #include "livekit/rtc/media/VideoOptions.h"
+#include "livekit/rtc/media/VirtualAudioOptions.h"
 #include "livekit/rtc/media/VideoFrame.h"
 #include "livekit/rtc/ServiceListener.h"
 #ifdef __APPLE__
@@ -74,6 +81,16 @@ public:
     bool is_screencast() const final { return true;}
 };
 
+class AsyncPushSource : public AsyncVideoSource
+{
+public:
+    AsyncPushSource(std::shared_ptr<AsyncPushSourceImpl> impl);
+    // impl. of webrtc::VideoTrackSourceInterface
+    bool is_screencast() const final { return _screencast; }
+private:
+    const bool _screencast;
+};
+
 template <typename TMediaFormat>
 std::vector<std::string> extractCodecNames(std::vector<TMediaFormat>&& formats);
 
@@ -93,6 +110,11 @@ public:
     std::unique_ptr<LocalVideoDevice> createCamera(MediaDeviceInfo info, VideoOptions options) const;
     std::unique_ptr<LocalVideoDevice> createSharing(bool previewMode, MediaDeviceInfo info,
                                                     VideoOptions options) const;
+    std::shared_ptr<PushVideoSource> createPushVideoSource(bool screencast) const;
+    std::unique_ptr<LocalVideoDevice> createPushVideoDevice(const std::shared_ptr<PushVideoSource>& source,
+                                                            MediaDeviceInfo info, VideoOptions options) const;
+    std::shared_ptr<PushAudioSource> createPushAudioSource(const AudioRecordingOptions& options) const;
+    std::unique_ptr<AudioDevice> createPushAudioDevice(const std::shared_ptr<PushAudioSource>& source) const;
     MediaDeviceInfo defaultAudioRecordingDevice() const;
     MediaDeviceInfo defaultAudioPlayoutDevice() const;
     bool setAudioRecordingDevice(const MediaDeviceInfo& info);
@@ -117,6 +139,7 @@ public:
     void enableAudioPlayoutProcessing(bool enable);
     bool audioRecordingProcessingEnabled() const;
     bool audioPlayoutProcessingEnabled() const;
+    float audioRecordingVoiceProbability() const;
     bool startAecDump(FILE* file, int64_t maxSizeBytes);
     void stopAecDump();
     void setRecordingFramesWriter(AudioFramesWriter* writer);
@@ -235,6 +258,40 @@ std::unique_ptr<LocalVideoDevice> Service::createSharing(bool previewMode,
     return {};
 }
 
+std::shared_ptr<PushVideoSource> Service::createPushVideoSource(bool screencast) const
+{
+    if (_impl) {
+        return _impl->createPushVideoSource(screencast);
+    }
+    return {};
+}
+
+std::unique_ptr<LocalVideoDevice> Service::createPushVideoDevice(const std::shared_ptr<PushVideoSource>& source,
+                                                                 MediaDeviceInfo info,
+                                                                 VideoOptions options) const
+{
+    if (_impl && source) {
+        return _impl->createPushVideoDevice(source, std::move(info), std::move(options));
+    }
+    return {};
+}
+
+std::shared_ptr<PushAudioSource> Service::createPushAudioSource(const AudioRecordingOptions& options) const
+{
+    if (_impl) {
+        return _impl->createPushAudioSource(options);
+    }
+    return {};
+}
+
+std::unique_ptr<AudioDevice> Service::createPushAudioDevice(const std::shared_ptr<PushAudioSource>& source) const
+{
+    if (_impl && source) {
+        return _impl->createPushAudioDevice(source);
+    }
+    return {};
+}
+
 MediaDeviceInfo Service::defaultAudioRecordingDevice() const
 {
     if (_impl) {
@@ -445,6 +502,11 @@ bool Service::audioPlayoutProcessingEnabled() const
     return _impl && _impl->audioPlayoutProcessingEnabled();
 }
 
+float Service::audioRecordingVoiceProbability() const
+{
+    return _impl ? _impl->audioRecordingVoiceProbability() : 0.f;
+}
+
 bool Service::startAecDump(FILE* file, int64_t maxSizeBytes)
 {
     return _impl && _impl->startAecDump(file, maxSizeBytes);
@@ -496,7 +558,9 @@ Service::Impl::Impl(const std::shared_ptr<Websocket::Factory>& websocketsFactory
     : Bricks::LoggableS<AdmProxyListener>(initInfo._logger)
     , _websocketsFactory(websocketsFactory)
     , _cameraManager(CameraManager::create())
-    , _pcf(PeerConnectionFactory::create(createTrials(initInfo), initInfo._logWebrtcEvents ? initInfo._logger : nullptr))
+    , _pcf(PeerConnectionFactory::create(createTrials(initInfo),
+                                         initInfo._logWebrtcEvents ? initInfo._logger : nullptr,
+                                         std::move(initInfo._virtualAudio)))
     , _desktopConfiguration(_pcf ? std::make_shared<DesktopConfiguration>(_pcf->eventsQueue()) : std::shared_ptr<DesktopConfiguration>{})
     , _disableAudioRed(initInfo._disableAudioRed.value_or(false))
     , _recordingVolume(_defaultRecording)
@@ -574,6 +638,59 @@ std::unique_ptr<LocalVideoDevice> Service::Impl::createSharing(bool previewMode,
     return {};
 }
 
+std::shared_ptr<PushVideoSource> Service::Impl::createPushVideoSource(bool screencast) const
+{
+    if (_pcf) {
+        auto impl = std::make_shared<AsyncPushSourceImpl>(_pcf->signalingThread(), logger(), screencast);
+        return std::make_shared<PushVideoSourceImpl>(std::move(impl));
+    }
+    return {};
+}
+
+std::unique_ptr<LocalVideoDevice> Service::Impl::
+    createPushVideoDevice(const std::shared_ptr<PushVideoSource>& source,
+                          MediaDeviceInfo info, VideoOptions options) const
+{
+    if (const auto pushSource = std::dynamic_pointer_cast<PushVideoSourceImpl>(source)) {
+        if (auto impl = pushSource->attach()) {
+            auto rtcSource = webrtc::make_ref_counted<AsyncPushSource>(std::move(impl));
+            auto track = webrtc::make_ref_counted<LocalWebRtcTrack>(makeUuid(), std::move(rtcSource));
+            track->setOptions(std::move(options));
+            track->setDeviceInfo(std::move(info));
+            return std::make_unique<LocalVideoDeviceImpl>(std::move(track));
+        }
+        if (canLogError()) {
+            logError("push video source already has a device");
+        }
+    }
+    return {};
+}
+
+std::shared_ptr<PushAudioSource> Service::Impl::createPushAudioSource(const AudioRecordingOptions& options) const
+{
+    if (_pcf) {
+        auto impl = std::make_shared<AsyncPushAudioSourceImpl>(_pcf->signalingThread(), logger(), options);
+        return std::make_shared<PushAudioSourceImpl>(std::move(impl));
+    }
+    return {};
+}
+
+std::unique_ptr<AudioDevice> Service::Impl::
+    createPushAudioDevice(const std::shared_ptr<PushAudioSource>& source) const
+{
+    if (const auto pushSource = std::dynamic_pointer_cast<PushAudioSourceImpl>(source)) {
+        if (auto impl = pushSource->attach()) {
+            if (auto track = LocalAudioRecorder<AsyncPushAudioSourceImpl>::create(std::move(impl))) {
+                return std::make_unique<AudioDeviceImpl>(std::move(track));
+            }
+        }
+        else if (canLogError()) {
+            logError("push audio source already has a device");
+        }
+    }
+    return {};
+}
+
 MediaDeviceInfo Service::Impl::defaultAudioRecordingDevice() const
 {
     if (_pcf) {
@@ -742,6 +859,11 @@ bool Service::Impl::audioPlayoutProcessingEnabled() const
     return _pcf && _pcf->audioPlayoutProcessingEnabled();
 }
 
+float Service::Impl::audioRecordingVoiceProbability() const
+{
+    return _pcf ? _pcf->audioRecordingVoiceProbability() : 0.f;
+}
+
 bool Service::Impl::startAecDump(FILE* file, int64_t maxSizeBytes)
 {
     return _pcf && _pcf->StartAecDump(file, maxSizeBytes);
@@ -1148,6 +1270,8 @@ AudioRecordingOptions::AudioRecordingOptions()
     _highpassFilter = true;
 }
 
+VirtualAudioOptions::VirtualAudioOptions() = default;
+
 } // namespace LiveKitCpp
 
 
@@ -1175,6 +1299,12 @@ AsyncSharingSource::AsyncSharingSource(bool previewMode,
     setContentHint(VideoContentHint::Detailed);
 }
 
+AsyncPushSource::AsyncPushSource(std::shared_ptr<AsyncPushSourceImpl> impl)
+    : AsyncVideoSource(impl)
+    , _screencast(impl && impl->screencast())
+{
+}
+
 inline std::string extractFormatName(webrtc::SdpVideoFormat&& format)
 {
     return std::move(format.name);
@@ -117,6 +117,14 @@ std::shared_ptr<RemoteParticipant> Session::remoteParticipant(const std::string&
     return {};
 }
 
+std::shared_ptr<RemoteParticipant> Session::remoteParticipantByIdentity(const std::string& identity) const
+{
+    if (const auto participant = _impl->_engine.remoteParticipants()) {
+        return participant->byIdentity(identity);
+    }
+    return {};
+}
+
 void Session::setAesCgmKeyProvider(std::unique_ptr<KeyProvider> provider)
 {
     _impl->_engine.setAesCgmKeyProvider(std::move(provider));
@@ -170,6 +178,36 @@ bool Session::sendChatMessage(std::string message, bool deleted, bool generated,
                                           destinationIdentities);
 }
 
+std::string Session::openTextStream(std::string topic,
+                                    const std::vector<std::string>& destinationIdentities,
+                                    const std::optional<uint64_t>& totalLength)
+{
+    return _impl->_engine.openTextStream(std::move(topic), destinationIdentities, totalLength);
+}
+
+std::string Session::openByteStream(std::string topic, std::string name, std::string mimeType,
+                                    const std::vector<std::string>& destinationIdentities,
+                                    const std::optional<uint64_t>& totalLength)
+{
+    return _impl->_engine.openByteStream(std::move(topic), std::move(name), std::move(mimeType),
+                                         destinationIdentities, totalLength);
+}
+
+bool Session::writeStream(const std::string& streamId, std::string data)
+{
+    return _impl->_engine.writeStream(streamId, std::move(data));
+}
+
+bool Session::closeStream(const std::string& streamId, std::string reason)
+{
+    return _impl->_engine.closeStream(streamId, std::move(reason));
+}
+
+uint64_t Session::streamsBufferedAmount() const
+{
+    return _impl->_engine.streamsBufferedAmount();
+}
+
 SessionState Session::state() const
 {
     return _impl->_engine.state();
@@ -245,6 +283,14 @@ void Session::queryStats() const
     _impl->queryStats();
 }
 
+bool Session::queryStats(const std::shared_ptr<StatsListener>& listener) const
+{
+    if (listener) {
+        _impl->_engine.queryStats(webrtc::make_ref_counted<StatsSourceImpl>(listener));
+    }
+    return true;
+}
+
 std::unique_ptr<KeyProvider> Session::createProvider(KeyProviderOptions options) const
 {
     return std::make_unique<DefaultKeyProvider>(std::move(options), _impl->logger());
@@ -0,0 +1,130 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "TrackInfoSeq.h"
+#include "Seq.h"
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+inline std::string_view sidOf(const TrackInfo& info) {
+    return info._sid;
+}
+
+inline bool equal(const VideoLayer& l, const VideoLayer& r) {
+    return l._quality == r._quality && l._width == r._width && l._height == r._height &&
+        l._bitrate == r._bitrate && l._ssrc == r._ssrc;
+}
+
+inline bool equal(const SimulcastCodecInfo& l, const SimulcastCodecInfo& r);
+
+inline bool equal(const std::optional<TimedVersion>& l, const std::optional<TimedVersion>& r) {
+    if (l && r) {
+        return l->_unixMicro == r->_unixMicro && l->_ticks == r->_ticks;
+    }
+    return l.has_value() == r.has_value();
+}
+
+template <typename T>
+inline bool equal(const std::vector<T>& l, const std::vector<T>& r) {
+    if (l.size() == r.size()) {
+        for (size_t i = 0U; i < l.size(); ++i) {
+            if constexpr (std::is_enum_v<T>) {
+                if (l[i] != r[i]) {
+                    return false;
+                }
+            }
+            else if (!equal(l[i], r[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+inline bool equal(const SimulcastCodecInfo& l, const SimulcastCodecInfo& r) {
+    return l._mimeType == r._mimeType && l._mid == r._mid && l._cid == r._cid && equal(l._layers, r._layers);
+}
+
+inline void setIf(bool changed, TrackInfoChange change, uint32_t& changes) {
+    if (changed) {
+        changes |= uint32_t(change);
+    }
+}
+
+}
+
+namespace LiveKitCpp
+{
+
+uint32_t trackInfoChanges(const TrackInfo& from, const TrackInfo& to)
+{
+    uint32_t changes = uint32_t(TrackInfoChange::None);
+    setIf(from._type != to._type, TrackInfoChange::Type, changes);
+    setIf(from._name != to._name, TrackInfoChange::Name, changes);
+    setIf(from._muted != to._muted, TrackInfoChange::Muted, changes);
+    setIf(from._width != to._width || from._height != to._height, TrackInfoChange::Dimensions, changes);
+    setIf(from._simulcast != to._simulcast || !equal(from._layers, to._layers),
+          TrackInfoChange::Simulcast, changes);
+    setIf(from._mimeType != to._mimeType || from._backupCodecPolicy != to._backupCodecPolicy ||
+          !equal(from._codecs, to._codecs), TrackInfoChange::Codecs, changes);
+    setIf(from._source != to._source, TrackInfoChange::Source, changes);
+    setIf(from._encryption != to._encryption, TrackInfoChange::Encryption, changes);
+    setIf(from._disableDtx != to._disableDtx || from._disableRed != to._disableRed ||
+          from._stereo != to._stereo || !equal(from._audioFeatures, to._audioFeatures),
+          TrackInfoChange::Audio, changes);
+    setIf(from._mid != to._mid || from._stream != to._stream, TrackInfoChange::Transport, changes);
+    setIf(!equal(from._version, to._version), TrackInfoChange::Version, changes);
+    return changes;
+}
+
+void findDifference(const std::vector<TrackInfo>& currentTracksInfo,
+                    const std::vector<TrackInfo>& newTracksInfo,
+                    std::vector<TrackInfo>* added,
+                    std::vector<TrackInfo>* removed,
+                    std::vector<TrackInfoUpdate>* updated)
+{
+    using SeqType = Seq<TrackInfo>;
+    if (added) {
+        *added = SeqType::differenceBy<std::vector>(newTracksInfo, currentTracksInfo, sidOf);
+    }
+    if (removed) {
+        *removed = SeqType::differenceBy<std::vector>(currentTracksInfo, newTracksInfo, sidOf);
+    }
+    if (updated) {
+        updated->clear();
+        if (!currentTracksInfo.empty() && !newTracksInfo.empty()) {
+            std::unordered_map<std::string_view, const TrackInfo*> current;
+            current.reserve(currentTracksInfo.size());
+            for (const auto& info : currentTracksInfo) {
+                current.emplace(sidOf(info), &info);
+            }
+            for (const auto& info : newTracksInfo) {
+                const auto it = current.find(sidOf(info));
+                if (it != current.end()) {
+                    if (const auto changes = trackInfoChanges(*it->second, info)) {
+                        updated->push_back({info, changes});
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace LiveKitCpp
@@ -18,10 +18,43 @@
 namespace LiveKitCpp
 {
 
+// groups of track info fields, bit mask
+enum class TrackInfoChange : uint32_t
+{
+    None       = 0U,
+    Type       = 1U << 0U,
+    Name       = 1U << 1U,
+    Muted      = 1U << 2U,
+    Dimensions = 1U << 3U,
+    // simulcast flag or layers
+    Simulcast  = 1U << 4U,
+    // MIME type, simulcast codecs or backup codec policy
+    Codecs     = 1U << 5U,
+    Source     = 1U << 6U,
+    Encryption = 1U << 7U,
+    // DTX, RED, stereo or audio features
+    Audio      = 1U << 8U,
+    // MID or stream
+    Transport  = 1U << 9U,
+    Version    = 1U << 10U,
+};
+
+struct TrackInfoUpdate
+{
+    TrackInfo _info;
+    // mask of [TrackInfoChange]
+    uint32_t _changes = {};
+    bool changed(TrackInfoChange change) const { return 0U != (_changes & uint32_t(change)); }
+};
+
+// mask of [TrackInfoChange]
+uint32_t trackInfoChanges(const TrackInfo& from, const TrackInfo& to);
+
+// tracks are matched by SID, [updated] contains only really changed tracks
 void findDifference(const std::vector<TrackInfo>& currentTracksInfo,
                     const std::vector<TrackInfo>& newTracksInfo,
                     std::vector<TrackInfo>* added = nullptr,
                     std::vector<TrackInfo>* removed = nullptr,
-                    std::vector<TrackInfo>* updated = nullptr);
+                    std::vector<TrackInfoUpdate>* updated = nullptr);
 
 } // namespace LiveKitCpp
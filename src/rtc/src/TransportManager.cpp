@@ -31,11 +31,13 @@ TransportManager::TransportManager(bool subscriberPrimary,
                                    const std::string& identity,
                                    const std::string& prefferedAudioEncoder,
                                    const std::string& prefferedVideoEncoder,
+                                   std::vector<VideoSimulcastLayer> simulcastLayers,
                                    const std::shared_ptr<Bricks::Logger>& logger)
     : RtcObject<TransportManagerImpl>(subscriberPrimary, fastPublish, disableAudioRed,
                                       pingTimeout, pingInterval, negotiationDelay,
                                       std::move(tracksInfo), pcf, conf, trackManager,
-                                      identity, prefferedAudioEncoder, prefferedVideoEncoder, logger)
+                                      identity, prefferedAudioEncoder, prefferedVideoEncoder,
+                                      std::move(simulcastLayers), logger)
 {
 }
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 #pragma once // TransportManager.h
 #include "RtcObject.h"
+#include "livekit/rtc/media/VideoSimulcastLayer.h"
 #include "livekit/signaling/sfu/TrackInfo.h"
 #include <api/peer_connection_interface.h>
 #include <vector>
@@ -51,6 +52,7 @@ public:
                      const std::string& identity,
                      const std::string& prefferedAudioEncoder = {},
                      const std::string& prefferedVideoEncoder = {},
+                     std::vector<VideoSimulcastLayer> simulcastLayers = {},
                      const std::shared_ptr<Bricks::Logger>& logger = {});
     ~TransportManager();
     bool valid() const noexcept;
@@ -64,6 +64,7 @@ TransportManagerImpl::TransportManagerImpl(bool subscriberPrimary,
                                            const std::string& identity,
                                            const std::string& prefferedAudioEncoder,
                                            const std::string& prefferedVideoEncoder,
+                                           std::vector<VideoSimulcastLayer> simulcastLayers,
                                            const std::shared_ptr<Bricks::Logger>& logger)
     : Bricks::LoggableS<TransportListener, PingPongKitListener>(logger)
     , _negotiationTimerId(reinterpret_cast<uint64_t>(this))
@@ -74,6 +75,7 @@ TransportManagerImpl::TransportManagerImpl(bool subscriberPrimary,
     , _disableAudioRed(disableAudioRed)
     , _logCategory("transport_manager_" + identity)
     , _trackManager(trackManager)
+    , _simulcastLayers(std::move(simulcastLayers))
     , _negotiationTimer(pcf)
     , _publisher(SignalTarget::Publisher, this, pcf, conf, identity, prefferedAudioEncoder, prefferedVideoEncoder, logger)
     , _subscriber(SignalTarget::Subscriber, this, pcf, conf, identity, {}, {}, logger)
@@ -176,7 +178,7 @@ void TransportManagerImpl::addTrack(std::shared_ptr<LocalVideoDeviceImpl> device
     if (device) {
         webrtc::RtpTransceiverInit init;
         init.direction = webrtc::RtpTransceiverDirection::kSendOnly;
-        _publisher.addTrack(std::move(device), encryption, init);
+        _publisher.addTrack(std::move(device), encryption, init, _simulcastLayers);
     }
 }
 
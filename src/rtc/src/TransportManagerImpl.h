@@ -19,6 +19,7 @@
 #include "SafeObj.h"
 #include "Transport.h"
 #include "TransportListener.h"
+#include "livekit/rtc/media/VideoSimulcastLayer.h"
 #include "livekit/signaling/sfu/TrackInfo.h"
 #include <api/peer_connection_interface.h>
 #include <vector>
@@ -50,6 +51,7 @@ public:
                          const std::string& identity,
                          const std::string& prefferedAudioEncoder = {},
                          const std::string& prefferedVideoEncoder = {},
+                         std::vector<VideoSimulcastLayer> simulcastLayers = {},
                          const std::shared_ptr<Bricks::Logger>& logger = {});
     ~TransportManagerImpl() final;
     bool valid() const noexcept;
@@ -135,6 +137,8 @@ private:
     const bool _disableAudioRed;
     const std::string _logCategory;
     const std::weak_ptr<TrackManager> _trackManager;
+    // empty if simulcast is disabled
+    const std::vector<VideoSimulcastLayer> _simulcastLayers;
     AsyncListener<TransportManagerListener*> _listener;
     MediaTimer _negotiationTimer;
     Transport _publisher;
@@ -15,6 +15,7 @@
 #include "Logger.h"
 #include "LocalTrackAccessor.h"
 #include "SafeScopedRefPtr.h"
+#include "StatsSourceImpl.h"
 #include "TrackManager.h"
 #include "Utils.h"
 #include "livekit/signaling/sfu/AddTrackRequest.h"
@@ -22,6 +23,7 @@
 #include "livekit/rtc/media/Track.h"
 #include "livekit/rtc/media/MediaEventsListener.h"
 #include "livekit/rtc/media/NetworkPriority.h"
+#include <api/make_ref_counted.h>
 #include <api/rtp_transceiver_interface.h>
 #include <atomic>
 #include <type_traits>
@@ -52,6 +54,7 @@ public:
     bool muted() const override { return TBaseImpl::muted(); }
     // impl. of StatsSource
     void queryStats() const final;
+    bool queryStats(const std::shared_ptr<StatsListener>& listener) const final;
     // impl. of Track
     std::string sid() const final { return _sid(); }
     EncryptionType encryption() const final { return _encryption; }
@@ -179,6 +182,17 @@ inline void LocalTrackImpl<TBaseImpl>::queryStats() const
     }
 }
 
+template <class TBaseImpl>
+inline bool LocalTrackImpl<TBaseImpl>::queryStats(const std::shared_ptr<StatsListener>& listener) const
+{
+    if (listener) {
+        if (const auto m = TBaseImpl::trackManager()) {
+            m->queryStats(sender(), webrtc::make_ref_counted<StatsSourceImpl>(listener));
+        }
+    }
+    return true;
+}
+
 template <class TBaseImpl>
 inline void LocalTrackImpl<TBaseImpl>::setNetworkPriority(NetworkPriority priority)
 {
@@ -15,10 +15,13 @@
 #include "Logger.h"
 #include "TrackManager.h"
 #include "SafeObj.h"
+#include "StatsSourceImpl.h"
+#include "TrackInfoSeq.h"
 #include "Utils.h"
 #include "livekit/rtc/media/MediaEventsListener.h"
 #include "livekit/rtc/media/NetworkPriority.h"
 #include "livekit/signaling/sfu/TrackInfo.h"
+#include <api/make_ref_counted.h>
 #include <api/scoped_refptr.h>
 #include <api/rtp_receiver_interface.h>
 #include <atomic>
@@ -34,10 +37,12 @@ class RemoteTrackImpl : public TBaseImpl, private webrtc::RtpReceiverObserverInt
 {
     static_assert(std::is_base_of_v<Track, TBaseImpl>);
 public:
-    void setInfo(const TrackInfo& info);
+    // [changes] is a mask of [TrackInfoChange] between current and new info
+    void setInfo(const TrackInfo& info, uint32_t changes);
     webrtc::MediaType mediaType() const;
     // impl. of StatsSource
     void queryStats() const final;
+    bool queryStats(const std::shared_ptr<StatsListener>& listener) const final;
     // impl. of Track
     std::string sid() const final;
     EncryptionType encryption() const final;
@@ -79,19 +84,19 @@ inline RemoteTrackImpl<TBaseImpl>::RemoteTrackImpl(const TrackInfo& initialInfo,
 }
 
 template <class TBaseImpl>
-inline void RemoteTrackImpl<TBaseImpl>::setInfo(const TrackInfo& info)
+inline void RemoteTrackImpl<TBaseImpl>::setInfo(const TrackInfo& info, uint32_t changes)
 {
-    bool remoteMuteChanged = false, nameChanged = false;
+    if (uint32_t(TrackInfoChange::None) == changes) {
+        return;
+    }
     {
         LOCK_WRITE_SAFE_OBJ(_info);
-        remoteMuteChanged = _info->_muted != info._muted;
-        nameChanged = _info->_name != info._name;
         _info = info;
     }
-    if (remoteMuteChanged) {
+    if (changes & uint32_t(TrackInfoChange::Muted)) {
         TBaseImpl::notify(&MediaEventsListener::onRemoteSideMuteChanged, id(), info._muted);
     }
-    if (nameChanged) {
+    if (changes & uint32_t(TrackInfoChange::Name)) {
         TBaseImpl::notify(&MediaEventsListener::onNameChanged, id(), info._name);
     }
 }
@@ -113,6 +118,17 @@ inline void RemoteTrackImpl<TBaseImpl>::queryStats() const
     }
 }
 
+template <class TBaseImpl>
+inline bool RemoteTrackImpl<TBaseImpl>::queryStats(const std::shared_ptr<StatsListener>& listener) const
+{
+    if (listener) {
+        if (const auto m = TBaseImpl::trackManager()) {
+            m->queryStats(_receiver, webrtc::make_ref_counted<StatsSourceImpl>(listener));
+        }
+    }
+    return true;
+}
+
 template <class TBaseImpl>
 inline std::string RemoteTrackImpl<TBaseImpl>::sid() const
 {
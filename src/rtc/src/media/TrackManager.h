@@ -13,6 +13,7 @@
 // limitations under the License.
 #pragma once // TrackManager.h
 #include "livekit/signaling/sfu/EncryptionType.h"
+#include "livekit/signaling/sfu/UpdateTrackSettings.h"
 #include <api/scoped_refptr.h>
 #include <api/media_types.h>
 #include <api/frame_transformer_interface.h>
@@ -40,6 +41,9 @@ public:
                                                                                    const std::weak_ptr<AesCgmCryptorObserver>& observer = {}) const = 0;
     virtual void notifyAboutMuteChanges(const std::string& trackSid, bool muted) = 0;
     virtual void notifyAboutSetRtpParametersFailure(const std::string& trackSid, std::string_view details = {}) = 0;
+    // adaptive stream, settings of remote track requested by its sinks
+    virtual void notifyAboutTrackSettings(UpdateTrackSettings settings) = 0;
+    virtual bool adaptiveStream() const = 0;
     virtual std::optional<bool> stereoRecording() const = 0;
     virtual void queryStats(const webrtc::scoped_refptr<webrtc::RtpReceiverInterface>& receiver,
                             const webrtc::scoped_refptr<webrtc::RTCStatsCollectorCallback>& callback) const = 0;
@@ -0,0 +1,63 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AsyncAudioFileWriter.h"
+#include "OggOpusFileEncoder.h"
+#include "livekit/rtc/media/OggOpusFramesWriter.h"
+
+namespace LiveKitCpp
+{
+
+struct OggOpusFramesWriter::Impl
+{
+    AsyncAudioFileWriter _writer;
+    Impl(std::string filename, int bitrate, const AudioFramesFileOptions& options);
+};
+
+OggOpusFramesWriter::OggOpusFramesWriter(std::string filename, int bitrate,
+                                         AudioFramesFileOptions options)
+    : _impl(std::make_unique<Impl>(std::move(filename), bitrate, options))
+{
+}
+
+OggOpusFramesWriter::~OggOpusFramesWriter()
+{
+}
+
+uint64_t OggOpusFramesWriter::overruns() const
+{
+    return _impl->_writer.overruns();
+}
+
+void OggOpusFramesWriter::onStopped()
+{
+    _impl->_writer.close();
+}
+
+void OggOpusFramesWriter::onData(const int16_t* audioData, int bitsPerSample,
+                                 int sampleRate, size_t numberOfChannels,
+                                 size_t numberOfFrames,
+                                 const std::optional<int64_t>& /*absoluteCaptureTimestampMs*/)
+{
+    if (16 == bitsPerSample) {
+        _impl->_writer.write(audioData, sampleRate, numberOfChannels, numberOfFrames);
+    }
+}
+
+OggOpusFramesWriter::Impl::Impl(std::string filename, int bitrate, const AudioFramesFileOptions& options)
+    : _writer(std::move(filename), options,
+              [bitrate]() { return std::make_unique<OggOpusFileEncoder>(bitrate); })
+{
+}
+
+} // namespace LiveKitCpp
@@ -11,23 +11,21 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-#include "SafeObjAliases.h"
+#include "AsyncAudioFileWriter.h"
+#include "WavFileEncoder.h"
 #include "livekit/rtc/media/WavFramesWriter.h"
-#include <common_audio/wav_file.h>
 
 namespace LiveKitCpp
 {
 
 struct WavFramesWriter::Impl
 {
-    const std::string _filename;
-    Bricks::SafeUniquePtr<webrtc::WavWriter> _writer;
-    Impl(std::string filename);
-    ~Impl() { _writer({}); }
+    AsyncAudioFileWriter _writer;
+    Impl(std::string filename, const AudioFramesFileOptions& options);
 };
 
-WavFramesWriter::WavFramesWriter(std::string filename)
-    : _impl(std::make_unique<Impl>(std::move(filename)))
+WavFramesWriter::WavFramesWriter(std::string filename, AudioFramesFileOptions options)
+    : _impl(std::make_unique<Impl>(std::move(filename), options))
 {
 }
 
@@ -35,27 +33,28 @@ WavFramesWriter::~WavFramesWriter()
 {
 }
 
+uint64_t WavFramesWriter::overruns() const
+{
+    return _impl->_writer.overruns();
+}
+
 void WavFramesWriter::onStopped()
 {
-    _impl->_writer({});
+    _impl->_writer.close();
 }
 
-void WavFramesWriter::onData(const int16_t* audioData, int /*bitsPerSample*/,
+void WavFramesWriter::onData(const int16_t* audioData, int bitsPerSample,
                              int sampleRate, size_t numberOfChannels,
                              size_t numberOfFrames,
-                             const std::optional<int64_t>& absoluteCaptureTimestampMs)
-{
-    if (audioData && sampleRate && numberOfChannels && numberOfFrames && !_impl->_filename.empty()) {
-        LOCK_WRITE_SAFE_OBJ(_impl->_writer);
-        if (!_impl->_writer->get()) {
-            _impl->_writer = std::make_unique<webrtc::WavWriter>(_impl->_filename, sampleRate, numberOfChannels);
-        }
-        _impl->_writer->get()->WriteSamples(audioData, numberOfFrames * numberOfChannels);
+                             const std::optional<int64_t>& /*absoluteCaptureTimestampMs*/)
+{
+    if (16 == bitsPerSample) {
+        _impl->_writer.write(audioData, sampleRate, numberOfChannels, numberOfFrames);
     }
 }
 
-WavFramesWriter::Impl::Impl(std::string filename)
-    : _filename(std::move(filename))
+WavFramesWriter::Impl::Impl(std::string filename, const AudioFramesFileOptions& options)
+    : _writer(std::move(filename), options, []() { return std::make_unique<WavFileEncoder>(); })
 {
 }
 
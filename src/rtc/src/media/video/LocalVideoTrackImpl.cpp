@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "LocalVideoTrackImpl.h"
+#include "VideoUtils.h"
+#include <algorithm>
 
 namespace {
 
@@ -28,6 +30,13 @@ inline std::optional<std::string> scalabilityModeToString(LiveKitCpp::VideoScala
     return std::nullopt;
 }
 
+// presets of simulcast layers are kept if no explicit value was set by user
+template <typename T>
+inline bool keepSimulcastPreset(const std::optional<T>& value,
+                                const webrtc::RtpEncodingParameters& encoding) {
+    return !value.has_value() && !encoding.rid.empty();
+}
+
 }
 
 namespace LiveKitCpp
@@ -54,6 +63,23 @@ bool LocalVideoTrackImpl::fillRequest(AddTrackRequest* request) const
     if (Base::fillRequest(request)) {
         request->_type = type();
         request->_source = source();
+        const auto options = this->options();
+        if (options._width > 0 && options._height > 0) {
+            request->_width = uint32_t(options._width);
+            request->_height = uint32_t(options._height);
+            // advertise simulcast layers, encodings are defined before adding of transceiver
+            for (const auto& encoding : rtpParameters().encodings) {
+                if (const auto quality = simulcastQuality(encoding.rid)) {
+                    const auto scale = std::max(1., encoding.scale_resolution_down_by.value_or(1.));
+                    VideoLayer layer;
+                    layer._quality = quality.value();
+                    layer._width = uint32_t(request->_width / scale);
+                    layer._height = uint32_t(request->_height / scale);
+                    layer._bitrate = uint32_t(encoding.max_bitrate_bps.value_or(0));
+                    request->_layers.push_back(std::move(layer));
+                }
+            }
+        }
         return true;
     }
     return false;
@@ -98,12 +124,9 @@ void LocalVideoTrackImpl::setFilter(LocalVideoFilterPin* inputPin)
 
 void LocalVideoTrackImpl::setDegradationPreference(DegradationPreference preference)
 {
-    if (exchangeVal(preference, _degradationPreference)) {
-        auto parameters = rtpParameters();
-        if (setDegradationPreference(preference, parameters)) {
-            setRtpParameters(parameters);
-        }
-    }
+    VideoSenderUpdate update;
+    update._degradationPreference = preference;
+    updateSender(update);
 }
 
 std::optional<int> LocalVideoTrackImpl::maxBitrateBps() const
@@ -113,13 +136,9 @@ std::optional<int> LocalVideoTrackImpl::maxBitrateBps() const
 
 void LocalVideoTrackImpl::setMaxBitrateBps(const std::optional<int>& bps)
 {
-    const auto v = value(bps);
-    if (exchangeVal(v, _maxBitrateBps)) {
-        auto parameters = rtpParameters();
-        if (setMaxBitrateBps(optionalValue(v), parameters)) {
-            setRtpParameters(parameters);
-        }
-    }
+    VideoSenderUpdate update;
+    update._maxBitrateBps = bps.value_or(-1);
+    updateSender(update);
 }
 
 std::optional<int> LocalVideoTrackImpl::minBitrateBps() const
@@ -129,13 +148,9 @@ std::optional<int> LocalVideoTrackImpl::minBitrateBps() const
 
 void LocalVideoTrackImpl::setMinBitrateBps(const std::optional<int>& bps)
 {
-    const auto v = value(bps);
-    if (exchangeVal(v, _minBitrateBps)) {
-        auto parameters = rtpParameters();
-        if (setMinBitrateBps(optionalValue(v), parameters)) {
-            setRtpParameters(parameters);
-        }
-    }
+    VideoSenderUpdate update;
+    update._minBitrateBps = bps.value_or(-1);
+    updateSender(update);
 }
 
 std::optional<int> LocalVideoTrackImpl::maxFramerate() const
@@ -145,13 +160,9 @@ std::optional<int> LocalVideoTrackImpl::maxFramerate() const
 
 void LocalVideoTrackImpl::setMaxFramerate(const std::optional<int>& fps)
 {
-    const auto v = value(fps);
-    if (exchangeVal(v, _maxFramerate)) {
-        auto parameters = rtpParameters();
-        if (setMaxFramerate(optionalValue(v), parameters)) {
-            setRtpParameters(parameters);
-        }
-    }
+    VideoSenderUpdate update;
+    update._maxFramerate = fps.value_or(-1);
+    updateSender(update);
 }
 
 VideoScalabilityMode LocalVideoTrackImpl::scalabilityMode() const
@@ -161,12 +172,55 @@ VideoScalabilityMode LocalVideoTrackImpl::scalabilityMode() const
 
 void LocalVideoTrackImpl::setScalabilityMode(VideoScalabilityMode mode)
 {
-    if (exchangeVal(mode, _scalabilityMode)) {
+    VideoSenderUpdate update;
+    update._scalabilityMode = mode;
+    updateSender(update);
+}
+
+bool LocalVideoTrackImpl::updateSender(const VideoSenderUpdate& update)
+{
+    // remember new values first, sender parameters are requested only if something changed
+    bool degradationPreference = false, maxBitrate = false, minBitrate = false;
+    bool maxFramerate = false, scalabilityMode = false;
+    if (update._degradationPreference) {
+        degradationPreference = exchangeVal(update._degradationPreference.value(), _degradationPreference);
+    }
+    if (update._maxBitrateBps) {
+        maxBitrate = exchangeVal(value(update._maxBitrateBps), _maxBitrateBps);
+    }
+    if (update._minBitrateBps) {
+        minBitrate = exchangeVal(value(update._minBitrateBps), _minBitrateBps);
+    }
+    if (update._maxFramerate) {
+        maxFramerate = exchangeVal(value(update._maxFramerate), _maxFramerate);
+    }
+    if (update._scalabilityMode) {
+        scalabilityMode = exchangeVal(update._scalabilityMode.value(), _scalabilityMode);
+    }
+    if (degradationPreference || maxBitrate || minBitrate || maxFramerate || scalabilityMode) {
         auto parameters = rtpParameters();
-        if (setScalabilityMode(mode, parameters)) {
+        bool changed = false;
+        if (degradationPreference && setDegradationPreference(this->degradationPreference(), parameters)) {
+            changed = true;
+        }
+        if (maxBitrate && setMaxBitrateBps(maxBitrateBps(), parameters)) {
+            changed = true;
+        }
+        if (minBitrate && setMinBitrateBps(minBitrateBps(), parameters)) {
+            changed = true;
+        }
+        if (maxFramerate && setMaxFramerate(this->maxFramerate(), parameters)) {
+            changed = true;
+        }
+        if (scalabilityMode && setScalabilityMode(this->scalabilityMode(), parameters)) {
+            changed = true;
+        }
+        if (changed) {
             setRtpParameters(parameters);
+            return true;
         }
     }
+    return false;
 }
 
 bool LocalVideoTrackImpl::updateSenderInitialParameters(webrtc::RtpParameters& parameters) const
@@ -202,7 +256,7 @@ bool LocalVideoTrackImpl::setMaxBitrateBps(const std::optional<int>& bps,
     bool changed = false;
     if (!parameters.encodings.empty()) {
         for (auto& encoding : parameters.encodings) {
-            if (setMaxBitrateBps(bps, encoding)) {
+            if (!keepSimulcastPreset(bps, encoding) && setMaxBitrateBps(bps, encoding)) {
                 changed = true;
             }
         }
@@ -226,7 +280,7 @@ bool LocalVideoTrackImpl::setMinBitrateBps(const std::optional<int>& bps,
     bool changed = false;
     if (!parameters.encodings.empty()) {
         for (auto& encoding : parameters.encodings) {
-            if (setMinBitrateBps(bps, encoding)) {
+            if (!keepSimulcastPreset(bps, encoding) && setMinBitrateBps(bps, encoding)) {
                 changed = true;
             }
         }
@@ -250,7 +304,7 @@ bool LocalVideoTrackImpl::setMaxFramerate(const std::optional<int>& fps,
     bool changed = false;
     if (!parameters.encodings.empty()) {
         for (auto& encoding : parameters.encodings) {
-            if (setMaxFramerate(fps, encoding)) {
+            if (!keepSimulcastPreset(fps, encoding) && setMaxFramerate(fps, encoding)) {
                 changed = true;
             }
         }
@@ -48,6 +48,7 @@ public:
     void setMaxFramerate(const std::optional<int>& fps) final;
     VideoScalabilityMode scalabilityMode() const final;
     void setScalabilityMode(VideoScalabilityMode mode) final;
+    bool updateSender(const VideoSenderUpdate& update) final;
 protected:
     // overrides of VideoTrackImpl<>
     bool updateSenderInitialParameters(webrtc::RtpParameters& parameters) const final;
@@ -13,6 +13,20 @@
 // limitations under the License.
 #include "RemoteVideoTrackImpl.h"
 #include "VideoUtils.h"
+#include "livekit/rtc/media/VideoSink.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+
+inline bool sameSettings(const LiveKitCpp::UpdateTrackSettings& l,
+                         const LiveKitCpp::UpdateTrackSettings& r) {
+    return l._disabled == r._disabled && l._quality == r._quality &&
+        l._width == r._width && l._height == r._height;
+}
+
+}
 
 namespace LiveKitCpp
 {
@@ -35,4 +49,98 @@ RemoteVideoTrackImpl::RemoteVideoTrackImpl(const TrackInfo& info,
     }
 }
 
+void RemoteVideoTrackImpl::updateSinksView()
+{
+    const auto m = trackManager();
+    if (m && m->adaptiveStream()) {
+        std::optional<UpdateTrackSettings> changed;
+        {
+            LOCK_WRITE_SAFE_OBJ(_sinks);
+            auto settings = makeSettings(_sinks.constRef());
+            if (!_settings || !sameSettings(_settings.value(), settings)) {
+                _settings = settings;
+                changed = std::move(settings);
+            }
+        }
+        if (changed) {
+            changed->_trackSids.push_back(sid());
+            m->notifyAboutTrackSettings(std::move(changed.value()));
+        }
+    }
+}
+
+void RemoteVideoTrackImpl::addSink(VideoSink* sink)
+{
+    if (sink) {
+        Base::addSink(sink);
+        {
+            LOCK_WRITE_SAFE_OBJ(_sinks);
+            if (_sinks->end() != std::find(_sinks->begin(), _sinks->end(), sink)) {
+                return;
+            }
+            _sinks->push_back(sink);
+        }
+        updateSinksView();
+    }
+}
+
+void RemoteVideoTrackImpl::removeSink(VideoSink* sink)
+{
+    if (sink) {
+        Base::removeSink(sink);
+        {
+            LOCK_WRITE_SAFE_OBJ(_sinks);
+            const auto it = std::find(_sinks->begin(), _sinks->end(), sink);
+            if (it == _sinks->end()) {
+                return;
+            }
+            _sinks->erase(it);
+        }
+        updateSinksView();
+    }
+}
+
+UpdateTrackSettings RemoteVideoTrackImpl::makeSettings(const std::vector<VideoSink*>& sinks) const
+{
+    bool visible = false, fullSize = false;
+    uint32_t width = 0U, height = 0U;
+    for (const auto sink : sinks) {
+        if (sink->viewVisible()) {
+            visible = true;
+            const auto w = sink->viewWidth(), h = sink->viewHeight();
+            if (0U == w || 0U == h) {
+                fullSize = true;
+            }
+            else {
+                width = std::max(width, w);
+                height = std::max(height, h);
+            }
+        }
+    }
+    UpdateTrackSettings settings;
+    settings._disabled = !visible;
+    settings._quality = VideoQuality::High;
+    if (visible) {
+        const auto info = this->info()();
+        if (fullSize) {
+            width = info._width;
+            height = info._height;
+        }
+        settings._width = width;
+        settings._height = height;
+        // the smallest layer covering the requested size
+        uint64_t bestArea = std::numeric_limits<uint64_t>::max();
+        for (const auto& layer : info._layers) {
+            if (layer._width >= width && layer._height >= height) {
+                const auto area = uint64_t(layer._width) * layer._height;
+                if (area < bestArea) {
+                    bestArea = area;
+                    settings._quality = layer._quality;
+                }
+            }
+        }
+    }
+    return settings;
+}
+
 } // namespace LiveKitCpp
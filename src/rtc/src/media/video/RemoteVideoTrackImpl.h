@@ -15,6 +15,9 @@
 #include "RemoteTrackImpl.h"
 #include "VideoTrackImpl.h"
 #include "livekit/rtc/media/RemoteVideoTrack.h"
+#include "livekit/signaling/sfu/UpdateTrackSettings.h"
+#include <optional>
+#include <vector>
 
 namespace LiveKitCpp
 {
@@ -32,6 +35,17 @@ public:
     uint32_t originalHeight() const final { return info()()._height; }
     std::vector<VideoLayer> layers() const final { return info()()._layers; }
     std::vector<SimulcastCodecInfo> codecs() const final { return info()()._codecs; }
+    void updateSinksView() final;
+    // impl. of VideoTrack
+    void addSink(VideoSink* sink) final;
+    void removeSink(VideoSink* sink) final;
+private:
+    // largest view size of visible sinks, non-visible sinks are ignored
+    UpdateTrackSettings makeSettings(const std::vector<VideoSink*>& sinks) const;
+private:
+    Bricks::SafeObj<std::vector<VideoSink*>> _sinks;
+    // last settings sent to track manager, guarded by [_sinks] lock
+    std::optional<UpdateTrackSettings> _settings;
 };
 
 } // namespace LiveKitCpp
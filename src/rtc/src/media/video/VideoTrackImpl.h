@@ -29,8 +29,8 @@ class VideoTrackImpl : public TrackImpl<TMediaDevice, TTrackApi>
 public:
     ~VideoTrackImpl() override = default;
     // impl. of VideoTrack
-    void addSink(VideoSink* sink) final;
-    void removeSink(VideoSink* sink) final;
+    void addSink(VideoSink* sink) override;
+    void removeSink(VideoSink* sink) override;
     void setContentHint(VideoContentHint hint) final;
     VideoContentHint contentHint() const final;
 protected:
@@ -0,0 +1,121 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // Metric.h
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace LiveKitCpp
+{
+
+// switch of counters & histograms, see MetricsRegistry::setEnabled
+inline std::atomic_bool g_metricsEnabled = false;
+
+inline bool metricsEnabled() noexcept { return g_metricsEnabled.load(std::memory_order_relaxed); }
+
+// all metrics are lock-free and padded to the cache line,
+// so updates from different hot paths don't contend with each other
+
+// monotonic counter, no-op while metrics are disabled
+class alignas(64) MetricCounter
+{
+public:
+    void add(uint64_t value = 1ULL) noexcept;
+    uint64_t value() const noexcept { return _value.load(std::memory_order_relaxed); }
+private:
+    std::atomic<uint64_t> _value = 0ULL;
+};
+
+// current level, updated always for keeping increments & decrements balanced
+class alignas(64) MetricGauge
+{
+public:
+    void add(int64_t value) noexcept { _value.fetch_add(value, std::memory_order_relaxed); }
+    void sub(int64_t value) noexcept { _value.fetch_sub(value, std::memory_order_relaxed); }
+    int64_t value() const noexcept { return _value.load(std::memory_order_relaxed); }
+private:
+    std::atomic<int64_t> _value = 0LL;
+};
+
+// distribution of durations, fixed buckets from 10 us to 100 ms, no-op while metrics are disabled
+class alignas(64) MetricHistogram
+{
+public:
+    static constexpr std::array<uint64_t, 13U> _boundsUs = {10U, 25U, 50U, 100U, 250U, 500U,
+                                                            1000U, 2500U, 5000U, 10000U,
+                                                            25000U, 50000U, 100000U};
+public:
+    void observe(std::chrono::microseconds duration) noexcept;
+    // non-cumulative, the last bucket is +Inf
+    uint64_t bucket(size_t index) const noexcept { return _buckets[index].load(std::memory_order_relaxed); }
+    uint64_t sumUs() const noexcept { return _sumUs.load(std::memory_order_relaxed); }
+    uint64_t count() const noexcept { return _count.load(std::memory_order_relaxed); }
+private:
+    std::array<std::atomic<uint64_t>, _boundsUs.size() + 1U> _buckets = {};
+    std::atomic<uint64_t> _sumUs = 0ULL;
+    std::atomic<uint64_t> _count = 0ULL;
+};
+
+// measures lifetime of the scope, clock is not touched while metrics are disabled
+class MetricTimer
+{
+    using Clock = std::chrono::steady_clock;
+public:
+    MetricTimer(MetricHistogram& histogram) noexcept;
+    ~MetricTimer();
+private:
+    MetricHistogram& _histogram;
+    const bool _enabled;
+    const Clock::time_point _start;
+};
+
+inline void MetricCounter::add(uint64_t value) noexcept
+{
+    if (metricsEnabled()) {
+        _value.fetch_add(value, std::memory_order_relaxed);
+    }
+}
+
+inline void MetricHistogram::observe(std::chrono::microseconds duration) noexcept
+{
+    if (metricsEnabled()) {
+        const auto us = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+        size_t index = 0U;
+        while (index < _boundsUs.size() && us > _boundsUs[index]) {
+            ++index;
+        }
+        _buckets[index].fetch_add(1ULL, std::memory_order_relaxed);
+        _sumUs.fetch_add(us, std::memory_order_relaxed);
+        _count.fetch_add(1ULL, std::memory_order_relaxed);
+    }
+}
+
+inline MetricTimer::MetricTimer(MetricHistogram& histogram) noexcept
+    : _histogram(histogram)
+    , _enabled(metricsEnabled())
+    , _start(_enabled ? Clock::now() : Clock::time_point{})
+{
+}
+
+inline MetricTimer::~MetricTimer()
+{
+    if (_enabled) {
+        const auto elapsed = Clock::now() - _start;
+        _histogram.observe(std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
+    }
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,72 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // MetricLatency.h
+#include "Metric.h"
+#include <mutex>
+
+namespace LiveKitCpp
+{
+
+// latency of asynchronous processing, input & output are matched by 32-bit key (RTP timestamp),
+// the last [_capacity] inputs are remembered, outputs without known input are ignored;
+// unlike other metrics it is guarded by mutex, which is not touched while metrics are disabled
+class MetricLatency
+{
+    using Clock = std::chrono::steady_clock;
+    struct Input
+    {
+        uint32_t _key = 0U;
+        Clock::time_point _time;
+    };
+public:
+    static constexpr size_t _capacity = 32U;
+public:
+    MetricLatency(MetricHistogram& histogram) noexcept : _histogram(histogram) {}
+    void input(uint32_t key);
+    void output(uint32_t key);
+private:
+    MetricHistogram& _histogram;
+    std::mutex _mutex;
+    std::array<Input, _capacity> _inputs;
+    size_t _next = 0U;
+};
+
+inline void MetricLatency::input(uint32_t key)
+{
+    if (metricsEnabled()) {
+        const auto now = Clock::now();
+        const std::lock_guard guard(_mutex);
+        _inputs[_next] = {key, now};
+        _next = (_next + 1U) % _capacity;
+    }
+}
+
+inline void MetricLatency::output(uint32_t key)
+{
+    if (metricsEnabled()) {
+        const auto now = Clock::now();
+        const std::lock_guard guard(_mutex);
+        // several outputs of one input (spatial layers) are counted once
+        for (auto& input : _inputs) {
+            if (key == input._key && Clock::time_point{} != input._time) {
+                const auto elapsed = now - input._time;
+                input._time = {};
+                _histogram.observe(std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
+                break;
+            }
+        }
+    }
+}
+
+} // namespace LiveKitCpp
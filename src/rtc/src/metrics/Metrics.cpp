@@ -0,0 +1,148 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "Metrics.h"
+#include <cstdio>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+void renderHeader(std::string_view name, std::string_view type,
+                  std::string_view help, std::string& output);
+void renderCounter(std::string_view name, std::string_view help,
+                   const MetricCounter& counter, std::string& output);
+void renderGauge(std::string_view name, std::string_view help,
+                 const MetricGauge& gauge, std::string& output);
+void renderHistogram(std::string_view name, std::string_view help,
+                     const MetricHistogram& histogram, std::string& output);
+std::string seconds(uint64_t us);
+
+}
+
+namespace LiveKitCpp
+{
+
+Metrics& Metrics::instance()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+void Metrics::render(std::string& output) const
+{
+    renderCounter("livekit_video_frame_pool_hits", "Video buffer requests served from the pool",
+                  _framePoolHits, output);
+    renderCounter("livekit_video_frame_pool_misses", "Video buffer requests which required allocation",
+                  _framePoolMisses, output);
+    renderCounter("livekit_video_frame_pool_evictions", "Idle video buffers released for staying in limits",
+                  _framePoolEvictions, output);
+    renderGauge("livekit_video_frame_pool_buffers", "Video buffers owned by pools",
+                _framePoolBuffers, output);
+    renderGauge("livekit_video_frame_pool_bytes", "Memory of video buffers owned by pools",
+                _framePoolBytes, output);
+    renderHistogram("livekit_e2ee_encrypt_seconds", "Time of media frame encryption",
+                    _e2eeEncryptTime, output);
+    renderHistogram("livekit_e2ee_decrypt_seconds", "Time of media frame decryption",
+                    _e2eeDecryptTime, output);
+    renderCounter("livekit_e2ee_encrypt_failures", "Media frames failed to encrypt",
+                  _e2eeEncryptFailures, output);
+    renderCounter("livekit_e2ee_decrypt_failures", "Media frames failed to decrypt",
+                  _e2eeDecryptFailures, output);
+    renderCounter("livekit_e2ee_ratchet_pending_drops", "Media frames dropped while ratcheted keys were derived",
+                  _e2eeRatchetPendingDrops, output);
+    renderHistogram("livekit_video_encode_seconds", "Time from input of video frame to encoder till encoded image",
+                    _videoEncodeTime, output);
+    renderHistogram("livekit_video_decode_seconds", "Time from input of encoded image to decoder till decoded frame",
+                    _videoDecodeTime, output);
+    renderCounter("livekit_audio_sink_overruns", "Microphone frames dropped because buffered local sinks were too slow",
+                  _audioSinkOverruns, output);
+    renderCounter("livekit_data_packets_sent", "Data packets sent via data channels",
+                  _dataPacketsSent, output);
+    renderCounter("livekit_data_packets_received", "Data packets received via data channels",
+                  _dataPacketsReceived, output);
+    renderCounter("livekit_data_received_bytes", "Data received via data channels",
+                  _dataBytesReceived, output);
+    renderCounter("livekit_data_send_errors", "Data channels send errors",
+                  _dataSendErrors, output);
+    renderGauge("livekit_data_streams_pending_bytes", "Data streams chunks waiting for room in data channels",
+                _dataStreamsPendingBytes, output);
+    renderGauge("livekit_data_channels_buffered_bytes", "Data queued in data channels but not yet sent",
+                _dataChannelsBufferedBytes, output);
+    renderCounter("livekit_session_connects", "Session connection requests",
+                  _sessionConnects, output);
+    renderCounter("livekit_session_reconnect_attempts", "Session reconnection attempts",
+                  _sessionReconnectAttempts, output);
+    renderCounter("livekit_session_reconnect_failures", "Sessions exhausted all reconnection attempts",
+                  _sessionReconnectFailures, output);
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+void renderHeader(std::string_view name, std::string_view type,
+                  std::string_view help, std::string& output)
+{
+    output.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+    output.append("# HELP ").append(name).append(" ").append(help).append(".\n");
+}
+
+void renderCounter(std::string_view name, std::string_view help,
+                   const MetricCounter& counter, std::string& output)
+{
+    renderHeader(name, "counter", help, output);
+    output.append(name).append("_total ").append(std::to_string(counter.value())).append("\n");
+}
+
+void renderGauge(std::string_view name, std::string_view help,
+                 const MetricGauge& gauge, std::string& output)
+{
+    renderHeader(name, "gauge", help, output);
+    output.append(name).append(" ").append(std::to_string(gauge.value())).append("\n");
+}
+
+void renderHistogram(std::string_view name, std::string_view help,
+                     const MetricHistogram& histogram, std::string& output)
+{
+    renderHeader(name, "histogram", help, output);
+    // buckets are cumulative in exposition, count is derived from them
+    // for consistency with concurrent updates
+    uint64_t count = 0ULL;
+    for (size_t i = 0U; i <= MetricHistogram::_boundsUs.size(); ++i) {
+        count += histogram.bucket(i);
+        output.append(name).append("_bucket{le=\"");
+        if (i < MetricHistogram::_boundsUs.size()) {
+            output.append(seconds(MetricHistogram::_boundsUs[i]));
+        }
+        else {
+            output.append("+Inf");
+        }
+        output.append("\"} ").append(std::to_string(count)).append("\n");
+    }
+    output.append(name).append("_sum ").append(seconds(histogram.sumUs())).append("\n");
+    output.append(name).append("_count ").append(std::to_string(count)).append("\n");
+}
+
+std::string seconds(uint64_t us)
+{
+    char buffer[32];
+    const auto len = std::snprintf(buffer, sizeof(buffer), "%llu.%06llu",
+                                   static_cast<unsigned long long>(us / 1000000ULL),
+                                   static_cast<unsigned long long>(us % 1000000ULL));
+    return std::string(buffer, len > 0 ? static_cast<size_t>(len) : 0U);
+}
+
+}
@@ -0,0 +1,57 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // Metrics.h
+#include "Metric.h"
+#include <string>
+
+namespace LiveKitCpp
+{
+
+// process-wide set of SDK metrics, updated directly from hot paths
+struct Metrics
+{
+    static Metrics& instance();
+    // OpenMetrics text format, without of terminating '# EOF'
+    void render(std::string& output) const;
+    // video frame buffers pools
+    MetricCounter _framePoolHits;
+    MetricCounter _framePoolMisses;
+    MetricCounter _framePoolEvictions;
+    MetricGauge _framePoolBuffers;
+    MetricGauge _framePoolBytes;
+    // E2EE frames cryptors
+    MetricHistogram _e2eeEncryptTime;
+    MetricHistogram _e2eeDecryptTime;
+    MetricCounter _e2eeEncryptFailures;
+    MetricCounter _e2eeDecryptFailures;
+    MetricCounter _e2eeRatchetPendingDrops;
+    // video codecs, from input of frame to output of the result
+    MetricHistogram _videoEncodeTime;
+    MetricHistogram _videoDecodeTime;
+    // local audio sinks served on own threads
+    MetricCounter _audioSinkOverruns;
+    // data channels
+    MetricCounter _dataPacketsSent;
+    MetricCounter _dataPacketsReceived;
+    MetricCounter _dataBytesReceived;
+    MetricCounter _dataSendErrors;
+    MetricGauge _dataStreamsPendingBytes;
+    MetricGauge _dataChannelsBufferedBytes;
+    // sessions
+    MetricCounter _sessionConnects;
+    MetricCounter _sessionReconnectAttempts;
+    MetricCounter _sessionReconnectFailures;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,325 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/metrics/MetricsEndpoint.h"
+#include "livekit/rtc/metrics/MetricsRegistry.h"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+#ifdef _WIN32
+using Socket = SOCKET;
+const Socket g_invalidSocket = INVALID_SOCKET;
+#else
+using Socket = int;
+const Socket g_invalidSocket = -1;
+#endif
+
+// limit of request line & headers, the rest is ignored
+constexpr size_t g_maxRequestSize = 8192U;
+// period of checking for stop request
+constexpr int g_pollIntervalMs = 200;
+
+void closeSocket(Socket socket);
+// broken connection must not raise SIGPIPE
+void disableSigPipe(Socket socket);
+int sendFlags();
+// limits blocking of both receive & send calls
+void setTimeouts(Socket socket, long ms);
+// blocks until [socket] is readable or timeout
+bool waitReadable(Socket socket, int ms);
+bool sendAll(Socket socket, const std::string& data);
+std::string readRequestHead(Socket socket);
+std::string response(int code, std::string_view status,
+                     std::string_view contentType = {},
+                     const std::string& body = {});
+
+}
+
+namespace LiveKitCpp
+{
+
+class MetricsEndpoint::Impl
+{
+public:
+    Impl(MetricsEndpointOptions options);
+    ~Impl();
+    bool start();
+    void stop();
+    bool started() const { return _port.load() > 0U; }
+    uint16_t port() const { return _port; }
+private:
+    void run(Socket listener);
+    void serve(Socket client) const;
+private:
+    const MetricsEndpointOptions _options;
+    std::mutex _mutex;
+    std::thread _thread;
+    std::atomic_bool _stopRequested = false;
+    std::atomic<uint16_t> _port = 0U;
+    // state of MetricsRegistry before start
+    bool _registryWasEnabled = false;
+};
+
+MetricsEndpoint::MetricsEndpoint(MetricsEndpointOptions options)
+    : _impl(std::make_unique<Impl>(std::move(options)))
+{
+}
+
+MetricsEndpoint::~MetricsEndpoint()
+{
+}
+
+bool MetricsEndpoint::start()
+{
+    return _impl->start();
+}
+
+void MetricsEndpoint::stop()
+{
+    _impl->stop();
+}
+
+bool MetricsEndpoint::started() const
+{
+    return _impl->started();
+}
+
+uint16_t MetricsEndpoint::port() const
+{
+    return _impl->port();
+}
+
+MetricsEndpoint::Impl::Impl(MetricsEndpointOptions options)
+    : _options(std::move(options))
+{
+#ifdef _WIN32
+    WSADATA data;
+    ::WSAStartup(MAKEWORD(2, 2), &data);
+#endif
+}
+
+MetricsEndpoint::Impl::~Impl()
+{
+    stop();
+#ifdef _WIN32
+    ::WSACleanup();
+#endif
+}
+
+bool MetricsEndpoint::Impl::start()
+{
+    const std::lock_guard guard(_mutex);
+    if (_thread.joinable()) {
+        return true;
+    }
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(_options._port);
+    if (1 != ::inet_pton(AF_INET, _options._address.c_str(), &address.sin_addr)) {
+        return false;
+    }
+    const auto listener = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (g_invalidSocket == listener) {
+        return false;
+    }
+    int reuse = 1;
+    ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR,
+                 reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+    socklen_t length = sizeof(address);
+    if (0 != ::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) ||
+        0 != ::listen(listener, 8) ||
+        0 != ::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length)) {
+        closeSocket(listener);
+        return false;
+    }
+    _registryWasEnabled = MetricsRegistry::enabled();
+    MetricsRegistry::setEnabled(true);
+    _stopRequested = false;
+    _port = ntohs(address.sin_port);
+    _thread = std::thread(&Impl::run, this, listener);
+    return true;
+}
+
+void MetricsEndpoint::Impl::stop()
+{
+    const std::lock_guard guard(_mutex);
+    if (_thread.joinable()) {
+        _stopRequested = true;
+        _thread.join();
+        _port = 0U;
+        MetricsRegistry::setEnabled(_registryWasEnabled);
+    }
+}
+
+void MetricsEndpoint::Impl::run(Socket listener)
+{
+    while (!_stopRequested) {
+        if (waitReadable(listener, g_pollIntervalMs)) {
+            const auto client = ::accept(listener, nullptr, nullptr);
+            if (g_invalidSocket != client) {
+                disableSigPipe(client);
+                serve(client);
+                closeSocket(client);
+            }
+        }
+    }
+    closeSocket(listener);
+}
+
+void MetricsEndpoint::Impl::serve(Socket client) const
+{
+    // slow or silent clients must not block the listener for long
+    setTimeouts(client, 2000);
+    const auto head = readRequestHead(client);
+    const auto lineEnd = head.find("\r\n");
+    const auto methodEnd = head.find(' ');
+    if (std::string::npos == lineEnd || std::string::npos == methodEnd || methodEnd > lineEnd) {
+        sendAll(client, response(400, "Bad Request"));
+        return;
+    }
+    const auto method = std::string_view(head).substr(0U, methodEnd);
+    auto target = std::string_view(head).substr(methodEnd + 1U, lineEnd - methodEnd - 1U);
+    target = target.substr(0U, target.find(' '));
+    target = target.substr(0U, target.find('?'));
+    if (target != _options._path) {
+        sendAll(client, response(404, "Not Found"));
+    }
+    else if (method != "GET") {
+        sendAll(client, response(405, "Method Not Allowed"));
+    }
+    else {
+        sendAll(client, response(200, "OK",
+                                 "application/openmetrics-text; version=1.0.0; charset=utf-8",
+                                 MetricsRegistry::exposition()));
+    }
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+void closeSocket(Socket socket)
+{
+#ifdef _WIN32
+    ::closesocket(socket);
+#else
+    ::close(socket);
+#endif
+}
+
+void disableSigPipe([[maybe_unused]] Socket socket)
+{
+#ifdef SO_NOSIGPIPE
+    int on = 1;
+    ::setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+}
+
+int sendFlags()
+{
+#ifdef MSG_NOSIGNAL
+    return MSG_NOSIGNAL;
+#else
+    return 0;
+#endif
+}
+
+void setTimeouts(Socket socket, long ms)
+{
+#ifdef _WIN32
+    const DWORD timeout = static_cast<DWORD>(ms);
+#else
+    timeval timeout = {};
+    timeout.tv_sec = ms / 1000;
+    timeout.tv_usec = (ms % 1000) * 1000;
+#endif
+    ::setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO,
+                 reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+    ::setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO,
+                 reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+}
+
+bool waitReadable(Socket socket, int ms)
+{
+    // unlike select, poll has no limit of descriptor value
+    pollfd descriptor = {};
+    descriptor.fd = socket;
+    descriptor.events = POLLIN;
+#ifdef _WIN32
+    const auto result = ::WSAPoll(&descriptor, 1U, ms);
+#else
+    const auto result = ::poll(&descriptor, 1U, ms);
+#endif
+    return result > 0 && 0 != (descriptor.revents & POLLIN);
+}
+
+bool sendAll(Socket socket, const std::string& data)
+{
+    size_t sent = 0U;
+    while (sent < data.size()) {
+        const auto result = ::send(socket, data.data() + sent,
+                                   static_cast<int>(data.size() - sent), sendFlags());
+        if (result <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(result);
+    }
+    return true;
+}
+
+std::string readRequestHead(Socket socket)
+{
+    std::string head;
+    char buffer[1024];
+    while (head.size() < g_maxRequestSize && std::string::npos == head.find("\r\n\r\n")) {
+        const auto result = ::recv(socket, buffer, sizeof(buffer), 0);
+        if (result <= 0) {
+            break;
+        }
+        head.append(buffer, static_cast<size_t>(result));
+    }
+    return head;
+}
+
+std::string response(int code, std::string_view status,
+                     std::string_view contentType, const std::string& body)
+{
+    std::string response = "HTTP/1.1 " + std::to_string(code) + " ";
+    response.append(status).append("\r\n");
+    if (!contentType.empty()) {
+        response.append("Content-Type: ").append(contentType).append("\r\n");
+    }
+    response.append("Content-Length: ").append(std::to_string(body.size())).append("\r\n");
+    response.append("Connection: close\r\n\r\n");
+    response.append(body);
+    return response;
+}
+
+}
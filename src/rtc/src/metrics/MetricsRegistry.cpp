@@ -0,0 +1,193 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/metrics/MetricsRegistry.h"
+#include "livekit/rtc/stats/StatsCollector.h"
+#include "Metrics.h"
+#include "SafeObj.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+using Collectors = std::vector<std::pair<const StatsCollector*, std::string>>;
+
+struct SessionDelta
+{
+    const std::string* _session = nullptr;
+    StatsDelta _delta;
+};
+
+Bricks::SafeObj<Collectors>& collectors();
+void renderRtpStats(const std::vector<SessionDelta>& deltas, std::string& output);
+template <class TGetter>
+void renderRtpGauge(std::string_view name, std::string_view help,
+                    const std::vector<SessionDelta>& deltas,
+                    const TGetter& getter, std::string& output);
+void appendLabelValue(std::string_view value, std::string& output);
+std::string number(double value);
+
+}
+
+namespace LiveKitCpp
+{
+
+void MetricsRegistry::setEnabled(bool enabled)
+{
+    g_metricsEnabled = enabled;
+}
+
+bool MetricsRegistry::enabled()
+{
+    return metricsEnabled();
+}
+
+void MetricsRegistry::addStatsCollector(const StatsCollector* collector, std::string session)
+{
+    if (collector) {
+        auto& collectors = ::collectors();
+        LOCK_WRITE_SAFE_OBJ(collectors);
+        const auto it = std::find_if(collectors->begin(), collectors->end(),
+                                     [collector](const auto& c) { return c.first == collector; });
+        if (it == collectors->end()) {
+            collectors->emplace_back(collector, std::move(session));
+        }
+        else {
+            it->second = std::move(session);
+        }
+    }
+}
+
+void MetricsRegistry::removeStatsCollector(const StatsCollector* collector)
+{
+    if (collector) {
+        auto& collectors = ::collectors();
+        LOCK_WRITE_SAFE_OBJ(collectors);
+        collectors->erase(std::remove_if(collectors->begin(), collectors->end(),
+                                         [collector](const auto& c) { return c.first == collector; }),
+                          collectors->end());
+    }
+}
+
+std::string MetricsRegistry::exposition()
+{
+    std::string output;
+    output.reserve(8192U);
+    Metrics::instance().render(output);
+    {
+        auto& collectors = ::collectors();
+        // collectors can't be removed (and destroyed) during the scrape
+        LOCK_READ_SAFE_OBJ(collectors);
+        std::vector<SessionDelta> deltas;
+        for (const auto& collector : collectors.constRef()) {
+            for (auto& delta : collector.first->lastDeltas()) {
+                deltas.push_back({&collector.second, std::move(delta)});
+            }
+        }
+        renderRtpStats(deltas, output);
+    }
+    output.append("# EOF\n");
+    return output;
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+Bricks::SafeObj<Collectors>& collectors()
+{
+    static Bricks::SafeObj<Collectors> collectors;
+    return collectors;
+}
+
+void renderRtpStats(const std::vector<SessionDelta>& deltas, std::string& output)
+{
+    if (!deltas.empty()) {
+        renderRtpGauge("livekit_rtp_bitrate_bps", "Bitrate of RTP stream or candidate pair",
+                       deltas, [](const StatsDelta& d) { return std::optional<double>(d._bitrate); },
+                       output);
+        renderRtpGauge("livekit_rtp_frame_rate", "Encoded or decoded frames per second",
+                       deltas, [](const StatsDelta& d) {
+            return d._frames ? std::optional<double>(d._fps) : std::nullopt;
+        }, output);
+        renderRtpGauge("livekit_rtp_packet_loss_percent", "Packets lost during the last interval",
+                       deltas, [](const StatsDelta& d) { return d._packetLoss; }, output);
+        renderRtpGauge("livekit_rtp_jitter_seconds", "Latest jitter of RTP stream",
+                       deltas, [](const StatsDelta& d) { return d._jitter; }, output);
+        renderRtpGauge("livekit_rtp_round_trip_time_seconds", "Latest round trip time",
+                       deltas, [](const StatsDelta& d) { return d._roundTripTime; }, output);
+    }
+}
+
+template <class TGetter>
+void renderRtpGauge(std::string_view name, std::string_view help,
+                    const std::vector<SessionDelta>& deltas,
+                    const TGetter& getter, std::string& output)
+{
+    output.append("# TYPE ").append(name).append(" gauge\n");
+    output.append("# HELP ").append(name).append(" ").append(help).append(".\n");
+    for (const auto& delta : deltas) {
+        if (const auto value = getter(delta._delta)) {
+            output.append(name).append("{session=\"");
+            appendLabelValue(*delta._session, output);
+            output.append("\",id=\"");
+            appendLabelValue(delta._delta._id, output);
+            output.append("\",type=\"");
+            appendLabelValue(toString(delta._delta._type), output);
+            output.append("\"} ").append(number(value.value())).append("\n");
+        }
+    }
+}
+
+void appendLabelValue(std::string_view value, std::string& output)
+{
+    for (const auto c : value) {
+        switch (c) {
+            case '\\':
+                output.append("\\\\");
+                break;
+            case '"':
+                output.append("\\\"");
+                break;
+            case '\n':
+                output.append("\\n");
+                break;
+            default:
+                output.push_back(c);
+                break;
+        }
+    }
+}
+
+std::string number(double value)
+{
+    if (std::isnan(value)) {
+        return "NaN";
+    }
+    if (std::isinf(value)) {
+        return value > 0. ? "+Inf" : "-Inf";
+    }
+    char buffer[32];
+    const auto len = std::snprintf(buffer, sizeof(buffer), "%.10g", value);
+    return std::string(buffer, len > 0 ? static_cast<size_t>(len) : 0U);
+}
+
+}
@@ -131,6 +131,11 @@ std::vector<StatsAttribute> Stats::attributes() const
     return {};
 }
 
+StatsView Stats::view() const
+{
+    return StatsView(getRtcStats(_stats));
+}
+
 std::shared_ptr<const StatsCodecExt> Stats::extCodec() const
 {
     return std::dynamic_pointer_cast<const StatsCodecExt>(_stats);
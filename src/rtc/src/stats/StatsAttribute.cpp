@@ -73,7 +73,7 @@ std::string_view StatsAttribute::name() const
 
 bool StatsAttribute::valid() const
 {
-    return std::visit([](const auto* attr) { return attr->has_value(); }, _value);
+    return std::visit([](const auto* attr) { return attr && attr->has_value(); }, _value);
 }
 
 bool StatsAttribute::isSequence() const
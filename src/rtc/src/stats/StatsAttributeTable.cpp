@@ -0,0 +1,240 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "StatsAttributeTable.h"
+#include <api/stats/rtcstats_objects.h>
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+template <class TStats>
+const StatsAttributeTable& tableOf();
+
+template <class TStats>
+inline bool is(const webrtc::RTCStats& stats) {
+    return std::string_view(TStats::kType) == stats.type();
+}
+
+template <size_t I>
+StatsAttribute::Value makeValue(const char* ptr)
+{
+    using Ptr = std::variant_alternative_t<I, webrtc::Attribute::StatVariant>;
+    return StatsAttribute::Value(reinterpret_cast<Ptr>(ptr));
+}
+
+template <size_t... I>
+constexpr auto makeValueFactories(std::index_sequence<I...>)
+{
+    return std::array<StatsAttribute::Value(*)(const char*), sizeof...(I)>{&makeValue<I>...};
+}
+
+}
+
+namespace LiveKitCpp
+{
+
+const StatsAttributeEntry* StatsAttributeTable::find(std::string_view name) const
+{
+    if (!name.empty()) {
+        const auto it = std::lower_bound(_byName.begin(), _byName.end(), name,
+                                         [this](size_t index, std::string_view name) {
+            return _entries[index]._name < name;
+        });
+        if (it != _byName.end() && _entries[*it]._name == name) {
+            return &_entries[*it];
+        }
+    }
+    return nullptr;
+}
+
+StatsClass statsClass(const webrtc::RTCStats& stats)
+{
+    if (is<webrtc::RTCInboundRtpStreamStats>(stats)) {
+        return StatsClass::InboundRtp;
+    }
+    if (is<webrtc::RTCOutboundRtpStreamStats>(stats)) {
+        return StatsClass::OutboundRtp;
+    }
+    if (is<webrtc::RTCRemoteInboundRtpStreamStats>(stats)) {
+        return StatsClass::RemoteInboundRtp;
+    }
+    if (is<webrtc::RTCRemoteOutboundRtpStreamStats>(stats)) {
+        return StatsClass::RemoteOutboundRtp;
+    }
+    if (is<webrtc::RTCIceCandidatePairStats>(stats)) {
+        return StatsClass::CandidatePair;
+    }
+    if (is<webrtc::RTCTransportStats>(stats)) {
+        return StatsClass::Transport;
+    }
+    if (is<webrtc::RTCCodecStats>(stats)) {
+        return StatsClass::Codec;
+    }
+    if (is<webrtc::RTCAudioPlayoutStats>(stats)) {
+        return StatsClass::AudioPlayout;
+    }
+    if (is<webrtc::RTCPeerConnectionStats>(stats)) {
+        return StatsClass::PeerConnection;
+    }
+    if (is<webrtc::RTCDataChannelStats>(stats)) {
+        return StatsClass::DataChannel;
+    }
+    if (is<webrtc::RTCCertificateStats>(stats)) {
+        return StatsClass::Certificate;
+    }
+    if (is<webrtc::RTCLocalIceCandidateStats>(stats)) {
+        return StatsClass::LocalCandidate;
+    }
+    if (is<webrtc::RTCRemoteIceCandidateStats>(stats)) {
+        return StatsClass::RemoteCandidate;
+    }
+    // audio & video sources share the type name
+    if (dynamic_cast<const webrtc::RTCAudioSourceStats*>(&stats)) {
+        return StatsClass::AudioSource;
+    }
+    if (dynamic_cast<const webrtc::RTCVideoSourceStats*>(&stats)) {
+        return StatsClass::VideoSource;
+    }
+    return StatsClass::Unknown;
+}
+
+const StatsAttributeTable& statsAttributeTable(StatsClass cls)
+{
+    switch (cls) {
+        case StatsClass::Codec:
+            return tableOf<webrtc::RTCCodecStats>();
+        case StatsClass::InboundRtp:
+            return tableOf<webrtc::RTCInboundRtpStreamStats>();
+        case StatsClass::OutboundRtp:
+            return tableOf<webrtc::RTCOutboundRtpStreamStats>();
+        case StatsClass::RemoteInboundRtp:
+            return tableOf<webrtc::RTCRemoteInboundRtpStreamStats>();
+        case StatsClass::RemoteOutboundRtp:
+            return tableOf<webrtc::RTCRemoteOutboundRtpStreamStats>();
+        case StatsClass::AudioSource:
+            return tableOf<webrtc::RTCAudioSourceStats>();
+        case StatsClass::VideoSource:
+            return tableOf<webrtc::RTCVideoSourceStats>();
+        case StatsClass::AudioPlayout:
+            return tableOf<webrtc::RTCAudioPlayoutStats>();
+        case StatsClass::PeerConnection:
+            return tableOf<webrtc::RTCPeerConnectionStats>();
+        case StatsClass::DataChannel:
+            return tableOf<webrtc::RTCDataChannelStats>();
+        case StatsClass::Transport:
+            return tableOf<webrtc::RTCTransportStats>();
+        case StatsClass::CandidatePair:
+            return tableOf<webrtc::RTCIceCandidatePairStats>();
+        case StatsClass::LocalCandidate:
+            return tableOf<webrtc::RTCLocalIceCandidateStats>();
+        case StatsClass::RemoteCandidate:
+            return tableOf<webrtc::RTCRemoteIceCandidateStats>();
+        case StatsClass::Certificate:
+            return tableOf<webrtc::RTCCertificateStats>();
+        default:
+            break;
+    }
+    static const StatsAttributeTable empty;
+    return empty;
+}
+
+std::unique_ptr<webrtc::RTCStats> createStats(StatsClass cls, std::string id,
+                                              webrtc::Timestamp timestamp)
+{
+    switch (cls) {
+        case StatsClass::Codec:
+            return std::make_unique<webrtc::RTCCodecStats>(std::move(id), timestamp);
+        case StatsClass::InboundRtp:
+            return std::make_unique<webrtc::RTCInboundRtpStreamStats>(std::move(id), timestamp);
+        case StatsClass::OutboundRtp:
+            return std::make_unique<webrtc::RTCOutboundRtpStreamStats>(std::move(id), timestamp);
+        case StatsClass::RemoteInboundRtp:
+            return std::make_unique<webrtc::RTCRemoteInboundRtpStreamStats>(std::move(id), timestamp);
+        case StatsClass::RemoteOutboundRtp:
+            return std::make_unique<webrtc::RTCRemoteOutboundRtpStreamStats>(std::move(id), timestamp);
+        case StatsClass::AudioSource:
+            return std::make_unique<webrtc::RTCAudioSourceStats>(std::move(id), timestamp);
+        case StatsClass::VideoSource:
+            return std::make_unique<webrtc::RTCVideoSourceStats>(std::move(id), timestamp);
+        case StatsClass::AudioPlayout:
+            return std::make_unique<webrtc::RTCAudioPlayoutStats>(std::move(id), timestamp);
+        case StatsClass::PeerConnection:
+            return std::make_unique<webrtc::RTCPeerConnectionStats>(std::move(id), timestamp);
+        case StatsClass::DataChannel:
+            return std::make_unique<webrtc::RTCDataChannelStats>(std::move(id), timestamp);
+        case StatsClass::Transport:
+            return std::make_unique<webrtc::RTCTransportStats>(std::move(id), timestamp);
+        case StatsClass::CandidatePair:
+            return std::make_unique<webrtc::RTCIceCandidatePairStats>(std::move(id), timestamp);
+        case StatsClass::LocalCandidate:
+            return std::make_unique<webrtc::RTCLocalIceCandidateStats>(std::move(id), timestamp);
+        case StatsClass::RemoteCandidate:
+            return std::make_unique<webrtc::RTCRemoteIceCandidateStats>(std::move(id), timestamp);
+        case StatsClass::Certificate:
+            return std::make_unique<webrtc::RTCCertificateStats>(std::move(id), timestamp);
+        default:
+            break;
+    }
+    return {};
+}
+
+StatsAttribute::Value makeStatsAttributeValue(const webrtc::RTCStats& stats,
+                                              const StatsAttributeEntry& entry)
+{
+    static constexpr auto factories = makeValueFactories(
+        std::make_index_sequence<std::variant_size_v<webrtc::Attribute::StatVariant>>{});
+    const auto base = reinterpret_cast<const char*>(&stats);
+    return factories.at(entry._variant)(base + entry._offset);
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+StatsAttributeTable makeTable(const webrtc::RTCStats& stats)
+{
+    StatsAttributeTable table;
+    const auto base = reinterpret_cast<const char*>(&stats);
+    for (const auto& attribute : stats.Attributes()) {
+        StatsAttributeEntry entry;
+        entry._name = attribute.name();
+        entry._variant = attribute.as_variant().index();
+        entry._offset = std::visit([base](const auto* value) {
+            return reinterpret_cast<const char*>(value) - base;
+        }, attribute.as_variant());
+        table._entries.push_back(entry);
+    }
+    table._byName.resize(table._entries.size());
+    for (size_t i = 0U; i < table._byName.size(); ++i) {
+        table._byName[i] = i;
+    }
+    std::sort(table._byName.begin(), table._byName.end(), [&table](size_t l, size_t r) {
+        return table._entries[l]._name < table._entries[r]._name;
+    });
+    return table;
+}
+
+template <class TStats>
+const StatsAttributeTable& tableOf()
+{
+    static const StatsAttributeTable table = makeTable(TStats("", webrtc::Timestamp::Zero()));
+    return table;
+}
+
+}
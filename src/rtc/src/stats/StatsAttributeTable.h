@@ -0,0 +1,91 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsAttributeTable.h
+#include "livekit/rtc/stats/StatsAttribute.h"
+#include <api/stats/rtc_stats.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// concrete classes of webrtc stats, values are part of binary stats format - append only
+enum class StatsClass : uint8_t
+{
+    Unknown = 0U,
+    Codec,
+    InboundRtp,
+    OutboundRtp,
+    RemoteInboundRtp,
+    RemoteOutboundRtp,
+    AudioSource,
+    VideoSource,
+    AudioPlayout,
+    PeerConnection,
+    DataChannel,
+    Transport,
+    CandidatePair,
+    LocalCandidate,
+    RemoteCandidate,
+    Certificate,
+    Last = Certificate
+};
+
+// location of attribute inside of stats object, the same for all objects of the class
+struct StatsAttributeEntry
+{
+    std::string_view _name;
+    // from the address of webrtc::RTCStats base
+    ptrdiff_t _offset = 0;
+    // index of alternative in webrtc::Attribute::StatVariant
+    size_t _variant = 0U;
+};
+
+struct StatsAttributeTable
+{
+    // in order of webrtc::RTCStats::Attributes()
+    std::vector<StatsAttributeEntry> _entries;
+    // indices of [_entries] sorted by name
+    std::vector<size_t> _byName;
+    const StatsAttributeEntry* find(std::string_view name) const;
+};
+
+StatsClass statsClass(const webrtc::RTCStats& stats);
+// tables are built once per class from an empty instance, lookups don't allocate
+const StatsAttributeTable& statsAttributeTable(StatsClass cls);
+inline const StatsAttributeTable& statsAttributeTable(const webrtc::RTCStats& stats) {
+    return statsAttributeTable(statsClass(stats));
+}
+// null for StatsClass::Unknown
+std::unique_ptr<webrtc::RTCStats> createStats(StatsClass cls, std::string id,
+                                              webrtc::Timestamp timestamp);
+StatsAttribute::Value makeStatsAttributeValue(const webrtc::RTCStats& stats,
+                                              const StatsAttributeEntry& entry);
+
+template <typename T>
+inline const std::optional<T>* statsAttribute(const webrtc::RTCStats& stats,
+                                              const StatsAttributeEntry& entry) {
+    const auto base = reinterpret_cast<const char*>(&stats);
+    return reinterpret_cast<const std::optional<T>*>(base + entry._offset);
+}
+
+template <typename T>
+inline std::optional<T>* statsAttribute(webrtc::RTCStats& stats, const StatsAttributeEntry& entry) {
+    const auto base = reinterpret_cast<char*>(&stats);
+    return reinterpret_cast<std::optional<T>*>(base + entry._offset);
+}
+
+} // namespace LiveKitCpp
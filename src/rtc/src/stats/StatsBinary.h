@@ -0,0 +1,236 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsBinary.h
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// binary stats format, all integers are LEB128 varints, signed ones are zigzag-encoded:
+// header:  magic 'L' 'S', version byte, flags byte, sequence number, report timestamp (us)
+// strings: count, [length, UTF-8 bytes]... - appended to the dictionary shared by successive reports
+// objects: count, [StatsClass byte, id (string index), timestamp delta to report (us),
+//          attributes count, [name (string index) << _typeBits | StatsBinaryType, value]...]...
+// values:  bool - byte, integers - varints, double - 8 bytes LE, string - string index,
+//          vector - count + values, map - count + [key (string index), value]...
+// flag _resetFlag clears the dictionary before reading of strings
+struct StatsBinary
+{
+    static constexpr uint8_t _magic[2] = {'L', 'S'};
+    // 2 - attribute types are StatsBinaryType instead of webrtc::Attribute::StatVariant indices
+    static constexpr uint8_t _version = 2U;
+    static constexpr uint8_t _resetFlag = 1U;
+    static constexpr unsigned _typeBits = 4U;
+    static constexpr uint64_t _typeMask = (1U << _typeBits) - 1U;
+};
+
+// wire types of attribute values, independent from the order of alternatives in webrtc::Attribute::StatVariant,
+// existing values must not be changed, new ones are appended
+enum class StatsBinaryType : uint8_t
+{
+    Bool = 0U,
+    Int32,
+    Uint32,
+    Int64,
+    Uint64,
+    Double,
+    String,
+    BoolVector,
+    Int32Vector,
+    Uint32Vector,
+    Int64Vector,
+    Uint64Vector,
+    DoubleVector,
+    StringVector,
+    Uint64Map,
+    DoubleMap,
+    Last = DoubleMap
+};
+
+static_assert(static_cast<uint64_t>(StatsBinaryType::Last) <= StatsBinary::_typeMask);
+
+// maps C++ type of attribute value to the wire type
+template <typename T>
+constexpr StatsBinaryType statsBinaryType()
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return StatsBinaryType::Bool;
+    }
+    else if constexpr (std::is_same_v<T, int32_t>) {
+        return StatsBinaryType::Int32;
+    }
+    else if constexpr (std::is_same_v<T, uint32_t>) {
+        return StatsBinaryType::Uint32;
+    }
+    else if constexpr (std::is_same_v<T, int64_t>) {
+        return StatsBinaryType::Int64;
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>) {
+        return StatsBinaryType::Uint64;
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        return StatsBinaryType::Double;
+    }
+    else if constexpr (std::is_same_v<T, std::string>) {
+        return StatsBinaryType::String;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<bool>>) {
+        return StatsBinaryType::BoolVector;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<int32_t>>) {
+        return StatsBinaryType::Int32Vector;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<uint32_t>>) {
+        return StatsBinaryType::Uint32Vector;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<int64_t>>) {
+        return StatsBinaryType::Int64Vector;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<uint64_t>>) {
+        return StatsBinaryType::Uint64Vector;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<double>>) {
+        return StatsBinaryType::DoubleVector;
+    }
+    else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+        return StatsBinaryType::StringVector;
+    }
+    else if constexpr (std::is_same_v<T, std::map<std::string, uint64_t>>) {
+        return StatsBinaryType::Uint64Map;
+    }
+    else {
+        static_assert(std::is_same_v<T, std::map<std::string, double>>, "unsupported type of stats attribute");
+        return StatsBinaryType::DoubleMap;
+    }
+}
+
+class StatsBinaryWriter
+{
+public:
+    StatsBinaryWriter(std::vector<uint8_t>& output) : _output(output) {}
+    void writeByte(uint8_t value) { _output.push_back(value); }
+    void writeVarint(uint64_t value);
+    void writeSigned(int64_t value) { writeVarint(zigzag(value)); }
+    void writeDouble(double value);
+    void writeString(std::string_view value);
+    void writeBytes(const std::vector<uint8_t>& bytes) { _output.insert(_output.end(), bytes.begin(), bytes.end()); }
+    static uint64_t zigzag(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+private:
+    std::vector<uint8_t>& _output;
+};
+
+class StatsBinaryReader
+{
+public:
+    StatsBinaryReader(const uint8_t* data, size_t size) : _data(data), _size(data ? size : 0U) {}
+    bool readByte(uint8_t& value);
+    bool readVarint(uint64_t& value);
+    bool readSigned(int64_t& value);
+    bool readDouble(double& value);
+    bool readString(std::string& value);
+    size_t remaining() const { return _size - _pos; }
+    static int64_t unzigzag(uint64_t value) { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1U); }
+private:
+    const uint8_t* const _data;
+    const size_t _size;
+    size_t _pos = 0U;
+};
+
+inline void StatsBinaryWriter::writeVarint(uint64_t value)
+{
+    while (value >= 0x80U) {
+        _output.push_back(static_cast<uint8_t>(value | 0x80U));
+        value >>= 7;
+    }
+    _output.push_back(static_cast<uint8_t>(value));
+}
+
+inline void StatsBinaryWriter::writeDouble(double value)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (size_t i = 0U; i < sizeof(bits); ++i) {
+        _output.push_back(static_cast<uint8_t>(bits >> (8U * i)));
+    }
+}
+
+inline void StatsBinaryWriter::writeString(std::string_view value)
+{
+    writeVarint(value.size());
+    _output.insert(_output.end(), value.begin(), value.end());
+}
+
+inline bool StatsBinaryReader::readByte(uint8_t& value)
+{
+    if (_pos < _size) {
+        value = _data[_pos++];
+        return true;
+    }
+    return false;
+}
+
+inline bool StatsBinaryReader::readVarint(uint64_t& value)
+{
+    value = 0U;
+    for (unsigned shift = 0U; shift < 64U && _pos < _size; shift += 7U) {
+        const auto byte = _data[_pos++];
+        value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+        if (0U == (byte & 0x80U)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool StatsBinaryReader::readSigned(int64_t& value)
+{
+    uint64_t raw;
+    if (readVarint(raw)) {
+        value = unzigzag(raw);
+        return true;
+    }
+    return false;
+}
+
+inline bool StatsBinaryReader::readDouble(double& value)
+{
+    if (remaining() >= sizeof(uint64_t)) {
+        uint64_t bits = 0U;
+        for (size_t i = 0U; i < sizeof(bits); ++i) {
+            bits |= static_cast<uint64_t>(_data[_pos++]) << (8U * i);
+        }
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+    return false;
+}
+
+inline bool StatsBinaryReader::readString(std::string& value)
+{
+    uint64_t size;
+    if (readVarint(size) && size <= remaining()) {
+        value.assign(reinterpret_cast<const char*>(_data + _pos), static_cast<size_t>(size));
+        _pos += static_cast<size_t>(size);
+        return true;
+    }
+    return false;
+}
+
+} // namespace LiveKitCpp
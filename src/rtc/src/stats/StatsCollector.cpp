@@ -0,0 +1,383 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/stats/StatsCollector.h"
+#include "livekit/rtc/stats/StatsDeltaListener.h"
+#include "livekit/rtc/stats/StatsSource.h"
+#include "Listeners.h"
+#include "MediaTimer.h"
+#include "RtcUtils.h"
+#include "SafeObj.h"
+#include "StatsReportData.h"
+#include "StatsSeries.h"
+#include <api/stats/rtcstats_objects.h>
+#include <algorithm>
+#include <atomic>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+
+using namespace LiveKitCpp;
+
+struct SeriesData
+{
+    std::unordered_map<std::string, StatsSeries> _series;
+    // IDs of series with pending deltas
+    std::vector<std::string> _changed;
+    // number of the last query, all reports of one query (publisher & subscriber of session) have the same number
+    uint64_t _poll = 0ULL;
+};
+
+// stats objects which were not reported during this number of polls are gone
+constexpr uint64_t g_expirationPolls = 3ULL;
+
+template <class TStats>
+inline const TStats* cast(const webrtc::RTCStats& stats) {
+    if (std::string_view(TStats::kType) == stats.type()) {
+        return &stats.cast_to<TStats>();
+    }
+    return nullptr;
+}
+
+template <typename T>
+inline T value(const std::optional<T>& v) { return v.value_or(T()); }
+
+// counters of RTP streams & candidate pairs, other stats objects are skipped
+StatsType makeSample(const webrtc::RTCStats& stats, StatsSample& sample);
+// polling of all collectors is a cheap call of [StatsSource::queryStats],
+// the timer thread is shared
+std::shared_ptr<webrtc::TaskQueueBase> pollingQueue();
+
+}
+
+namespace LiveKitCpp
+{
+
+class StatsCollector::Impl : public MediaTimerCallback,
+                             public StatsListener,
+                             public std::enable_shared_from_this<StatsCollector::Impl>
+{
+    class Poll;
+public:
+    Impl(StatsSource* source, const StatsCollectorOptions& options);
+    ~Impl() override;
+    void start();
+    void stop();
+    bool started() const { return _timer.started(); }
+    void addListener(StatsDeltaListener* listener) { _listeners.add(listener); }
+    void removeListener(StatsDeltaListener* listener) { _listeners.remove(listener); }
+    std::vector<StatsDelta> takeChanges();
+    std::optional<StatsDelta> lastDelta(const std::string& statsId) const;
+    std::vector<StatsDelta> lastDeltas() const;
+    std::vector<StatsSample> history(const std::string& statsId) const;
+    void onStats(const StatsReport& report, uint64_t poll);
+    // impl. of StatsListener, fallback for source without per-query delivery:
+    // all reports of the source are accepted as reports of the latest poll
+    void onStats(const StatsReport& report) final;
+    // impl. of MediaTimerCallback
+    void onTimeout(uint64_t) final;
+private:
+    StatsSource* const _source;
+    const StatsCollectorOptions _options;
+    // timer keeps only weak reference to the queue
+    const std::shared_ptr<webrtc::TaskQueueBase> _queue;
+    MediaTimer _timer;
+    Bricks::Listeners<StatsDeltaListener*> _listeners;
+    Bricks::SafeObj<SeriesData> _data;
+    // true if added as listener of the source
+    std::atomic_bool _fanOut = false;
+};
+
+// reports of one query, queries are not delivered to other listeners of the source
+class StatsCollector::Impl::Poll : public StatsListener
+{
+public:
+    Poll(std::weak_ptr<Impl> impl, uint64_t poll);
+    // impl. of StatsListener
+    void onStats(const StatsReport& report) final;
+private:
+    const std::weak_ptr<Impl> _impl;
+    const uint64_t _poll;
+};
+
+StatsCollector::StatsCollector(StatsSource* source, StatsCollectorOptions options)
+    : _impl(std::make_shared<Impl>(source, options))
+{
+}
+
+StatsCollector::~StatsCollector()
+{
+}
+
+void StatsCollector::start()
+{
+    _impl->start();
+}
+
+void StatsCollector::stop()
+{
+    _impl->stop();
+}
+
+bool StatsCollector::started() const
+{
+    return _impl->started();
+}
+
+void StatsCollector::addListener(StatsDeltaListener* listener)
+{
+    _impl->addListener(listener);
+}
+
+void StatsCollector::removeListener(StatsDeltaListener* listener)
+{
+    _impl->removeListener(listener);
+}
+
+std::vector<StatsDelta> StatsCollector::takeChanges()
+{
+    return _impl->takeChanges();
+}
+
+std::optional<StatsDelta> StatsCollector::lastDelta(const std::string& statsId) const
+{
+    return _impl->lastDelta(statsId);
+}
+
+std::vector<StatsDelta> StatsCollector::lastDeltas() const
+{
+    return _impl->lastDeltas();
+}
+
+std::vector<StatsSample> StatsCollector::history(const std::string& statsId) const
+{
+    return _impl->history(statsId);
+}
+
+StatsCollector::Impl::Impl(StatsSource* source, const StatsCollectorOptions& options)
+    : _source(source)
+    , _options(options)
+    , _queue(pollingQueue())
+    , _timer(_queue, this)
+{
+}
+
+StatsCollector::Impl::~Impl()
+{
+    stop();
+    if (_fanOut) {
+        _source->removeStatsListener(this);
+    }
+    _listeners.clear();
+}
+
+void StatsCollector::Impl::start()
+{
+    if (_source && !_timer.started()) {
+        _timer.start(std::max<uint64_t>(_options._intervalMs, 1ULL));
+    }
+}
+
+void StatsCollector::Impl::stop()
+{
+    _timer.stop();
+}
+
+std::vector<StatsDelta> StatsCollector::Impl::takeChanges()
+{
+    std::vector<StatsDelta> changes;
+    LOCK_WRITE_SAFE_OBJ(_data);
+    changes.reserve(_data->_changed.size());
+    for (const auto& id : _data->_changed) {
+        const auto it = _data->_series.find(id);
+        if (it != _data->_series.end() && it->second._pending) {
+            it->second._pending = false;
+            changes.push_back(it->second.lastDelta());
+        }
+    }
+    _data->_changed.clear();
+    return changes;
+}
+
+std::optional<StatsDelta> StatsCollector::Impl::lastDelta(const std::string& statsId) const
+{
+    LOCK_READ_SAFE_OBJ(_data);
+    const auto it = _data->_series.find(statsId);
+    if (it != _data->_series.end() && it->second.size() > 1U) {
+        return it->second.lastDelta();
+    }
+    return std::nullopt;
+}
+
+std::vector<StatsDelta> StatsCollector::Impl::lastDeltas() const
+{
+    std::vector<StatsDelta> deltas;
+    LOCK_READ_SAFE_OBJ(_data);
+    deltas.reserve(_data->_series.size());
+    for (const auto& series : _data->_series) {
+        if (series.second.size() > 1U) {
+            deltas.push_back(series.second.lastDelta());
+        }
+    }
+    return deltas;
+}
+
+std::vector<StatsSample> StatsCollector::Impl::history(const std::string& statsId) const
+{
+    LOCK_READ_SAFE_OBJ(_data);
+    const auto it = _data->_series.find(statsId);
+    if (it != _data->_series.end()) {
+        return it->second.history();
+    }
+    return {};
+}
+
+void StatsCollector::Impl::onStats(const StatsReport& report, uint64_t poll)
+{
+    if (!report._data || !report._data->_data) {
+        return;
+    }
+    std::vector<StatsDelta> changes;
+    const bool notify = !_listeners.empty();
+    {
+        LOCK_WRITE_SAFE_OBJ(_data);
+        StatsSample sample;
+        for (const auto& stats : *report._data->_data) {
+            const auto type = makeSample(stats, sample);
+            if (StatsType::Uknown == type) {
+                continue;
+            }
+            auto it = _data->_series.find(stats.id());
+            if (it == _data->_series.end()) {
+                it = _data->_series.emplace(std::piecewise_construct,
+                                            std::forward_as_tuple(stats.id()),
+                                            std::forward_as_tuple(stats.id(), type,
+                                                                  _options._historySize)).first;
+            }
+            auto& series = it->second;
+            series._lastPoll = std::max(series._lastPoll, poll);
+            if (series.add(sample)) {
+                if (!series._pending) {
+                    series._pending = true;
+                    _data->_changed.push_back(stats.id());
+                }
+                if (notify) {
+                    changes.push_back(series.lastDelta());
+                }
+            }
+        }
+        // streams & pairs which are gone, objects of another report of the same poll are kept
+        for (auto it = _data->_series.begin(); it != _data->_series.end();) {
+            if (it->second._lastPoll + g_expirationPolls < poll) {
+                it = _data->_series.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    if (!changes.empty()) {
+        _listeners.invoke(&StatsDeltaListener::onStatsDelta, changes);
+    }
+}
+
+void StatsCollector::Impl::onStats(const StatsReport& report)
+{
+    uint64_t poll = 0ULL;
+    {
+        LOCK_READ_SAFE_OBJ(_data);
+        poll = _data->_poll;
+    }
+    onStats(report, poll);
+}
+
+void StatsCollector::Impl::onTimeout(uint64_t)
+{
+    uint64_t poll = 0ULL;
+    {
+        LOCK_WRITE_SAFE_OBJ(_data);
+        poll = ++_data->_poll;
+    }
+    if (!_source->queryStats(std::make_shared<Poll>(weak_from_this(), poll))) {
+        if (!_fanOut.exchange(true)) {
+            _source->addStatsListener(this);
+        }
+        _source->queryStats();
+    }
+}
+
+StatsCollector::Impl::Poll::Poll(std::weak_ptr<Impl> impl, uint64_t poll)
+    : _impl(std::move(impl))
+    , _poll(poll)
+{
+}
+
+void StatsCollector::Impl::Poll::onStats(const StatsReport& report)
+{
+    if (const auto impl = _impl.lock()) {
+        impl->onStats(report, _poll);
+    }
+}
+
+} // namespace LiveKitCpp
+
+namespace {
+
+StatsType makeSample(const webrtc::RTCStats& stats, StatsSample& sample)
+{
+    sample = {};
+    sample._timestamp = StatsReportData::map(stats.timestamp());
+    if (const auto in = cast<webrtc::RTCInboundRtpStreamStats>(stats)) {
+        sample._bytes = value(in->bytes_received);
+        sample._packets = value(in->packets_received);
+        sample._packetsLost = value(in->packets_lost);
+        sample._frames = value(in->frames_decoded);
+        sample._jitter = in->jitter;
+        return StatsType::InboundRtp;
+    }
+    if (const auto out = cast<webrtc::RTCOutboundRtpStreamStats>(stats)) {
+        sample._bytes = value(out->bytes_sent);
+        sample._packets = value(out->packets_sent);
+        sample._frames = value(out->frames_encoded);
+        return StatsType::OutboundRtp;
+    }
+    if (const auto rin = cast<webrtc::RTCRemoteInboundRtpStreamStats>(stats)) {
+        sample._packetsLost = value(rin->packets_lost);
+        sample._jitter = rin->jitter;
+        sample._roundTripTime = rin->round_trip_time;
+        sample._fractionLost = rin->fraction_lost;
+        return StatsType::RemoteInboundRtp;
+    }
+    if (const auto pair = cast<webrtc::RTCIceCandidatePairStats>(stats)) {
+        sample._bytes = value(pair->bytes_sent) + value(pair->bytes_received);
+        sample._packets = value(pair->packets_sent) + value(pair->packets_received);
+        sample._roundTripTime = pair->current_round_trip_time;
+        return StatsType::CandidatePair;
+    }
+    return StatsType::Uknown;
+}
+
+std::shared_ptr<webrtc::TaskQueueBase> pollingQueue()
+{
+    static Bricks::SafeObj<std::weak_ptr<webrtc::TaskQueueBase>> queue;
+    LOCK_WRITE_SAFE_OBJ(queue);
+    auto instance = queue->lock();
+    if (!instance) {
+        instance = createTaskQueueS("stats_collector_queue");
+        queue = instance;
+    }
+    return instance;
+}
+
+}
@@ -0,0 +1,315 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/stats/StatsDecoder.h"
+#include "StatsAttributeTable.h"
+#include "StatsBinary.h"
+#include "StatsReportData.h"
+#include <api/stats/rtc_stats_report.h>
+#include <array>
+#include <map>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+using Dictionary = std::vector<std::string>;
+
+template <typename T>
+struct IsMap : std::false_type {};
+
+template <typename K, typename V, typename C, typename A>
+struct IsMap<std::map<K, V, C, A>> : std::true_type {};
+
+bool readString(StatsBinaryReader& reader, const Dictionary& dictionary, std::string& value);
+
+template <typename T>
+bool read(StatsBinaryReader& reader, const Dictionary& dictionary, T& value);
+
+// value type of the variant alternative [I]
+template <size_t I>
+using AttributeType = typename std::remove_const_t<std::remove_pointer_t<
+    std::variant_alternative_t<I, webrtc::Attribute::StatVariant>>>::value_type;
+
+// reads value of the variant alternative [I], stores it to [stats] if [entry] has the same type
+template <size_t I>
+bool readAttribute(StatsBinaryReader& reader, const Dictionary& dictionary,
+                   webrtc::RTCStats* stats, const StatsAttributeEntry* entry);
+
+// readers indexed by StatsBinaryType, null for wire types unknown for this version of webrtc
+template <size_t... I>
+constexpr auto makeAttributeReaders(std::index_sequence<I...>)
+{
+    using Reader = bool(*)(StatsBinaryReader&, const Dictionary&, webrtc::RTCStats*, const StatsAttributeEntry*);
+    std::array<Reader, static_cast<size_t>(StatsBinaryType::Last) + 1U> readers{};
+    ((readers[static_cast<size_t>(statsBinaryType<AttributeType<I>>())] = &readAttribute<I>), ...);
+    return readers;
+}
+
+}
+
+namespace LiveKitCpp
+{
+
+class StatsDecoder::Impl
+{
+public:
+    webrtc::scoped_refptr<webrtc::RTCStatsReport> decode(const uint8_t* data, size_t size);
+    void reset();
+private:
+    webrtc::scoped_refptr<webrtc::RTCStatsReport> decode(StatsBinaryReader& reader);
+    bool readStats(StatsBinaryReader& reader, int64_t reportTs, webrtc::RTCStatsReport* report) const;
+private:
+    Dictionary _dictionary;
+    uint64_t _sequence = 0U;
+    bool _synced = false;
+};
+
+StatsDecoder::StatsDecoder()
+    : _impl(std::make_unique<Impl>())
+{
+}
+
+StatsDecoder::~StatsDecoder()
+{
+}
+
+std::optional<StatsReport> StatsDecoder::decode(const uint8_t* data, size_t size)
+{
+    if (auto report = _impl->decode(data, size)) {
+        return StatsReport(new StatsReportData{std::move(report)});
+    }
+    return std::nullopt;
+}
+
+std::optional<StatsReport> StatsDecoder::decode(const std::vector<uint8_t>& data)
+{
+    return decode(data.data(), data.size());
+}
+
+void StatsDecoder::reset()
+{
+    _impl->reset();
+}
+
+webrtc::scoped_refptr<webrtc::RTCStatsReport> StatsDecoder::Impl::decode(const uint8_t* data, size_t size)
+{
+    StatsBinaryReader reader(data, size);
+    auto report = decode(reader);
+    if (!report) {
+        _synced = false;
+    }
+    return report;
+}
+
+void StatsDecoder::Impl::reset()
+{
+    _dictionary.clear();
+    _synced = false;
+}
+
+webrtc::scoped_refptr<webrtc::RTCStatsReport> StatsDecoder::Impl::decode(StatsBinaryReader& reader)
+{
+    uint8_t magic0, magic1, version, flags;
+    if (!reader.readByte(magic0) || !reader.readByte(magic1) || !reader.readByte(version) ||
+        !reader.readByte(flags)) {
+        return {};
+    }
+    if (StatsBinary::_magic[0] != magic0 || StatsBinary::_magic[1] != magic1 ||
+        StatsBinary::_version != version) {
+        return {};
+    }
+    uint64_t sequence;
+    int64_t timestamp;
+    if (!reader.readVarint(sequence) || !reader.readSigned(timestamp)) {
+        return {};
+    }
+    if (flags & StatsBinary::_resetFlag) {
+        _dictionary.clear();
+    }
+    else if (!_synced || sequence != _sequence) {
+        // strings of missed report are unknown
+        return {};
+    }
+    uint64_t stringsCount;
+    if (!reader.readVarint(stringsCount) || stringsCount > reader.remaining()) {
+        return {};
+    }
+    _dictionary.reserve(_dictionary.size() + static_cast<size_t>(stringsCount));
+    for (uint64_t i = 0U; i < stringsCount; ++i) {
+        std::string string;
+        if (!reader.readString(string)) {
+            return {};
+        }
+        _dictionary.push_back(std::move(string));
+    }
+    auto report = webrtc::RTCStatsReport::Create(webrtc::Timestamp::Micros(timestamp));
+    uint64_t statsCount;
+    if (!reader.readVarint(statsCount)) {
+        return {};
+    }
+    for (uint64_t i = 0U; i < statsCount; ++i) {
+        if (!readStats(reader, timestamp, report.get())) {
+            return {};
+        }
+    }
+    _sequence = sequence + 1U;
+    _synced = true;
+    return report;
+}
+
+bool StatsDecoder::Impl::readStats(StatsBinaryReader& reader, int64_t reportTs,
+                                   webrtc::RTCStatsReport* report) const
+{
+    static constexpr auto readers = makeAttributeReaders(
+        std::make_index_sequence<std::variant_size_v<webrtc::Attribute::StatVariant>>{});
+    uint8_t cls;
+    std::string id;
+    int64_t timestampDelta;
+    uint64_t attributesCount;
+    if (!reader.readByte(cls) || !readString(reader, _dictionary, id) ||
+        !reader.readSigned(timestampDelta) || !reader.readVarint(attributesCount)) {
+        return false;
+    }
+    // null for classes from newer version of library, their attributes are skipped
+    auto stats = createStats(static_cast<StatsClass>(cls), std::move(id),
+                             webrtc::Timestamp::Micros(reportTs + timestampDelta));
+    const auto& table = statsAttributeTable(static_cast<StatsClass>(cls));
+    for (uint64_t i = 0U; i < attributesCount; ++i) {
+        uint64_t key;
+        if (!reader.readVarint(key)) {
+            return false;
+        }
+        const auto nameIndex = key >> StatsBinary::_typeBits;
+        const auto type = static_cast<size_t>(key & StatsBinary::_typeMask);
+        // value of unknown type can't be skipped
+        if (nameIndex >= _dictionary.size() || type >= readers.size() || !readers[type]) {
+            return false;
+        }
+        const auto entry = stats ? table.find(_dictionary[nameIndex]) : nullptr;
+        if (!readers[type](reader, _dictionary, stats.get(), entry)) {
+            return false;
+        }
+    }
+    if (stats && !report->Get(stats->id())) {
+        report->AddStats(std::move(stats));
+    }
+    return true;
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+bool readString(StatsBinaryReader& reader, const Dictionary& dictionary, std::string& value)
+{
+    uint64_t index;
+    if (reader.readVarint(index) && index < dictionary.size()) {
+        value = dictionary[index];
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool read(StatsBinaryReader& reader, const Dictionary& dictionary, T& value)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        uint8_t byte;
+        if (reader.readByte(byte)) {
+            value = 0U != byte;
+            return true;
+        }
+        return false;
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+        double raw;
+        if (reader.readDouble(raw)) {
+            value = static_cast<T>(raw);
+            return true;
+        }
+        return false;
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        int64_t raw;
+        if (reader.readSigned(raw)) {
+            value = static_cast<T>(raw);
+            return true;
+        }
+        return false;
+    }
+    else if constexpr (std::is_integral_v<T>) {
+        uint64_t raw;
+        if (reader.readVarint(raw)) {
+            value = static_cast<T>(raw);
+            return true;
+        }
+        return false;
+    }
+    else if constexpr (std::is_same_v<T, std::string>) {
+        return readString(reader, dictionary, value);
+    }
+    else if constexpr (IsMap<T>::value) {
+        uint64_t size;
+        if (!reader.readVarint(size) || size > reader.remaining()) {
+            return false;
+        }
+        for (uint64_t i = 0U; i < size; ++i) {
+            std::string key;
+            typename T::mapped_type item;
+            if (!readString(reader, dictionary, key) || !read(reader, dictionary, item)) {
+                return false;
+            }
+            value.emplace(std::move(key), std::move(item));
+        }
+        return true;
+    }
+    else {
+        uint64_t size;
+        // each item takes at least one byte
+        if (!reader.readVarint(size) || size > reader.remaining()) {
+            return false;
+        }
+        value.reserve(static_cast<size_t>(size));
+        for (uint64_t i = 0U; i < size; ++i) {
+            typename T::value_type item;
+            if (!read(reader, dictionary, item)) {
+                return false;
+            }
+            value.push_back(std::move(item));
+        }
+        return true;
+    }
+}
+
+template <size_t I>
+bool readAttribute(StatsBinaryReader& reader, const Dictionary& dictionary,
+                   webrtc::RTCStats* stats, const StatsAttributeEntry* entry)
+{
+    using Type = AttributeType<I>;
+    Type value{};
+    if (!read(reader, dictionary, value)) {
+        return false;
+    }
+    // attribute may be absent or may have another type in this version of library
+    if (stats && entry && I == entry->_variant) {
+        *statsAttribute<Type>(*stats, *entry) = std::move(value);
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,222 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/stats/StatsEncoder.h"
+#include "livekit/rtc/stats/StatsReport.h"
+#include "StatsAttributeTable.h"
+#include "StatsBinary.h"
+#include "StatsReportData.h"
+#include <deque>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+
+namespace
+{
+
+template <typename T>
+struct IsMap : std::false_type {};
+
+template <typename K, typename V, typename C, typename A>
+struct IsMap<std::map<K, V, C, A>> : std::true_type {};
+
+}
+
+namespace LiveKitCpp
+{
+
+class StatsEncoder::Impl
+{
+public:
+    Impl(StatsEncoderOptions options);
+    bool encode(const webrtc::RTCStatsReport& report, std::vector<uint8_t>& output);
+    void reset() { _resetRequested = true; }
+private:
+    bool resetRequired() const;
+    uint64_t intern(std::string_view string);
+    void writeStats(const webrtc::RTCStats& stats, StatsClass cls, const webrtc::Timestamp& reportTs);
+    template <typename T>
+    void write(const T& value);
+private:
+    const StatsEncoderOptions _options;
+    StatsBinaryWriter _writer;
+    // deque keeps addresses of strings, keys of [_dictionary] refer to them
+    std::deque<std::string> _strings;
+    std::unordered_map<std::string_view, uint64_t> _dictionary;
+    // index of the first string added by the current report
+    size_t _newStrings = 0U;
+    std::vector<uint8_t> _body;
+    std::vector<const StatsAttributeEntry*> _present;
+    uint64_t _sequence = 0U;
+    size_t _reportsSinceReset = 0U;
+    bool _resetRequested = true;
+};
+
+StatsEncoder::StatsEncoder(StatsEncoderOptions options)
+    : _impl(std::make_unique<Impl>(std::move(options)))
+{
+}
+
+StatsEncoder::~StatsEncoder()
+{
+}
+
+bool StatsEncoder::encode(const StatsReport& report, std::vector<uint8_t>& output)
+{
+    if (report._data && report._data->_data) {
+        return _impl->encode(*report._data->_data, output);
+    }
+    return false;
+}
+
+std::vector<uint8_t> StatsEncoder::encode(const StatsReport& report)
+{
+    std::vector<uint8_t> output;
+    encode(report, output);
+    return output;
+}
+
+void StatsEncoder::reset()
+{
+    _impl->reset();
+}
+
+StatsEncoder::Impl::Impl(StatsEncoderOptions options)
+    : _options(std::move(options))
+    , _writer(_body)
+{
+}
+
+bool StatsEncoder::Impl::encode(const webrtc::RTCStatsReport& report, std::vector<uint8_t>& output)
+{
+    const bool reset = resetRequired();
+    if (reset) {
+        _dictionary.clear();
+        _strings.clear();
+        _reportsSinceReset = 0U;
+        _resetRequested = false;
+    }
+    _newStrings = _strings.size();
+    _body.clear();
+    // objects of classes unknown for this library are skipped
+    size_t count = 0U;
+    for (const auto& stats : report) {
+        if (StatsClass::Unknown != statsClass(stats)) {
+            ++count;
+        }
+    }
+    _writer.writeVarint(count);
+    for (const auto& stats : report) {
+        const auto cls = statsClass(stats);
+        if (StatsClass::Unknown != cls) {
+            writeStats(stats, cls, report.timestamp());
+        }
+    }
+    StatsBinaryWriter writer(output);
+    writer.writeByte(StatsBinary::_magic[0]);
+    writer.writeByte(StatsBinary::_magic[1]);
+    writer.writeByte(StatsBinary::_version);
+    writer.writeByte(reset ? StatsBinary::_resetFlag : 0U);
+    writer.writeVarint(_sequence++);
+    writer.writeSigned(report.timestamp().us());
+    writer.writeVarint(_strings.size() - _newStrings);
+    for (size_t i = _newStrings; i < _strings.size(); ++i) {
+        writer.writeString(_strings[i]);
+    }
+    writer.writeBytes(_body);
+    ++_reportsSinceReset;
+    return true;
+}
+
+bool StatsEncoder::Impl::resetRequired() const
+{
+    if (_resetRequested) {
+        return true;
+    }
+    if (_options._maxDictionarySize && _dictionary.size() >= _options._maxDictionarySize) {
+        return true;
+    }
+    return _options._resetInterval && _reportsSinceReset >= _options._resetInterval;
+}
+
+uint64_t StatsEncoder::Impl::intern(std::string_view string)
+{
+    const auto it = _dictionary.find(string);
+    if (it != _dictionary.end()) {
+        return it->second;
+    }
+    const auto index = _strings.size();
+    _strings.emplace_back(string);
+    _dictionary.emplace(_strings.back(), index);
+    return index;
+}
+
+void StatsEncoder::Impl::writeStats(const webrtc::RTCStats& stats, StatsClass cls,
+                                    const webrtc::Timestamp& reportTs)
+{
+    _writer.writeByte(static_cast<uint8_t>(cls));
+    _writer.writeVarint(intern(stats.id()));
+    _writer.writeSigned((stats.timestamp() - reportTs).us());
+    // only attributes with values are written
+    _present.clear();
+    for (const auto& entry : statsAttributeTable(cls)._entries) {
+        const auto value = makeStatsAttributeValue(stats, entry);
+        if (std::visit([](const auto* attr) { return attr->has_value(); }, value)) {
+            _present.push_back(&entry);
+        }
+    }
+    _writer.writeVarint(_present.size());
+    for (const auto entry : _present) {
+        std::visit([this, entry](const auto* attr) {
+            using Type = typename std::decay_t<decltype(*attr)>::value_type;
+            constexpr auto type = static_cast<uint64_t>(statsBinaryType<Type>());
+            _writer.writeVarint((intern(entry->_name) << StatsBinary::_typeBits) | type);
+            write(attr->value());
+        }, makeStatsAttributeValue(stats, *entry));
+    }
+}
+
+template <typename T>
+void StatsEncoder::Impl::write(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        _writer.writeByte(value ? 1U : 0U);
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+        _writer.writeDouble(value);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        _writer.writeSigned(value);
+    }
+    else if constexpr (std::is_integral_v<T>) {
+        _writer.writeVarint(value);
+    }
+    else if constexpr (std::is_same_v<T, std::string>) {
+        _writer.writeVarint(intern(value));
+    }
+    else if constexpr (IsMap<T>::value) {
+        _writer.writeVarint(value.size());
+        for (const auto& item : value) {
+            _writer.writeVarint(intern(item.first));
+            write(item.second);
+        }
+    }
+    else {
+        _writer.writeVarint(value.size());
+        for (const auto& item : value) {
+            write(item);
+        }
+    }
+}
+
+} // namespace LiveKitCpp
@@ -30,6 +30,7 @@
 #include "StatsVideoSourceImpl.h"
 #include "Utils.h"
 #include <cassert>
+#include <utility>
 
 namespace
 {
@@ -118,6 +119,32 @@ Stats StatsReport::get(size_t index) const
     return {};
 }
 
+StatsView StatsReport::view(const std::string& id) const
+{
+    if (_data && _data->_data) {
+        return StatsView(_data->_data->Get(id));
+    }
+    return {};
+}
+
+size_t StatsReport::count(StatsType type) const
+{
+    size_t count = 0U;
+    if (_data && _data->_data) {
+        if (StatsType::Uknown == type) {
+            count = _data->_data->size();
+        }
+        else {
+            for (const auto& stats : *_data->_data) {
+                if (type == toStatsType(stats.type())) {
+                    ++count;
+                }
+            }
+        }
+    }
+    return count;
+}
+
 std::string StatsReport::json() const
 {
     if (_data && _data->_data) {
@@ -126,10 +153,21 @@ std::string StatsReport::json() const
     return {};
 }
 
+void StatsReport::forEach(StatsType type, void(*callback)(void*, const StatsView&), void* context) const
+{
+    if (callback && _data && _data->_data) {
+        for (const auto& stats : *_data->_data) {
+            if (StatsType::Uknown == type || type == toStatsType(stats.type())) {
+                callback(context, StatsView(&stats));
+            }
+        }
+    }
+}
+
 std::chrono::time_point<std::chrono::system_clock> StatsReportData::map(const webrtc::Timestamp& t)
 {
     using namespace std::chrono;
-    const auto us = duration_cast<system_clock::duration>(nanoseconds(t.us()));
+    const auto us = duration_cast<system_clock::duration>(microseconds(t.us()));
     return time_point<system_clock>(us);
 }
 
@@ -176,7 +214,7 @@ std::string toString(StatsType type)
 StatsType StatsData::type() const
 {
     if (const auto stats = rtcStats()) {
-        return toStatsType(stats->id());
+        return toStatsType(stats->type());
     }
     return StatsType::Uknown;
 }
@@ -184,25 +222,26 @@ StatsType StatsData::type() const
 StatsType toStatsType(std::string_view type)
 {
     if (!type.empty()) {
-        static const StatsType statTypes [] = {
-            StatsType::Codec,
-            StatsType::InboundRtp,
-            StatsType::OutboundRtp,
-            StatsType::RemoteInboundRtp,
-            StatsType::RemoteOutboundRtp,
-            StatsType::MediaSource,
-            StatsType::MediaPlayout,
-            StatsType::PeerConnection,
-            StatsType::DataChannel,
-            StatsType::Transport,
-            StatsType::CandidatePair,
-            StatsType::LocalCandidate,
-            StatsType::RemoteCandidate,
-            StatsType::Certificate
+        // must be in sync with toString(StatsType), no allocations during lookup
+        static constexpr std::pair<std::string_view, StatsType> statTypes [] = {
+            {"codec", StatsType::Codec},
+            {"inbound-rtp", StatsType::InboundRtp},
+            {"outbound-rtp", StatsType::OutboundRtp},
+            {"remote-inbound-rtp", StatsType::RemoteInboundRtp},
+            {"remote-outbound-rtp", StatsType::RemoteOutboundRtp},
+            {"media-source", StatsType::MediaSource},
+            {"media-playout", StatsType::MediaPlayout},
+            {"peer-connection", StatsType::PeerConnection},
+            {"data-channel", StatsType::DataChannel},
+            {"transport", StatsType::Transport},
+            {"candidate-pair", StatsType::CandidatePair},
+            {"local-candidate", StatsType::LocalCandidate},
+            {"remote-candidate", StatsType::RemoteCandidate},
+            {"certificate", StatsType::Certificate}
         };
-        for (auto statType : statTypes) {
-            if (compareCaseSensitive(type, toString(statType))) {
-                return statType;
+        for (const auto& statType : statTypes) {
+            if (compareCaseSensitive(type, statType.first)) {
+                return statType.second;
             }
         }
     }
@@ -0,0 +1,129 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "StatsSeries.h"
+
+namespace {
+
+// counters are reset if stream was re-created with the same ID
+template <typename T>
+inline T counterDelta(T current, T previous) {
+    return current >= previous ? current - previous : current;
+}
+
+inline double seconds(const std::chrono::time_point<std::chrono::system_clock>& from,
+                      const std::chrono::time_point<std::chrono::system_clock>& to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+}
+
+namespace LiveKitCpp
+{
+
+StatsSeries::StatsSeries(std::string id, StatsType type, size_t capacity)
+    : _samples(capacity ? capacity : 2U)
+{
+    _lastDelta._id = std::move(id);
+    _lastDelta._type = type;
+}
+
+bool StatsSeries::add(const StatsSample& sample)
+{
+    bool changed = false;
+    if (_size) {
+        const auto& prev = at(_size - 1U);
+        const auto interval = seconds(prev._timestamp, sample._timestamp);
+        auto& delta = _lastDelta;
+        if (interval <= 0.) {
+            // the same report delivered twice
+            return false;
+        }
+        delta._timestamp = sample._timestamp;
+        delta._interval = interval;
+        delta._bytes = counterDelta(sample._bytes, prev._bytes);
+        delta._packets = counterDelta(sample._packets, prev._packets);
+        delta._packetsLost = sample._packetsLost - prev._packetsLost;
+        delta._frames = counterDelta(sample._frames, prev._frames);
+        delta._bitrate = delta._bytes * 8. / interval;
+        delta._fps = delta._frames / interval;
+        delta._packetLoss.reset();
+        if (sample._fractionLost) {
+            delta._packetLoss = sample._fractionLost.value() * 100.;
+        }
+        else if (StatsType::InboundRtp == delta._type && delta._packetsLost >= 0) {
+            // packets lost are reported by receiver only
+            const auto expected = delta._packets + uint64_t(delta._packetsLost);
+            if (expected) {
+                delta._packetLoss = delta._packetsLost * 100. / expected;
+            }
+        }
+        delta._jitter = sample._jitter;
+        delta._roundTripTime = sample._roundTripTime;
+        changed = delta._bytes || delta._packets || delta._packetsLost || delta._frames ||
+                  sample._jitter != prev._jitter || sample._roundTripTime != prev._roundTripTime;
+    }
+    // append
+    _samples[(_head + _size) % _samples.size()] = sample;
+    if (_size < _samples.size()) {
+        ++_size;
+    }
+    else {
+        _head = (_head + 1U) % _samples.size();
+    }
+    if (_size > 1U) {
+        _lastDelta._jitterTrend = jitterTrend();
+    }
+    return changed;
+}
+
+std::vector<StatsSample> StatsSeries::history() const
+{
+    std::vector<StatsSample> samples;
+    samples.reserve(_size);
+    for (size_t i = 0U; i < _size; ++i) {
+        samples.push_back(at(i));
+    }
+    return samples;
+}
+
+const StatsSample& StatsSeries::at(size_t index) const
+{
+    return _samples[(_head + index) % _samples.size()];
+}
+
+std::optional<double> StatsSeries::jitterTrend() const
+{
+    // least squares slope of jitter over time
+    double n = 0., sumX = 0., sumY = 0., sumXY = 0., sumXX = 0.;
+    const auto& origin = at(0U)._timestamp;
+    for (size_t i = 0U; i < _size; ++i) {
+        const auto& sample = at(i);
+        if (sample._jitter) {
+            const auto x = seconds(origin, sample._timestamp);
+            const auto y = sample._jitter.value();
+            n += 1.;
+            sumX += x;
+            sumY += y;
+            sumXY += x * y;
+            sumXX += x * x;
+        }
+    }
+    const auto denominator = n * sumXX - sumX * sumX;
+    if (n >= 2. && denominator > 0.) {
+        return (n * sumXY - sumX * sumY) / denominator;
+    }
+    return std::nullopt;
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,46 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // StatsSeries.h
+#include "livekit/rtc/stats/StatsSample.h"
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// fixed-size ring of samples of one stats object, storage is allocated once
+class StatsSeries
+{
+public:
+    StatsSeries(std::string id, StatsType type, size_t capacity);
+    StatsType type() const noexcept { return _lastDelta._type; }
+    size_t size() const noexcept { return _size; }
+    // updates the last delta, returns true if counters were changed since the previous sample
+    bool add(const StatsSample& sample);
+    std::vector<StatsSample> history() const;
+    const StatsDelta& lastDelta() const noexcept { return _lastDelta; }
+    // number of the poll when stats object was seen last time
+    uint64_t _lastPoll = 0ULL;
+    // delta is not taken by consumer yet
+    bool _pending = false;
+private:
+    const StatsSample& at(size_t index) const; // 0 - oldest
+    std::optional<double> jitterTrend() const;
+private:
+    std::vector<StatsSample> _samples;
+    size_t _head = 0U;
+    size_t _size = 0U;
+    StatsDelta _lastDelta;
+};
+
+} // namespace LiveKitCpp
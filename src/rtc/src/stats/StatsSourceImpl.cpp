@@ -18,6 +18,11 @@
 namespace LiveKitCpp
 {
 
+StatsSourceImpl::StatsSourceImpl(std::shared_ptr<StatsListener> target)
+    : _target(std::move(target))
+{
+}
+
 void StatsSourceImpl::addListener(StatsListener* listener)
 {
     _listeners.add(listener);
@@ -30,9 +35,14 @@ void StatsSourceImpl::removeListener(StatsListener* listener)
 
 void StatsSourceImpl::OnStatsDelivered(const webrtc::scoped_refptr<const webrtc::RTCStatsReport>& rtcReport)
 {
-    if (rtcReport && _listeners && rtcReport->size()) {
-        const StatsReport report(new StatsReportData{rtcReport});
-        _listeners.invoke(&StatsListener::onStats, report);
+    if (rtcReport && rtcReport->size()) {
+        if (_target) {
+            _target->onStats(StatsReport(new StatsReportData{rtcReport}));
+        }
+        else if (_listeners) {
+            const StatsReport report(new StatsReportData{rtcReport});
+            _listeners.invoke(&StatsListener::onStats, report);
+        }
     }
 }
 
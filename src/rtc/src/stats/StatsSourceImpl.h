@@ -14,6 +14,7 @@
 #pragma once // StatsSourceImpl.h
 #include "Listeners.h"
 #include <api/stats/rtc_stats_collector_callback.h>
+#include <memory>
 
 namespace LiveKitCpp
 {
@@ -24,6 +25,8 @@ class StatsSourceImpl : public webrtc::RTCStatsCollectorCallback
 {
 public:
     StatsSourceImpl() = default;
+    // callback of single query, reports are delivered only to [target]
+    explicit StatsSourceImpl(std::shared_ptr<StatsListener> target);
     // impl. of StatsSource
     void addListener(StatsListener* listener);
     void removeListener(StatsListener* listener);
@@ -31,6 +34,7 @@ public:
     // impl. of webrtc::RTCStatsCollectorCallback
     void OnStatsDelivered(const webrtc::scoped_refptr<const webrtc::RTCStatsReport>& rtcReport) final;
 private:
+    const std::shared_ptr<StatsListener> _target;
     Bricks::Listeners<StatsListener*> _listeners;
 };
 
@@ -0,0 +1,81 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/stats/StatsView.h"
+#include "StatsAttributeTable.h"
+#include "StatsReportData.h"
+
+namespace LiveKitCpp
+{
+
+const std::string& StatsView::id() const
+{
+    static const std::string empty;
+    return _stats ? _stats->id() : empty;
+}
+
+std::chrono::time_point<std::chrono::system_clock> StatsView::timestamp() const
+{
+    if (_stats) {
+        return StatsReportData::map(_stats->timestamp());
+    }
+    return {};
+}
+
+StatsType StatsView::type() const
+{
+    if (_stats) {
+        return toStatsType(_stats->type());
+    }
+    return StatsType::Uknown;
+}
+
+std::string_view StatsView::name() const
+{
+    if (_stats) {
+        return _stats->type();
+    }
+    return {};
+}
+
+size_t StatsView::attributesCount() const
+{
+    if (_stats) {
+        return statsAttributeTable(*_stats)._entries.size();
+    }
+    return 0U;
+}
+
+StatsAttribute StatsView::attribute(size_t index) const
+{
+    if (_stats) {
+        const auto& entries = statsAttributeTable(*_stats)._entries;
+        if (index < entries.size()) {
+            const auto& entry = entries[index];
+            return StatsAttribute(entry._name, makeStatsAttributeValue(*_stats, entry));
+        }
+    }
+    return {};
+}
+
+StatsAttribute StatsView::attribute(std::string_view name) const
+{
+    if (_stats) {
+        if (const auto entry = statsAttributeTable(*_stats).find(name)) {
+            return StatsAttribute(entry->_name, makeStatsAttributeValue(*_stats, *entry));
+        }
+    }
+    return {};
+}
+
+} // namespace LiveKitCpp
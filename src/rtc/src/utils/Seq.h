@@ -15,6 +15,8 @@
 #include <algorithm>
 #include <iterator>
 #include <set>
+#include <type_traits>
+#include <unordered_set>
 
 namespace LiveKitCpp
 {
@@ -22,7 +24,8 @@ namespace LiveKitCpp
 /**
  * @brief A utility class that provides methods for computing differences and intersections
  *        of non-sorted ranges. Unlike std::set_difference and std::set_intersection, these
- *        methods work with unsorted input ranges.
+ *        methods work with unsorted input ranges. Keyed variants (*By) are hash-based and
+ *        take O(N + M) instead of O(N * M).
  *
  * @tparam T The type of elements in the input ranges.
  */
@@ -116,6 +119,47 @@ public:
         }
         return {};
     }
+    /**
+     * @brief Computes the elements from the first range whose keys are not found in the second range.
+     *
+     * @tparam TIn The template type of the input range (e.g., std::vector or other container).
+     * @tparam TOut The template type of the output range (defaults to the same type as TIn).
+     * @tparam TKeyOf The functor returning a hashable key of element.
+     * @param range1 The first input range.
+     * @param range2 The second input range.
+     * @param keyOf The key extractor, keys should be stable while the call.
+     * @return A range of elements that are in range1 but not in range2, order of range1 is preserved.
+     */
+    template <template <typename, typename...> class TIn,
+              template <typename, typename...> class TOut = TIn,
+              class TKeyOf>
+    static TOut<T> differenceBy(const TIn<T>& range1, const TIn<T>& range2, TKeyOf keyOf) {
+        if (&range1 != &range2 && !range1.empty()) {
+            if (range2.empty()) {
+                return TOut<T>(std::begin(range1), std::end(range1));
+            }
+            const auto keys = makeKeys(range2, keyOf);
+            TOut<T> result;
+            for (const auto& element : range1) {
+                if (0U == keys.count(keyOf(element))) {
+                    result.push_back(element);
+                }
+            }
+            return result;
+        }
+        return {};
+    }
+private:
+    template <class TRange, class TKeyOf>
+    static auto makeKeys(const TRange& range, const TKeyOf& keyOf) {
+        using KeyType = std::decay_t<std::invoke_result_t<TKeyOf, const T&>>;
+        std::unordered_set<KeyType> keys;
+        keys.reserve(std::size(range));
+        for (const auto& element : range) {
+            keys.insert(keyOf(element));
+        }
+        return keys;
+    }
 };
 
 } // namespace LiveKitCpp
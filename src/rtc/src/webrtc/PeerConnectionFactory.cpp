@@ -96,7 +96,8 @@ public:
     bool setRecordingMute(bool mute);
     bool setPlayoutMute(bool mute);
     // impl. of AdmProxyFacade
-    void registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg) final;
+    void registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg,
+                               size_t bufferedFrames) final;
     void registerRecordingListener(AdmProxyListener* l, bool reg) final;
     void registerPlayoutListener(AdmProxyListener* l, bool reg) final;
     const AdmProxyState& recordingState() const final { return _admProxy->recordingState(); }
@@ -154,7 +155,8 @@ PeerConnectionFactory::~PeerConnectionFactory()
 
 webrtc::scoped_refptr<PeerConnectionFactory> PeerConnectionFactory::
     create(std::unique_ptr<webrtc::FieldTrialsView> trials,
-           const std::shared_ptr<Bricks::Logger>& logger)
+           const std::shared_ptr<Bricks::Logger>& logger,
+           std::optional<VirtualAudioOptions> virtualAudio)
 {
     //create threads for peer connection factory
     //See also https://webrtc.org/native-code/native-apis/#threading-model
@@ -189,7 +191,8 @@ webrtc::scoped_refptr<PeerConnectionFactory> PeerConnectionFactory::
     const auto audioDecoderFactory = dependencies.audio_decoder_factory.get();
     
     auto admProxy = AdmProxy::create(workingThread, signalingThread,
-                                     dependencies.task_queue_factory.get());
+                                     dependencies.task_queue_factory.get(),
+                                     std::move(virtualAudio));
     AudioProcessingController apController;
     dependencies.audio_processing_builder = std::make_unique<AudioProcessingBuilder>(apController);
     dependencies.adm = admProxy;
@@ -365,6 +368,11 @@ bool PeerConnectionFactory::audioPlayoutProcessingEnabled() const
     return _apController.playProcessingEnabled();
 }
 
+float PeerConnectionFactory::audioRecordingVoiceProbability() const
+{
+    return _apController.recVoiceProbability();
+}
+
 void PeerConnectionFactory::setRecordingFramesWriter(AudioFramesWriter* writer)
 {
     _apController.setRecWriter(writer);
@@ -503,9 +511,9 @@ bool PeerConnectionFactory::AdmFacade::setPlayoutMute(bool mute)
 }
 
 void PeerConnectionFactory::AdmFacade::registerRecordingSink(webrtc::AudioTrackSinkInterface* sink,
-                                                             bool reg)
+                                                             bool reg, size_t bufferedFrames)
 {
-    _admProxy->registerRecordingSink(sink, reg);
+    _admProxy->registerRecordingSink(sink, reg, bufferedFrames);
 }
 
 void PeerConnectionFactory::AdmFacade::registerRecordingListener(AdmProxyListener* l,
@@ -15,6 +15,7 @@
 #include "AudioProcessingController.h"
 #include "AdmProxyListener.h"
 #include "livekit/rtc/media/MediaDeviceInfo.h"
+#include "livekit/rtc/media/VirtualAudioOptions.h"
 #include <api/peer_connection_interface.h>
 #include <rtc_base/thread.h>
 #include <memory>
@@ -53,7 +54,8 @@ class PeerConnectionFactory : public webrtc::PeerConnectionFactoryInterface,
 public:
     ~PeerConnectionFactory() override;
     static webrtc::scoped_refptr<PeerConnectionFactory> create(std::unique_ptr<webrtc::FieldTrialsView> trials = {},
-                                                               const std::shared_ptr<Bricks::Logger>& logger = {});
+                                                               const std::shared_ptr<Bricks::Logger>& logger = {},
+                                                               std::optional<VirtualAudioOptions> virtualAudio = std::nullopt);
     const auto& eventsQueue() const noexcept { return _eventsQueue; }
     std::weak_ptr<webrtc::Thread> signalingThread() const noexcept { return _signalingThread; }
     std::weak_ptr<AdmProxyFacade> admProxy() const;
@@ -79,6 +81,7 @@ public:
     void enableAudioPlayoutProcessing(bool enable);
     bool audioRecordingProcessingEnabled() const;
     bool audioPlayoutProcessingEnabled() const;
+    float audioRecordingVoiceProbability() const;
     void setRecordingFramesWriter(AudioFramesWriter* writer = nullptr);
     void setPlayoutFramesWriter(AudioFramesWriter* writer = nullptr);
     // impl. of webrtc::PeerConnectionFactoryInterface
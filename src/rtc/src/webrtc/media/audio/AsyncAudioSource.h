@@ -30,6 +30,7 @@ public:
     AsyncAudioSource(std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
                      const std::shared_ptr<Bricks::Logger>& logger,
                      Args&&... args);
+    AsyncAudioSource(std::shared_ptr<TAsyncImpl> impl);
     bool signalLevel(int& level) const;
     void addListener(MediaDeviceListener* listener);
     void removeListener(MediaDeviceListener* listener);
@@ -51,6 +52,12 @@ inline AsyncAudioSource<TAsyncImpl>::AsyncAudioSource(std::weak_ptr<webrtc::Task
 {
 }
 
+template <class TAsyncImpl>
+inline AsyncAudioSource<TAsyncImpl>::AsyncAudioSource(std::shared_ptr<TAsyncImpl> impl)
+    : Base(std::move(impl))
+{
+}
+
 template <class TAsyncImpl>
 inline bool AsyncAudioSource<TAsyncImpl>::signalLevel(int& level) const
 {
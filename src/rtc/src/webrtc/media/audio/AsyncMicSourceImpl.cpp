@@ -45,7 +45,8 @@ void AsyncMicSourceImpl::addSink(webrtc::AudioTrackSinkInterface* sink)
 {
     if (const auto sinks = dynamic_cast<AudioSinks*>(sink)) {
         if (const auto admp = adm()) {
-            admp->registerRecordingSink(sink, true);
+            // local sinks (recorders, analyzers) may be slow, keep them off the audio thread
+            admp->registerRecordingSink(sink, true, _sinkBufferedFrames);
         }
     }
 }
@@ -54,7 +55,7 @@ void AsyncMicSourceImpl::removeSink(webrtc::AudioTrackSinkInterface* sink)
 {
     if (const auto sinks = dynamic_cast<AudioSinks*>(sink)) {
         if (const auto admp = adm()) {
-            admp->registerRecordingSink(sink, false);
+            admp->registerRecordingSink(sink, false, 0U);
         }
     }
 }
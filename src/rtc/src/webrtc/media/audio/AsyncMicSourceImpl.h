@@ -38,6 +38,8 @@ public:
     void removeSink(webrtc::AudioTrackSinkInterface* sink) final;
     webrtc::AudioOptions options() const final { return _options; }
 private:
+    // 500 ms
+    static constexpr size_t _sinkBufferedFrames = 50U;
     std::shared_ptr<AdmProxyFacade> adm() const noexcept { return _admProxy.lock(); }
     // impl. of AdmProxyListener
     void onMinMaxVolumeChanged(bool, uint32_t minVolume, uint32_t maxVolume) final;
@@ -0,0 +1,101 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AudioFramesRing.h
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// lock-free ring of audio frames for single producer & single consumer,
+// slots are preallocated, so the producer doesn't allocate in the steady state
+class AudioFramesRing
+{
+public:
+    struct Frame
+    {
+        std::vector<int16_t> _samples; // interleaved
+        int _sampleRate = 0;
+        size_t _channels = 0U;
+        size_t _frames = 0U;
+        std::optional<int64_t> _absoluteCaptureTimestampMs;
+    };
+public:
+    // [reservedSamples] - 10 ms of 96 kHz stereo by default
+    AudioFramesRing(size_t capacity, size_t reservedSamples = 1920U);
+    size_t capacity() const noexcept { return _slots.size(); }
+    bool empty() const noexcept;
+    // producer side, returns false if ring is full
+    bool push(const int16_t* samples, int sampleRate, size_t channels, size_t frames,
+              std::optional<int64_t> absoluteCaptureTimestampMs = std::nullopt);
+    // consumer side, null if ring is empty, the frame is valid until [pop]
+    const Frame* front() const;
+    void pop();
+private:
+    std::vector<Frame> _slots;
+    // monotonic counters, index of slot is counter % capacity
+    std::atomic<size_t> _head = 0U; // written by producer only
+    std::atomic<size_t> _tail = 0U; // written by consumer only
+};
+
+inline AudioFramesRing::AudioFramesRing(size_t capacity, size_t reservedSamples)
+    : _slots(capacity ? capacity : 1U)
+{
+    for (auto& slot : _slots) {
+        slot._samples.reserve(reservedSamples);
+    }
+}
+
+inline bool AudioFramesRing::empty() const noexcept
+{
+    return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+}
+
+inline bool AudioFramesRing::push(const int16_t* samples, int sampleRate, size_t channels, size_t frames,
+                                  std::optional<int64_t> absoluteCaptureTimestampMs)
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= _slots.size()) {
+        return false;
+    }
+    auto& slot = _slots[head % _slots.size()];
+    slot._samples.assign(samples, samples + channels * frames);
+    slot._sampleRate = sampleRate;
+    slot._channels = channels;
+    slot._frames = frames;
+    slot._absoluteCaptureTimestampMs = std::move(absoluteCaptureTimestampMs);
+    _head.store(head + 1U, std::memory_order_release);
+    return true;
+}
+
+inline const AudioFramesRing::Frame* AudioFramesRing::front() const
+{
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    if (tail != _head.load(std::memory_order_acquire)) {
+        return &_slots[tail % _slots.size()];
+    }
+    return nullptr;
+}
+
+inline void AudioFramesRing::pop()
+{
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    if (tail != _head.load(std::memory_order_acquire)) {
+        _tail.store(tail + 1U, std::memory_order_release);
+    }
+}
+
+} // namespace LiveKitCpp
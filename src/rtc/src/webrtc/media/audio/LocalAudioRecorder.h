@@ -33,11 +33,14 @@ public:
                        std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
                        const std::shared_ptr<Bricks::Logger>& logger,
                        Args&&... args);
+    LocalAudioRecorder(const std::string& id, webrtc::scoped_refptr<Source> source);
     template <typename... Args>
     static webrtc::scoped_refptr<LocalAudioRecorder>
         create(std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
                const std::shared_ptr<Bricks::Logger>& logger,
                Args&&... args);
+    // for sources created before of track
+    static webrtc::scoped_refptr<LocalAudioRecorder> create(std::shared_ptr<TAsyncImpl> impl);
     // impl. of ListenedAudio
     void addListener(MediaDeviceListener* listener) final;
     void removeListener(MediaDeviceListener* listener) final;
@@ -73,6 +76,14 @@ inline LocalAudioRecorder<TAsyncImpl>::LocalAudioRecorder(const std::string& id,
 {
 }
 
+template <class TAsyncImpl>
+inline LocalAudioRecorder<TAsyncImpl>::LocalAudioRecorder(const std::string& id,
+                                                          webrtc::scoped_refptr<Source> source)
+    : _id(id)
+    , _source(std::move(source))
+{
+}
+
 template <class TAsyncImpl>
 template <typename... Args>
 inline webrtc::scoped_refptr<LocalAudioRecorder<TAsyncImpl>>
@@ -87,6 +98,17 @@ inline webrtc::scoped_refptr<LocalAudioRecorder<TAsyncImpl>>
                                           std::forward<Args>(args)...);
 }
 
+template <class TAsyncImpl>
+inline webrtc::scoped_refptr<LocalAudioRecorder<TAsyncImpl>>
+    LocalAudioRecorder<TAsyncImpl>::create(std::shared_ptr<TAsyncImpl> impl)
+{
+    if (impl) {
+        using Type = LocalAudioRecorder<TAsyncImpl>;
+        return webrtc::make_ref_counted<Type>(makeUuid(), webrtc::make_ref_counted<Source>(std::move(impl)));
+    }
+    return {};
+}
+
 template <class TAsyncImpl>
 inline void LocalAudioRecorder<TAsyncImpl>::addListener(MediaDeviceListener* listener)
 {
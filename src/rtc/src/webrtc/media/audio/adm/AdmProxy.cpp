@@ -20,6 +20,7 @@
 #include "Logger.h"
 #include "Utils.h"
 #include "ThreadUtils.h"
+#include "VirtualAdm.h"
 #include <api/make_ref_counted.h>
 #include <rtc_base/thread.h>
 #ifdef WEBRTC_WIN
@@ -109,10 +110,14 @@ AdmProxy::~AdmProxy()
 webrtc::scoped_refptr<AdmProxy> AdmProxy::
     create(const std::shared_ptr<webrtc::Thread>& workingThread,
            const std::shared_ptr<webrtc::TaskQueueBase>& signalingQueue,
-           webrtc::TaskQueueFactory* taskQueueFactory)
+           webrtc::TaskQueueFactory* taskQueueFactory,
+           std::optional<VirtualAudioOptions> virtualAudio)
 {
     if (workingThread && signalingQueue) {
-        auto impl = invokeInThreadR(workingThread.get(), [taskQueueFactory](){
+        auto impl = invokeInThreadR(workingThread.get(), [taskQueueFactory, &virtualAudio]() -> AdmPtr {
+            if (virtualAudio) {
+                return webrtc::make_ref_counted<VirtualAdm>(std::move(virtualAudio.value()));
+            }
             return defaultAdm(taskQueueFactory);
         });
         if (impl) {
@@ -694,12 +699,13 @@ void AdmProxy::close()
     }
 }
 
-void AdmProxy::registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg)
+void AdmProxy::registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg,
+                                     size_t bufferedFrames)
 {
     LOCK_READ_SAFE_OBJ(_transport);
     if (const auto& transport = _transport.constRef()) {
         if (reg) {
-            transport->addSink(sink);
+            transport->addSink(sink, bufferedFrames);
         }
         else {
             transport->removeSink(sink);
@@ -18,8 +18,10 @@
 #include "SafeScopedRefPtr.h"
 #include "SafeObjAliases.h"
 #include "livekit/rtc/media/MediaDeviceInfo.h"
+#include "livekit/rtc/media/VirtualAudioOptions.h"
 #include <api/function_view.h>
 #include <modules/audio_device/include/audio_device.h> //AudioDeviceModule
+#include <optional>
 #include <type_traits>
 
 namespace webrtc {
@@ -41,7 +43,8 @@ public:
     static webrtc::scoped_refptr<AdmProxy>
         create(const std::shared_ptr<webrtc::Thread>& workingThread,
                const std::shared_ptr<webrtc::TaskQueueBase>& signalingQueue,
-               webrtc::TaskQueueFactory* taskQueueFactory);
+               webrtc::TaskQueueFactory* taskQueueFactory,
+               std::optional<VirtualAudioOptions> virtualAudio = std::nullopt);
     // impl. of webrtc::AudioDeviceModule
     // Retrieve the currently utilized audio layer
     int32_t ActiveAudioLayer(AudioLayer* audioLayer) const final;
@@ -142,7 +145,7 @@ public:
     const AdmProxyState& recordingState() const noexcept { return _recState; }
     const AdmProxyState& playoutState() const noexcept { return _playState; }
     void close();
-    void registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg);
+    void registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg, size_t bufferedFrames = 0U);
     void registerRecordingListener(AdmProxyListener* l, bool reg);
     void registerPlayoutListener(AdmProxyListener* l, bool reg);
     // selection management
@@ -13,6 +13,8 @@
 // limitations under the License.
 #pragma once // AdmProxyFacade.h
 #include "AdmProxyState.h"
+#include <cstddef>
+#include <cstdint>
 
 namespace webrtc {
 class AudioTrackSinkInterface;
@@ -26,7 +28,9 @@ class AdmProxyListener;
 class AdmProxyFacade
 {
 public:
-    virtual void registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg) = 0;
+    // [bufferedFrames] > 0 - sink is invoked on own thread, not on the real-time audio thread
+    virtual void registerRecordingSink(webrtc::AudioTrackSinkInterface* sink, bool reg,
+                                       size_t bufferedFrames) = 0;
     virtual void registerRecordingListener(AdmProxyListener* l, bool reg) = 0;
     virtual void registerPlayoutListener(AdmProxyListener* l, bool reg) = 0;
     virtual const AdmProxyState& recordingState() const = 0;
@@ -12,32 +12,144 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "AdmProxyTransport.h"
+#include "BufferedAudioSink.h"
 #include <api/media_stream_interface.h>
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+// depth of audio callbacks on the current thread
+thread_local uint32_t g_callbackDepth = 0U;
+
+}
 
 namespace LiveKitCpp
 {
 
+struct AdmProxyTransport::Sink
+{
+    webrtc::AudioTrackSinkInterface* _sink = nullptr;
+    // null for direct invocation
+    std::shared_ptr<BufferedAudioSink> _buffered;
+};
+
+// callbacks of one direction are counted in one of 2 slots selected by the epoch,
+// grace period flips the epoch & waits only for callbacks which entered the previous slot
+class AdmProxyTransport::Epoch
+{
+public:
+    Epoch() = default;
+    // returns slot of callback
+    uint32_t enter();
+    void leave(uint32_t slot);
+    // returns when callbacks started before of this call are completed,
+    // doesn't wait if called from callback (sink removes itself)
+    void synchronize();
+private:
+    std::atomic<uint32_t> _epoch = 0U;
+    std::atomic<uint32_t> _readers[2] = {};
+    // serializes grace periods
+    std::mutex _mutex;
+};
+
+class AdmProxyTransport::CallbackScope
+{
+public:
+    CallbackScope(Epoch& epoch);
+    ~CallbackScope();
+private:
+    Epoch& _epoch;
+    const uint32_t _slot;
+};
+
+AdmProxyTransport::AdmProxyTransport()
+    : _recordingCallbacks(std::make_unique<Epoch>())
+    , _playoutCallbacks(std::make_unique<Epoch>())
+{
+}
+
+AdmProxyTransport::~AdmProxyTransport()
+{
+    close();
+}
+
 void AdmProxyTransport::setTargetTransport(webrtc::AudioTransport* transport)
 {
     if (this != transport) {
-        _targetTransport(transport);
+        if (transport != _targetTransport.exchange(transport)) {
+            _recordingCallbacks->synchronize();
+            _playoutCallbacks->synchronize();
+        }
     }
 }
 
-void AdmProxyTransport::addSink(webrtc::AudioTrackSinkInterface* sink)
+void AdmProxyTransport::addSink(webrtc::AudioTrackSinkInterface* sink, size_t bufferedFrames)
 {
-    _sinks.add(sink);
+    if (sink) {
+        RetiredSinks retired;
+        {
+            const std::lock_guard lock(_sinksMutex);
+            const auto current = _sinks.load();
+            auto sinks = current ? std::make_unique<Sinks>(*current) : std::make_unique<Sinks>();
+            const auto it = std::find_if(sinks->begin(), sinks->end(),
+                                         [sink](const Sink& s) { return s._sink == sink; });
+            if (it == sinks->end()) {
+                Sink entry;
+                entry._sink = sink;
+                if (bufferedFrames) {
+                    entry._buffered = std::make_shared<BufferedAudioSink>(sink, bufferedFrames);
+                }
+                sinks->push_back(std::move(entry));
+                retired = publishSinks(std::move(sinks));
+            }
+        }
+        releaseSinks(std::move(retired));
+    }
 }
 
 void AdmProxyTransport::removeSink(webrtc::AudioTrackSinkInterface* sink)
 {
-    _sinks.remove(sink);
+    if (sink) {
+        std::shared_ptr<BufferedAudioSink> buffered;
+        RetiredSinks retired;
+        {
+            const std::lock_guard lock(_sinksMutex);
+            const auto current = _sinks.load();
+            if (!current) {
+                return;
+            }
+            auto sinks = std::make_unique<Sinks>(*current);
+            const auto it = std::find_if(sinks->begin(), sinks->end(),
+                                         [sink](const Sink& s) { return s._sink == sink; });
+            if (it == sinks->end()) {
+                return;
+            }
+            buffered = std::move(it->_buffered);
+            sinks->erase(it);
+            retired = publishSinks(std::move(sinks));
+        }
+        releaseSinks(std::move(retired));
+        if (buffered) {
+            // old list may be retired and still refers to the buffered sink,
+            // so the thread may be joined later, but the current delivery is waited here
+            buffered->stop();
+        }
+    }
 }
 
 void AdmProxyTransport::close()
 {
-    _targetTransport(nullptr);
-    _sinks.clear();
+    setTargetTransport(nullptr);
+    RetiredSinks retired;
+    {
+        const std::lock_guard lock(_sinksMutex);
+        if (_sinks.load()) {
+            retired = publishSinks({});
+        }
+    }
+    releaseSinks(std::move(retired));
 }
 
 int32_t AdmProxyTransport::RecordedDataIsAvailable(const void* audioSamples,
@@ -70,9 +182,9 @@ int32_t AdmProxyTransport::RecordedDataIsAvailable(const void* audioSamples,
                                                    uint32_t& newMicLevel,
                                                    std::optional<int64_t> estimatedCaptureTimeNS)
 {
+    const CallbackScope scope(*_recordingCallbacks);
     int32_t res = -1;
-    LOCK_READ_SAFE_OBJ(_targetTransport);
-    if (const auto transport = _targetTransport.constRef()) {
+    if (const auto transport = _targetTransport.load()) {
         res = transport->RecordedDataIsAvailable(audioSamples, nSamples,
                                                  nBytesPerSample, nChannels,
                                                  samplesPerSec, totalDelayMS,
@@ -81,14 +193,25 @@ int32_t AdmProxyTransport::RecordedDataIsAvailable(const void* audioSamples,
                                                  estimatedCaptureTimeNS);
     }
     if (0 == res) {
-        std::optional<int64_t> absoluteCaptureTimestampMs;
-        if (estimatedCaptureTimeNS.has_value()) {
-            absoluteCaptureTimestampMs = estimatedCaptureTimeNS.value() / 1000000U;
+        const auto sinks = _sinks.load();
+        if (sinks && !sinks->empty()) {
+            std::optional<int64_t> absoluteCaptureTimestampMs;
+            if (estimatedCaptureTimeNS.has_value()) {
+                absoluteCaptureTimestampMs = estimatedCaptureTimeNS.value() / 1000000U;
+            }
+            // [nBytesPerSample] is the size of frame (all channels)
+            const auto bitsPerSample = int(nBytesPerSample * 8U / std::max<size_t>(nChannels, 1U));
+            for (const auto& sink : *sinks) {
+                if (sink._buffered) {
+                    sink._buffered->push(audioSamples, bitsPerSample, int(samplesPerSec),
+                                         nChannels, nSamples, absoluteCaptureTimestampMs);
+                }
+                else {
+                    sink._sink->OnData(audioSamples, bitsPerSample, int(samplesPerSec),
+                                       nChannels, nSamples, absoluteCaptureTimestampMs);
+                }
+            }
         }
-        _sinks.invoke<SinkRender>(&webrtc::AudioTrackSinkInterface::OnData,
-                                  audioSamples, int(nBytesPerSample * 8U),
-                                  int(samplesPerSec), nChannels, nSamples,
-                                  absoluteCaptureTimestampMs);
     }
     return res;
 }
@@ -102,8 +225,8 @@ int32_t AdmProxyTransport::NeedMorePlayData(size_t nSamples,
                                             int64_t* elapsedTimeMs,
                                             int64_t* ntpTimeMs)
 {
-    LOCK_READ_SAFE_OBJ(_targetTransport);
-    if (const auto transport = _targetTransport.constRef()) {
+    const CallbackScope scope(*_playoutCallbacks);
+    if (const auto transport = _targetTransport.load()) {
         return transport->NeedMorePlayData(nSamples, nBytesPerSample,
                                            nChannels, samplesPerSec,
                                            audioSamples, nSamplesOut,
@@ -117,13 +240,75 @@ void AdmProxyTransport::PullRenderData(int bitsPerSample, int sampleRate,
                                        size_t numberOfFrames, void* audioData,
                                        int64_t* elapsedTimeMs, int64_t* ntpTimeMs)
 {
-    LOCK_READ_SAFE_OBJ(_targetTransport);
-    if (const auto transport = _targetTransport.constRef()) {
+    const CallbackScope scope(*_playoutCallbacks);
+    if (const auto transport = _targetTransport.load()) {
         transport->PullRenderData(bitsPerSample, sampleRate,
                                   numberOfChannels, numberOfFrames,
                                   audioData, elapsedTimeMs, ntpTimeMs);
     }
 }
 
+AdmProxyTransport::RetiredSinks AdmProxyTransport::publishSinks(std::unique_ptr<Sinks> sinks)
+{
+    std::unique_ptr<const Sinks> old(_sinks.exchange(sinks.release()));
+    if (old) {
+        _retiredSinks.push_back(std::move(old));
+    }
+    if (g_callbackDepth > 0U) {
+        // sink changes the list from audio callback, the old list may be in use right now
+        return {};
+    }
+    return std::move(_retiredSinks);
+}
+
+void AdmProxyTransport::releaseSinks(RetiredSinks sinks) const
+{
+    if (!sinks.empty()) {
+        _recordingCallbacks->synchronize();
+    }
+}
+
+uint32_t AdmProxyTransport::Epoch::enter()
+{
+    ++g_callbackDepth;
+    // if epoch was flipped right after of load then writer's check of the slot is ordered after of increment,
+    // or the callback observes new data (all operations are sequentially consistent)
+    const auto slot = _epoch.load() & 1U;
+    _readers[slot].fetch_add(1U);
+    return slot;
+}
+
+void AdmProxyTransport::Epoch::leave(uint32_t slot)
+{
+    _readers[slot].fetch_sub(1U);
+    --g_callbackDepth;
+}
+
+void AdmProxyTransport::Epoch::synchronize()
+{
+    if (0U == g_callbackDepth) {
+        const std::lock_guard lock(_mutex);
+        // new callbacks go to another slot, so writer is not starved by them;
+        // the callback may enter the slot of the epoch loaded before of the previous flip,
+        // so both slots are drained, each one after of flip
+        for (uint32_t phase = 0U; phase < 2U; ++phase) {
+            const auto slot = _epoch.fetch_add(1U) & 1U;
+            while (_readers[slot].load() > 0U) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+AdmProxyTransport::CallbackScope::CallbackScope(Epoch& epoch)
+    : _epoch(epoch)
+    , _slot(epoch.enter())
+{
+}
+
+AdmProxyTransport::CallbackScope::~CallbackScope()
+{
+    _epoch.leave(_slot);
+}
 
 } // namespace LiveKitCpp
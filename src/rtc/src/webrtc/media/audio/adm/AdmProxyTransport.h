@@ -12,8 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once // AdmProxyTransport.h
-#include "Listeners.h"
 #include <api/audio/audio_device_defines.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace webrtc {
 class AudioTrackSinkInterface;
@@ -22,18 +25,27 @@ class AudioTrackSinkInterface;
 namespace LiveKitCpp
 {
 
+class BufferedAudioSink;
+
+// audio callbacks are lock-free: target transport & sinks are published through
+// atomic pointers (RCU), writers wait for completion of callbacks before releasing of old data,
+// grace periods are tracked per direction (recording & playout) and wait only for callbacks started before of swap
 class AdmProxyTransport : public webrtc::AudioTransport
 {
-    using SinkRender = void(webrtc::AudioTrackSinkInterface::*)(const void* /*audio_data*/,
-                                                                int /*bits_per_sample*/,
-                                                                int /*sample_rate*/,
-                                                                size_t /*number_of_channels*/,
-                                                                size_t /*number_of_frames*/,
-                                                                std::optional<int64_t> /* absolute_capture_timestamp_ms */);
+    class Epoch;
+    class CallbackScope;
+    struct Sink;
+    using Sinks = std::vector<Sink>;
+    using RetiredSinks = std::vector<std::unique_ptr<const Sinks>>;
 public:
-    AdmProxyTransport() = default;
+    AdmProxyTransport();
+    ~AdmProxyTransport() override;
     void setTargetTransport(webrtc::AudioTransport* transport);
-    void addSink(webrtc::AudioTrackSinkInterface* sink);
+    // [bufferedFrames] > 0 - sink is invoked on own thread through the ring of 10 ms frames,
+    // otherwise directly from audio callback
+    void addSink(webrtc::AudioTrackSinkInterface* sink, size_t bufferedFrames = 0U);
+    // the sink is not invoked after return, buffered sink removed from audio callback
+    // may block the callback until the completion of its current delivery
     void removeSink(webrtc::AudioTrackSinkInterface* sink);
     void close();
     // impl. of webrtc::AudioTransport
@@ -66,8 +78,21 @@ public:
                         size_t numberOfFrames, void* audioData,
                         int64_t* elapsedTimeMs, int64_t* ntpTimeMs) final;
 private:
-    Bricks::SafeObj<webrtc::AudioTransport*> _targetTransport = nullptr;
-    Bricks::Listeners<webrtc::AudioTrackSinkInterface*> _sinks;
+    // requires locked [_sinksMutex], returns lists to be passed to [releaseSinks] after unlock,
+    // nothing if called from callback (sink changes the list), old list is kept until the next writer
+    RetiredSinks publishSinks(std::unique_ptr<Sinks> sinks);
+    // waits for recording callbacks which may still read retired lists
+    void releaseSinks(RetiredSinks sinks) const;
+private:
+    std::atomic<webrtc::AudioTransport*> _targetTransport = nullptr;
+    std::atomic<const Sinks*> _sinks = nullptr;
+    // sinks are used by recording callbacks only
+    const std::unique_ptr<Epoch> _recordingCallbacks;
+    const std::unique_ptr<Epoch> _playoutCallbacks;
+    // serializes writers
+    mutable std::mutex _sinksMutex;
+    // lists which were replaced from callbacks, released by the next writer
+    RetiredSinks _retiredSinks;
 };
 
 } // namespace LiveKitCpp
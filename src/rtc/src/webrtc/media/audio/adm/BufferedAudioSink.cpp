@@ -0,0 +1,140 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "BufferedAudioSink.h"
+#include "AudioFramesRing.h"
+#include "Metrics.h"
+#include <api/media_stream_interface.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace LiveKitCpp
+{
+
+class BufferedAudioSink::Queue
+{
+public:
+    Queue(webrtc::AudioTrackSinkInterface* sink, size_t capacity);
+    webrtc::AudioTrackSinkInterface* sink() const noexcept { return _sink; }
+    void stop();
+    // producer side
+    void push(const int16_t* audioData, int sampleRate, size_t channels, size_t frames,
+              std::optional<int64_t> absoluteCaptureTimestampMs);
+    // consumer side, returns when stopped
+    void run();
+private:
+    webrtc::AudioTrackSinkInterface* const _sink;
+    AudioFramesRing _ring;
+    std::atomic_bool _stop = false;
+    std::atomic<std::thread::id> _consumer;
+    std::mutex _mutex;
+    std::condition_variable _signal;
+    // held during the sink callback
+    std::mutex _deliveryMutex;
+};
+
+BufferedAudioSink::BufferedAudioSink(webrtc::AudioTrackSinkInterface* sink, size_t capacity)
+    : _queue(std::make_shared<Queue>(sink, capacity))
+    // queue is shared with thread, it may outlive this object if sink removes itself from callback
+    , _thread([queue = _queue]() { queue->run(); })
+{
+}
+
+BufferedAudioSink::~BufferedAudioSink()
+{
+    stop();
+    if (std::this_thread::get_id() == _thread.get_id()) {
+        _thread.detach();
+    }
+    else {
+        _thread.join();
+    }
+}
+
+webrtc::AudioTrackSinkInterface* BufferedAudioSink::sink() const noexcept
+{
+    return _queue->sink();
+}
+
+void BufferedAudioSink::push(const void* audioData, int bitsPerSample, int sampleRate,
+                             size_t numberOfChannels, size_t numberOfFrames,
+                             std::optional<int64_t> absoluteCaptureTimestampMs)
+{
+    if (audioData && 16 == bitsPerSample) {
+        _queue->push(reinterpret_cast<const int16_t*>(audioData), sampleRate,
+                     numberOfChannels, numberOfFrames, absoluteCaptureTimestampMs);
+    }
+}
+
+void BufferedAudioSink::stop()
+{
+    _queue->stop();
+}
+
+BufferedAudioSink::Queue::Queue(webrtc::AudioTrackSinkInterface* sink, size_t capacity)
+    : _sink(sink)
+    , _ring(capacity)
+{
+}
+
+void BufferedAudioSink::Queue::stop()
+{
+    {
+        const std::lock_guard lock(_mutex);
+        _stop = true;
+    }
+    _signal.notify_one();
+    // the sink may stop itself from callback, the delivery is in progress on this thread
+    if (std::this_thread::get_id() != _consumer.load()) {
+        const std::lock_guard delivery(_deliveryMutex);
+    }
+}
+
+void BufferedAudioSink::Queue::push(const int16_t* audioData, int sampleRate,
+                                    size_t channels, size_t frames,
+                                    std::optional<int64_t> absoluteCaptureTimestampMs)
+{
+    if (!_ring.push(audioData, sampleRate, channels, frames, absoluteCaptureTimestampMs)) {
+        Metrics::instance()._audioSinkOverruns.add();
+        return;
+    }
+    // no lock on real-time thread, possible lost wake-up is covered by timeout of waiting
+    _signal.notify_one();
+}
+
+void BufferedAudioSink::Queue::run()
+{
+    using namespace std::chrono_literals;
+    _consumer = std::this_thread::get_id();
+    while (!_stop) {
+        if (const auto frame = _ring.front()) {
+            {
+                const std::lock_guard delivery(_deliveryMutex);
+                // [stop] returned already
+                if (_stop) {
+                    break;
+                }
+                _sink->OnData(frame->_samples.data(), 16, frame->_sampleRate, frame->_channels,
+                              frame->_frames, frame->_absoluteCaptureTimestampMs);
+            }
+            _ring.pop();
+        }
+        else {
+            std::unique_lock lock(_mutex);
+            _signal.wait_for(lock, 10ms, [this]() { return _stop || !_ring.empty(); });
+        }
+    }
+}
+
+} // namespace LiveKitCpp
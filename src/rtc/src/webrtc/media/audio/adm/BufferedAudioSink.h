@@ -0,0 +1,51 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // BufferedAudioSink.h
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace webrtc {
+class AudioTrackSinkInterface;
+}
+
+namespace LiveKitCpp
+{
+
+// decouples slow sink (recorder, analyzer) from real-time audio thread:
+// frames are copied into SPSC ring and delivered to the sink on own thread
+class BufferedAudioSink
+{
+    class Queue;
+public:
+    // [capacity] - number of 10 ms frames
+    BufferedAudioSink(webrtc::AudioTrackSinkInterface* sink, size_t capacity);
+    ~BufferedAudioSink();
+    webrtc::AudioTrackSinkInterface* sink() const noexcept;
+    // no more deliveries to the sink after return, the current one is waited for,
+    // except of call from the sink callback (on own thread)
+    void stop();
+    // single producer, never blocks: frame is dropped & counted in
+    // livekit_audio_sink_overruns metric if ring is full
+    void push(const void* audioData, int bitsPerSample, int sampleRate,
+              size_t numberOfChannels, size_t numberOfFrames,
+              std::optional<int64_t> absoluteCaptureTimestampMs);
+private:
+    const std::shared_ptr<Queue> _queue;
+    std::thread _thread;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,523 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "VirtualAdm.h"
+#include "livekit/rtc/media/AudioFramesReader.h"
+#include "livekit/rtc/media/AudioFramesWriter.h"
+#include <common_audio/wav_file.h>
+#include <rtc_base/system/file_wrapper.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+constexpr auto g_period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(10ms);
+// don't try to catch up if pacing thread was stalled for longer time
+constexpr auto g_maxLag = 10 * g_period;
+// unpaced mode ([_speed] == 0): 100 ms of audio per burst, then thread sleeps,
+// so it doesn't starve other threads
+constexpr size_t g_unpacedBurst = 10U;
+constexpr auto g_unpacedPause = std::chrono::duration_cast<std::chrono::steady_clock::duration>(1ms);
+
+inline int32_t copyName(std::string_view src, char* dst, size_t dstSize)
+{
+    if (dst) {
+        const auto len = std::min(src.size(), dstSize - 1U);
+        std::memcpy(dst, src.data(), len);
+        dst[len] = 0;
+    }
+    return 0;
+}
+
+template <typename T>
+inline int32_t getValue(T* dst, T value)
+{
+    if (dst) {
+        *dst = value;
+        return 0;
+    }
+    return -1;
+}
+
+inline size_t framesPer10ms(int sampleRate) { return static_cast<size_t>(sampleRate / 100); }
+
+}
+
+namespace LiveKitCpp
+{
+
+VirtualAdm::VirtualAdm(VirtualAudioOptions options)
+    : _options(std::move(options))
+{
+    // opened in advance, format of recording must be known before of initialization
+    if (!_options._recordingFilename.empty()) {
+        auto file = webrtc::FileWrapper::OpenReadOnly(_options._recordingFilename);
+        if (file.is_open()) {
+            _wavReader = std::make_unique<webrtc::WavReader>(std::move(file));
+        }
+    }
+}
+
+VirtualAdm::~VirtualAdm()
+{
+    StopRecording();
+    StopPlayout();
+}
+
+int32_t VirtualAdm::ActiveAudioLayer(AudioLayer* audioLayer) const
+{
+    return getValue(audioLayer, AudioLayer::kDummyAudio);
+}
+
+int32_t VirtualAdm::RegisterAudioCallback(webrtc::AudioTransport* audioCallback)
+{
+    // transport is called without lock, so it can't be changed while media is active (same as webrtc::AudioDeviceBuffer)
+    if (_playing || _recording) {
+        return -1;
+    }
+    _transport = audioCallback;
+    return 0;
+}
+
+int32_t VirtualAdm::Init()
+{
+    _initialized = true;
+    return 0;
+}
+
+int32_t VirtualAdm::Terminate()
+{
+    if (_initialized.exchange(false)) {
+        StopRecording();
+        StopPlayout();
+    }
+    return 0;
+}
+
+int32_t VirtualAdm::PlayoutDeviceName(uint16_t index,
+                                      char name[webrtc::kAdmMaxDeviceNameSize],
+                                      char guid[webrtc::kAdmMaxGuidSize])
+{
+    if (0U == index) {
+        copyName("Virtual Playout Device", name, webrtc::kAdmMaxDeviceNameSize);
+        return copyName("virtual_playout", guid, webrtc::kAdmMaxGuidSize);
+    }
+    return -1;
+}
+
+int32_t VirtualAdm::RecordingDeviceName(uint16_t index,
+                                        char name[webrtc::kAdmMaxDeviceNameSize],
+                                        char guid[webrtc::kAdmMaxGuidSize])
+{
+    if (0U == index) {
+        copyName("Virtual Recording Device", name, webrtc::kAdmMaxDeviceNameSize);
+        return copyName("virtual_recording", guid, webrtc::kAdmMaxGuidSize);
+    }
+    return -1;
+}
+
+int32_t VirtualAdm::PlayoutIsAvailable(bool* available)
+{
+    return getValue(available, true);
+}
+
+int32_t VirtualAdm::InitPlayout()
+{
+    if (_playing) {
+        return -1;
+    }
+    if (!_playoutInitialized) {
+        const auto channels = playoutChannels();
+        const std::lock_guard lock(_mutex);
+        if (!_options._playoutFilename.empty()) {
+            auto file = webrtc::FileWrapper::OpenWriteOnly(_options._playoutFilename);
+            if (!file.is_open()) {
+                return -1;
+            }
+            _wavWriter = std::make_unique<webrtc::WavWriter>(std::move(file), _options._sampleRate, channels);
+        }
+        _playoutInitialized = true;
+    }
+    return 0;
+}
+
+int32_t VirtualAdm::RecordingIsAvailable(bool* available)
+{
+    return getValue(available, true);
+}
+
+int32_t VirtualAdm::InitRecording()
+{
+    if (_recording) {
+        return -1;
+    }
+    if (!_recordingInitialized) {
+        const std::lock_guard lock(_mutex);
+        if (_wavReader) {
+            _wavReader->Reset();
+        }
+        else if (!_options._recordingFilename.empty()) {
+            return -1;
+        }
+        _recordingInitialized = true;
+    }
+    return 0;
+}
+
+int32_t VirtualAdm::StartPlayout()
+{
+    if (!_playoutInitialized) {
+        return -1;
+    }
+    if (!_playing) {
+        if (_options._playoutWriter && !_wavWriter) {
+            _options._playoutWriter->onStarted();
+        }
+        _playing = true;
+        startThread();
+    }
+    return 0;
+}
+
+int32_t VirtualAdm::StopPlayout()
+{
+    if (_playing.exchange(false)) {
+        if (!_recording) {
+            stopThread();
+        }
+        if (_options._playoutWriter && !_wavWriter) {
+            _options._playoutWriter->onStopped();
+        }
+    }
+    if (_playoutInitialized.exchange(false)) {
+        const std::lock_guard lock(_mutex);
+        // header of WAV file is finalized in destructor
+        _wavWriter.reset();
+    }
+    return 0;
+}
+
+int32_t VirtualAdm::StartRecording()
+{
+    if (!_recordingInitialized) {
+        return -1;
+    }
+    if (!_recording) {
+        if (_options._recordingReader && !_wavReader) {
+            _options._recordingReader->onStarted();
+        }
+        _recording = true;
+        startThread();
+    }
+    return 0;
+}
+
+int32_t VirtualAdm::StopRecording()
+{
+    if (_recording.exchange(false)) {
+        if (!_playing) {
+            stopThread();
+        }
+        if (_options._recordingReader && !_wavReader) {
+            _options._recordingReader->onStopped();
+        }
+    }
+    _recordingInitialized = false;
+    return 0;
+}
+
+int32_t VirtualAdm::SpeakerVolumeIsAvailable(bool* available)
+{
+    return getValue(available, true);
+}
+
+int32_t VirtualAdm::SetSpeakerVolume(uint32_t volume)
+{
+    if (volume <= _maxVolume) {
+        _speakerVolume = volume;
+        return 0;
+    }
+    return -1;
+}
+
+int32_t VirtualAdm::SpeakerVolume(uint32_t* volume) const
+{
+    return getValue(volume, _speakerVolume.load());
+}
+
+int32_t VirtualAdm::MaxSpeakerVolume(uint32_t* maxVolume) const
+{
+    return getValue(maxVolume, _maxVolume);
+}
+
+int32_t VirtualAdm::MinSpeakerVolume(uint32_t* minVolume) const
+{
+    return getValue(minVolume, 0U);
+}
+
+int32_t VirtualAdm::MicrophoneVolumeIsAvailable(bool* available)
+{
+    return getValue(available, true);
+}
+
+int32_t VirtualAdm::SetMicrophoneVolume(uint32_t volume)
+{
+    if (volume <= _maxVolume) {
+        _microphoneVolume = volume;
+        return 0;
+    }
+    return -1;
+}
+
+int32_t VirtualAdm::MicrophoneVolume(uint32_t* volume) const
+{
+    return getValue(volume, _microphoneVolume.load());
+}
+
+int32_t VirtualAdm::MaxMicrophoneVolume(uint32_t* maxVolume) const
+{
+    return getValue(maxVolume, _maxVolume);
+}
+
+int32_t VirtualAdm::MinMicrophoneVolume(uint32_t* minVolume) const
+{
+    return getValue(minVolume, 0U);
+}
+
+int32_t VirtualAdm::SpeakerMuteIsAvailable(bool* available)
+{
+    return getValue(available, true);
+}
+
+int32_t VirtualAdm::SetSpeakerMute(bool mute)
+{
+    _speakerMute = mute;
+    return 0;
+}
+
+int32_t VirtualAdm::SpeakerMute(bool* muted) const
+{
+    return getValue(muted, _speakerMute.load());
+}
+
+int32_t VirtualAdm::MicrophoneMuteIsAvailable(bool* available)
+{
+    return getValue(available, true);
+}
+
+int32_t VirtualAdm::SetMicrophoneMute(bool mute)
+{
+    _microphoneMute = mute;
+    return 0;
+}
+
+int32_t VirtualAdm::MicrophoneMute(bool* muted) const
+{
+    return getValue(muted, _microphoneMute.load());
+}
+
+int32_t VirtualAdm::StereoPlayoutIsAvailable(bool* available) const
+{
+    return getValue(available, playoutChannels() > 1U);
+}
+
+int32_t VirtualAdm::SetStereoPlayout(bool enable)
+{
+    // format is defined by options
+    return enable == (playoutChannels() > 1U) ? 0 : -1;
+}
+
+int32_t VirtualAdm::StereoPlayout(bool* enabled) const
+{
+    return getValue(enabled, playoutChannels() > 1U);
+}
+
+int32_t VirtualAdm::StereoRecordingIsAvailable(bool* available) const
+{
+    return getValue(available, recordingChannels() > 1U);
+}
+
+int32_t VirtualAdm::SetStereoRecording(bool enable)
+{
+    // format is defined by options or WAV file
+    return enable == (recordingChannels() > 1U) ? 0 : -1;
+}
+
+int32_t VirtualAdm::StereoRecording(bool* enabled) const
+{
+    return getValue(enabled, recordingChannels() > 1U);
+}
+
+int32_t VirtualAdm::PlayoutDelay(uint16_t* delayMS) const
+{
+    return getValue(delayMS, uint16_t(0U));
+}
+
+void VirtualAdm::startThread()
+{
+    if (_thread.empty()) {
+        {
+            const std::lock_guard lock(_mutex);
+            _stop = false;
+        }
+        // unpaced mode is not time-critical
+        const auto priority = _options._speed > 0U ? webrtc::ThreadPriority::kRealtime : webrtc::ThreadPriority::kNormal;
+        const auto attributes = webrtc::ThreadAttributes().SetPriority(priority);
+        _thread = webrtc::PlatformThread::SpawnJoinable([this]() { run(); }, "virtual_adm", attributes);
+    }
+}
+
+void VirtualAdm::stopThread()
+{
+    if (!_thread.empty()) {
+        {
+            const std::lock_guard lock(_mutex);
+            _stop = true;
+        }
+        _signal.notify_one();
+        _thread.Finalize();
+    }
+}
+
+void VirtualAdm::run()
+{
+    const auto speed = _options._speed;
+    auto next = std::chrono::steady_clock::now();
+    for (size_t cycle = 1U;; ++cycle) {
+        // transport & file I/O are performed without lock
+        if (_recording) {
+            record();
+        }
+        if (_playing) {
+            play();
+        }
+        std::unique_lock lock(_mutex);
+        if (speed > 0U) {
+            // absolute deadlines, so the error of single wake-up doesn't accumulate
+            next += g_period / speed;
+            const auto now = std::chrono::steady_clock::now();
+            if (now - next > g_maxLag) {
+                next = now;
+            }
+            _signal.wait_until(lock, next, [this]() { return _stop; });
+        }
+        else if (0U == cycle % g_unpacedBurst) {
+            _signal.wait_for(lock, g_unpacedPause, [this]() { return _stop; });
+        }
+        if (_stop) {
+            break;
+        }
+    }
+}
+
+void VirtualAdm::record()
+{
+    const auto transport = _transport.load();
+    if (!transport) {
+        return;
+    }
+    const auto rate = recordingRate();
+    const auto channels = recordingChannels();
+    const auto frames = framesPer10ms(rate);
+    _recordingBuffer.resize(frames * channels);
+    bool filled = false;
+    if (!_microphoneMute) {
+        if (_wavReader) {
+            // reader is shared with [InitRecording]
+            const std::lock_guard lock(_mutex);
+            auto read = _wavReader->ReadSamples(_recordingBuffer.size(), _recordingBuffer.data());
+            if (read < _recordingBuffer.size() && _options._loopRecording) {
+                _wavReader->Reset();
+                read += _wavReader->ReadSamples(_recordingBuffer.size() - read, _recordingBuffer.data() + read);
+            }
+            std::fill(_recordingBuffer.begin() + read, _recordingBuffer.end(), 0);
+            filled = read > 0U;
+        }
+        else if (const auto& reader = _options._recordingReader) {
+            filled = reader->read(_recordingBuffer.data(), rate, channels, frames);
+        }
+    }
+    if (!filled) {
+        std::fill(_recordingBuffer.begin(), _recordingBuffer.end(), 0);
+    }
+    uint32_t newMicLevel = 0U;
+    transport->RecordedDataIsAvailable(_recordingBuffer.data(), frames, sizeof(int16_t) * channels,
+                                      channels, static_cast<uint32_t>(rate), 0U, 0,
+                                      _microphoneVolume, false, newMicLevel);
+    if (newMicLevel > 0U && newMicLevel <= _maxVolume) {
+        _microphoneVolume = newMicLevel;
+    }
+}
+
+void VirtualAdm::play()
+{
+    const auto transport = _transport.load();
+    if (!transport) {
+        return;
+    }
+    const auto rate = _options._sampleRate;
+    const auto channels = playoutChannels();
+    const auto frames = framesPer10ms(rate);
+    _playoutBuffer.resize(frames * channels);
+    size_t samplesOut = 0U;
+    int64_t elapsedTimeMs = -1, ntpTimeMs = -1;
+    // playout must be pulled even if nobody consumes it: mixer & NetEq are driven by these calls
+    if (0 == transport->NeedMorePlayData(frames, sizeof(int16_t) * channels, channels,
+                                         static_cast<uint32_t>(rate), _playoutBuffer.data(),
+                                         samplesOut, &elapsedTimeMs, &ntpTimeMs)) {
+        if (_speakerMute) {
+            std::fill(_playoutBuffer.begin(), _playoutBuffer.end(), 0);
+        }
+        bool written = false;
+        {
+            // writer is reset by [StopPlayout]
+            const std::lock_guard lock(_mutex);
+            if (_wavWriter) {
+                _wavWriter->WriteSamples(_playoutBuffer.data(), _playoutBuffer.size());
+                written = true;
+            }
+        }
+        if (!written) {
+            if (const auto& writer = _options._playoutWriter) {
+                writer->onData(_playoutBuffer.data(), 16, rate, channels, frames, std::nullopt);
+            }
+        }
+    }
+}
+
+int VirtualAdm::recordingRate() const
+{
+    if (_wavReader) {
+        return _wavReader->sample_rate();
+    }
+    return _options._sampleRate;
+}
+
+size_t VirtualAdm::recordingChannels() const
+{
+    if (_wavReader) {
+        return _wavReader->num_channels();
+    }
+    return std::clamp<size_t>(_options._recordingChannels, 1U, 2U);
+}
+
+size_t VirtualAdm::playoutChannels() const
+{
+    return std::clamp<size_t>(_options._playoutChannels, 1U, 2U);
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,139 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // VirtualAdm.h
+#include "livekit/rtc/media/VirtualAudioOptions.h"
+#include <modules/audio_device/include/audio_device.h> //AudioDeviceModule
+#include <rtc_base/platform_thread.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace webrtc {
+class WavReader;
+class WavWriter;
+}
+
+namespace LiveKitCpp
+{
+
+// ADM without sound hardware: recording reads from WAV file, reader or silence,
+// playout writes to WAV file, writer or nowhere, both are paced by own thread (10 ms period)
+class VirtualAdm : public webrtc::AudioDeviceModule
+{
+public:
+    VirtualAdm(VirtualAudioOptions options);
+    ~VirtualAdm() override;
+    // impl. of webrtc::AudioDeviceModule
+    int32_t ActiveAudioLayer(AudioLayer* audioLayer) const final;
+    int32_t RegisterAudioCallback(webrtc::AudioTransport* audioCallback) final;
+    int32_t Init() final;
+    int32_t Terminate() final;
+    bool Initialized() const final { return _initialized; }
+    int16_t PlayoutDevices() final { return 1; }
+    int16_t RecordingDevices() final { return 1; }
+    int32_t PlayoutDeviceName(uint16_t index,
+                              char name[webrtc::kAdmMaxDeviceNameSize],
+                              char guid[webrtc::kAdmMaxGuidSize]) final;
+    int32_t RecordingDeviceName(uint16_t index,
+                                char name[webrtc::kAdmMaxDeviceNameSize],
+                                char guid[webrtc::kAdmMaxGuidSize]) final;
+    int32_t SetPlayoutDevice(uint16_t index) final { return 0U == index ? 0 : -1; }
+    int32_t SetPlayoutDevice(WindowsDeviceType) final { return 0; }
+    int32_t SetRecordingDevice(uint16_t index) final { return 0U == index ? 0 : -1; }
+    int32_t SetRecordingDevice(WindowsDeviceType) final { return 0; }
+    int32_t PlayoutIsAvailable(bool* available) final;
+    int32_t InitPlayout() final;
+    bool PlayoutIsInitialized() const final { return _playoutInitialized; }
+    int32_t RecordingIsAvailable(bool* available) final;
+    int32_t InitRecording() final;
+    bool RecordingIsInitialized() const final { return _recordingInitialized; }
+    int32_t StartPlayout() final;
+    int32_t StopPlayout() final;
+    bool Playing() const final { return _playing; }
+    int32_t StartRecording() final;
+    int32_t StopRecording() final;
+    bool Recording() const final { return _recording; }
+    int32_t InitSpeaker() final { return 0; }
+    bool SpeakerIsInitialized() const final { return true; }
+    int32_t InitMicrophone() final { return 0; }
+    bool MicrophoneIsInitialized() const final { return true; }
+    int32_t SpeakerVolumeIsAvailable(bool* available) final;
+    int32_t SetSpeakerVolume(uint32_t volume) final;
+    int32_t SpeakerVolume(uint32_t* volume) const final;
+    int32_t MaxSpeakerVolume(uint32_t* maxVolume) const final;
+    int32_t MinSpeakerVolume(uint32_t* minVolume) const final;
+    int32_t MicrophoneVolumeIsAvailable(bool* available) final;
+    int32_t SetMicrophoneVolume(uint32_t volume) final;
+    int32_t MicrophoneVolume(uint32_t* volume) const final;
+    int32_t MaxMicrophoneVolume(uint32_t* maxVolume) const final;
+    int32_t MinMicrophoneVolume(uint32_t* minVolume) const final;
+    int32_t SpeakerMuteIsAvailable(bool* available) final;
+    int32_t SetSpeakerMute(bool mute) final;
+    int32_t SpeakerMute(bool* muted) const final;
+    int32_t MicrophoneMuteIsAvailable(bool* available) final;
+    int32_t SetMicrophoneMute(bool mute) final;
+    int32_t MicrophoneMute(bool* muted) const final;
+    int32_t StereoPlayoutIsAvailable(bool* available) const final;
+    int32_t SetStereoPlayout(bool enable) final;
+    int32_t StereoPlayout(bool* enabled) const final;
+    int32_t StereoRecordingIsAvailable(bool* available) const final;
+    int32_t SetStereoRecording(bool enable) final;
+    int32_t StereoRecording(bool* enabled) const final;
+    int32_t PlayoutDelay(uint16_t* delayMS) const final;
+    bool BuiltInAECIsAvailable() const final { return false; }
+    bool BuiltInAGCIsAvailable() const final { return false; }
+    bool BuiltInNSIsAvailable() const final { return false; }
+    int32_t EnableBuiltInAEC(bool) final { return -1; }
+    int32_t EnableBuiltInAGC(bool) final { return -1; }
+    int32_t EnableBuiltInNS(bool) final { return -1; }
+    int32_t GetPlayoutUnderrunCount() const final { return 0; }
+private:
+    static constexpr uint32_t _maxVolume = 255U;
+    void startThread();
+    void stopThread();
+    void run();
+    // ADM thread, [_mutex] is taken only for file I/O, transport is called without lock
+    void record();
+    void play();
+    int recordingRate() const;
+    size_t recordingChannels() const;
+    size_t playoutChannels() const;
+private:
+    const VirtualAudioOptions _options;
+    std::mutex _mutex;
+    std::condition_variable _signal;
+    bool _stop = false;
+    // format of file doesn't change
+    std::unique_ptr<webrtc::WavReader> _wavReader;
+    // changed only while media is inactive
+    std::atomic<webrtc::AudioTransport*> _transport = nullptr;
+    // guarded by [_mutex]
+    std::unique_ptr<webrtc::WavWriter> _wavWriter;
+    // only ADM thread
+    std::vector<int16_t> _recordingBuffer;
+    std::vector<int16_t> _playoutBuffer;
+    webrtc::PlatformThread _thread;
+    std::atomic_bool _initialized = false;
+    std::atomic_bool _playoutInitialized = false;
+    std::atomic_bool _recordingInitialized = false;
+    std::atomic_bool _playing = false;
+    std::atomic_bool _recording = false;
+    std::atomic_bool _speakerMute = false;
+    std::atomic_bool _microphoneMute = false;
+    std::atomic<uint32_t> _speakerVolume = _maxVolume;
+    std::atomic<uint32_t> _microphoneVolume = _maxVolume;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,189 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AsyncAudioFileWriter.h"
+#include "AudioFileEncoder.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+
+// APM delivers 10 ms frames
+constexpr uint32_t g_frameMs = 10U;
+// upper limit of single write, 1 second of 48 kHz stereo
+constexpr size_t g_maxBatchSamples = 48000U * 2U;
+
+}
+
+namespace LiveKitCpp
+{
+
+AsyncAudioFileWriter::AsyncAudioFileWriter(std::string filename,
+                                           const AudioFramesFileOptions& options,
+                                           EncoderFactory encoderFactory)
+    : _filename(std::move(filename))
+    , _rotationSec(options._rotationSec)
+    , _encoderFactory(std::move(encoderFactory))
+    , _ring(std::max<uint32_t>(options._bufferMs / g_frameMs, 1U))
+{
+    _batch.reserve(g_maxBatchSamples);
+    if (!_filename.empty() && _encoderFactory) {
+        _thread = std::thread(&AsyncAudioFileWriter::run, this);
+    }
+}
+
+AsyncAudioFileWriter::~AsyncAudioFileWriter()
+{
+    if (_thread.joinable()) {
+        {
+            const std::lock_guard lock(_mutex);
+            _stop = true;
+        }
+        _signal.notify_one();
+        _thread.join();
+    }
+}
+
+void AsyncAudioFileWriter::write(const int16_t* data, int sampleRate, size_t channels, size_t frames)
+{
+    if (_thread.joinable() && data && sampleRate > 0 && channels && frames) {
+        if (!_ring.push(data, sampleRate, channels, frames)) {
+            _overruns.fetch_add(1U, std::memory_order_relaxed);
+        }
+        // no lock on real-time thread, possible lost wake-up is covered by timeout of waiting
+        _signal.notify_one();
+    }
+}
+
+void AsyncAudioFileWriter::close()
+{
+    if (_thread.joinable()) {
+        {
+            const std::lock_guard lock(_mutex);
+            _closeRequests.fetch_add(1U);
+        }
+        _signal.notify_one();
+    }
+}
+
+void AsyncAudioFileWriter::run()
+{
+    using namespace std::chrono_literals;
+    while (!_stop) {
+        const auto closes = _closeRequests.load();
+        if (closes != _closesHandled) {
+            // everything queued before the request goes to the closing file
+            while (drain(true)) {}
+            closeFile();
+            _closesHandled = closes;
+        }
+        else if (!drain(false)) {
+            std::unique_lock lock(_mutex);
+            _signal.wait_for(lock, 10ms, [this, closes]() {
+                return _stop || closes != _closeRequests || !_ring.empty();
+            });
+        }
+    }
+    while (drain(true)) {}
+    closeFile();
+}
+
+bool AsyncAudioFileWriter::drain(bool force)
+{
+    bool any = false;
+    while (const auto frame = _ring.front()) {
+        any = true;
+        if (frame->_sampleRate != _sampleRate || frame->_channels != _channels) {
+            writeBatch();
+            closeFile();
+            _sampleRate = frame->_sampleRate;
+            _channels = frame->_channels;
+        }
+        else if (_rotationSec && _fileFrames + _batchFrames >= uint64_t(_rotationSec) * _sampleRate) {
+            writeBatch();
+            closeFile();
+        }
+        if (_batch.size() + frame->_samples.size() > g_maxBatchSamples) {
+            writeBatch();
+        }
+        _batch.insert(_batch.end(), frame->_samples.begin(), frame->_samples.end());
+        _batchFrames += frame->_frames;
+        _ring.pop();
+    }
+    // small batches are collected until the ring is drained or the batch is large enough
+    if (force || _batch.size() * 2U >= g_maxBatchSamples) {
+        writeBatch();
+    }
+    return any;
+}
+
+void AsyncAudioFileWriter::writeBatch()
+{
+    if (_batchFrames) {
+        // open error is logged by encoder, frames of the batch are lost in this case
+        if (!_encoder) {
+            openFile(_sampleRate, _channels);
+        }
+        if (_encoder && !_encoder->write(_batch.data(), _batchFrames)) {
+            // size limit of the format was reached, continue in the next file
+            closeFile();
+            if (openFile(_sampleRate, _channels)) {
+                _encoder->write(_batch.data(), _batchFrames);
+            }
+        }
+        _fileFrames += _batchFrames;
+        _batch.clear();
+        _batchFrames = 0U;
+    }
+}
+
+bool AsyncAudioFileWriter::openFile(int sampleRate, size_t channels)
+{
+    auto encoder = _encoderFactory();
+    if (encoder && encoder->open(fileName(_fileIndex), sampleRate, channels)) {
+        ++_fileIndex;
+        _encoder = std::move(encoder);
+        _fileFrames = 0ULL;
+        return true;
+    }
+    return false;
+}
+
+void AsyncAudioFileWriter::closeFile()
+{
+    if (_encoder) {
+        _encoder->close();
+        _encoder.reset();
+    }
+    _fileFrames = 0ULL;
+}
+
+std::string AsyncAudioFileWriter::fileName(size_t index) const
+{
+    if (0U == index) {
+        return _filename;
+    }
+    // 'dir/name.ext' -> 'dir/name_N.ext'
+    auto dot = _filename.find_last_of('.');
+    const auto slash = _filename.find_last_of("/\\");
+    if (std::string::npos != dot && std::string::npos != slash && dot < slash) {
+        dot = std::string::npos;
+    }
+    auto name = _filename.substr(0U, dot) + "_" + std::to_string(index);
+    if (std::string::npos != dot) {
+        name += _filename.substr(dot);
+    }
+    return name;
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,78 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AsyncAudioFileWriter.h
+#include "AudioFramesRing.h"
+#include "livekit/rtc/media/AudioFramesFileOptions.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace LiveKitCpp
+{
+
+class AudioFileEncoder;
+
+// audio thread copies frames into preallocated ring, I/O thread drains it
+// and writes batches of frames with the same format into the file,
+// new file is started on rotation timeout, format change and after [close]
+class AsyncAudioFileWriter
+{
+public:
+    using EncoderFactory = std::function<std::unique_ptr<AudioFileEncoder>()>;
+public:
+    AsyncAudioFileWriter(std::string filename, const AudioFramesFileOptions& options,
+                         EncoderFactory encoderFactory);
+    // all queued frames are written and the file is finalized
+    ~AsyncAudioFileWriter();
+    // single producer, never blocks: frame is dropped & counted as overrun if ring is full
+    void write(const int16_t* data, int sampleRate, size_t channels, size_t frames);
+    // finalize current file after already queued frames, may be called from any thread
+    void close();
+    uint64_t overruns() const noexcept { return _overruns; }
+private:
+    void run();
+    // returns false if ring is empty
+    bool drain(bool force);
+    void writeBatch();
+    bool openFile(int sampleRate, size_t channels);
+    void closeFile();
+    // the first file has original name, next ones get index suffix
+    std::string fileName(size_t index) const;
+private:
+    const std::string _filename;
+    const uint32_t _rotationSec;
+    const EncoderFactory _encoderFactory;
+    AudioFramesRing _ring;
+    std::atomic<uint64_t> _overruns = 0ULL;
+    std::atomic<uint64_t> _closeRequests = 0ULL;
+    std::atomic_bool _stop = false;
+    std::mutex _mutex;
+    std::condition_variable _signal;
+    // I/O thread state
+    std::unique_ptr<AudioFileEncoder> _encoder;
+    std::vector<int16_t> _batch;
+    size_t _batchFrames = 0U;
+    int _sampleRate = 0;
+    size_t _channels = 0U;
+    uint64_t _fileFrames = 0ULL;
+    uint64_t _closesHandled = 0ULL;
+    size_t _fileIndex = 0U;
+    std::thread _thread;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,34 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AudioFileEncoder.h
+#include <cstdint>
+#include <string>
+
+namespace LiveKitCpp
+{
+
+// container/codec backend of AsyncAudioFileWriter, all calls are made from I/O thread
+class AudioFileEncoder
+{
+public:
+    virtual ~AudioFileEncoder() = default;
+    virtual bool open(const std::string& filename, int sampleRate, size_t channels) = 0;
+    // interleaved 16-bit samples in format passed to [open],
+    // false if write failed or file reached the format size limit
+    virtual bool write(const int16_t* samples, size_t frames) = 0;
+    // finalize headers and close the file
+    virtual void close() = 0;
+};
+
+} // namespace LiveKitCpp
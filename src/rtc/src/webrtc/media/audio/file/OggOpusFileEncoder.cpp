@@ -0,0 +1,194 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "OggOpusFileEncoder.h"
+#include "OggPageWriter.h"
+#include <api/audio_codecs/opus/audio_encoder_opus.h>
+#include <api/environment/environment_factory.h>
+#include <rtc_base/logging.h>
+#include <rtc_base/system/file_wrapper.h>
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <type_traits>
+
+namespace {
+
+constexpr int g_opusRate = 48000;
+constexpr size_t g_blockFrames = g_opusRate / 100;
+// encoder delay of libopus at 48 kHz, decoders drop these samples
+constexpr uint16_t g_preSkip = 312U;
+
+template <typename T>
+void appendLE(std::vector<uint8_t>& dst, T value);
+
+}
+
+namespace LiveKitCpp
+{
+
+OggOpusFileEncoder::OggOpusFileEncoder(int bitrate)
+    : _bitrate(bitrate)
+{
+    _sinks.add(this);
+}
+
+OggOpusFileEncoder::~OggOpusFileEncoder()
+{
+    close();
+    _sinks.clear();
+}
+
+bool OggOpusFileEncoder::open(const std::string& filename, int sampleRate, size_t channels)
+{
+    close();
+    if (!PushAudioPipeline::validSampleRate(sampleRate) || !channels) {
+        return false;
+    }
+    // pipeline keeps up to 2 channels
+    const auto outChannels = std::min<size_t>(channels, 2U);
+    webrtc::AudioEncoderOpusConfig config;
+    config.num_channels = outChannels;
+    config.frame_size_ms = 20;
+    config.bitrate_bps = _bitrate;
+    config.application = webrtc::AudioEncoderOpusConfig::ApplicationMode::kAudio;
+    if (!config.IsOk()) {
+        RTC_LOG(LS_ERROR) << "Invalid Opus config for file recording, bitrate " << _bitrate;
+        return false;
+    }
+    auto file = std::make_unique<webrtc::FileWrapper>(webrtc::FileWrapper::OpenWriteOnly(filename));
+    if (!file->is_open()) {
+        RTC_LOG(LS_ERROR) << "Failed to open Ogg file '" << filename << "' for writing";
+        return false;
+    }
+    _encoder = webrtc::AudioEncoderOpus::MakeAudioEncoder(webrtc::CreateEnvironment(), config, {});
+    if (!_encoder) {
+        return false;
+    }
+    _file = std::move(file);
+    _ogg = std::make_unique<OggPageWriter>(_file.get(), std::random_device{}());
+    _pipeline.setFormat(sampleRate, channels);
+    _pipeline.reset();
+    _inputRate = sampleRate;
+    _inputChannels = channels;
+    _channels = outChannels;
+    _ok = writeHeaders(outChannels, sampleRate);
+    return _ok;
+}
+
+bool OggOpusFileEncoder::write(const int16_t* samples, size_t frames)
+{
+    if (_ok) {
+        _inputFrames += frames;
+        _pipeline.write(samples, frames, false, nullptr, _sinks);
+    }
+    return _ok;
+}
+
+void OggOpusFileEncoder::close()
+{
+    if (_ogg) {
+        if (_ok) {
+            // complete the last block of pipeline with silence
+            if (const auto missing = _pipeline.missingFrames()) {
+                const std::vector<int16_t> silence(missing * _inputChannels, 0);
+                _pipeline.write(silence.data(), missing, false, nullptr, _sinks);
+            }
+            // 48 kHz samples of real input
+            const auto realSamples = _inputFrames * g_opusRate / _inputRate;
+            // flush the encoder lookahead: last real sample is decoded [g_preSkip] samples later,
+            // then pad the last packet, final granule position trims the padding on decoding (RFC 7845 section 4.4)
+            const std::vector<int16_t> silence(g_blockFrames * _channels, 0);
+            while (_ok && (_encodedSamples || _granule < g_preSkip + realSamples)) {
+                _ok = encode(silence.data());
+            }
+            if (_ok) {
+                _ogg->finish(g_preSkip + realSamples);
+            }
+        }
+        _ogg.reset();
+    }
+    if (_file) {
+        _file->Close();
+        _file.reset();
+    }
+    _encoder.reset();
+    _inputRate = 0;
+    _inputChannels = _channels = 0U;
+    _encodedSamples = 0U;
+    _inputFrames = _granule = 0;
+    _ok = false;
+}
+
+bool OggOpusFileEncoder::writeHeaders(size_t channels, int inputSampleRate)
+{
+    // identification header, RFC 7845 section 5.1
+    std::vector<uint8_t> head = {'O', 'p', 'u', 's', 'H', 'e', 'a', 'd', 1U};
+    head.push_back(static_cast<uint8_t>(channels));
+    appendLE(head, g_preSkip);
+    appendLE(head, static_cast<uint32_t>(inputSampleRate));
+    appendLE(head, int16_t(0)); // output gain
+    head.push_back(0U); // channel mapping family
+    // comment header, section 5.2
+    static constexpr std::string_view vendor = "LiveKitCpp";
+    std::vector<uint8_t> tags = {'O', 'p', 'u', 's', 'T', 'a', 'g', 's'};
+    appendLE(tags, static_cast<uint32_t>(vendor.size()));
+    tags.insert(tags.end(), vendor.begin(), vendor.end());
+    appendLE(tags, uint32_t(0)); // no user comments
+    // each header must be on its own page
+    return _ogg->addPacket(head.data(), head.size(), 0, true) &&
+           _ogg->addPacket(tags.data(), tags.size(), 0, true);
+}
+
+bool OggOpusFileEncoder::encode(const int16_t* samples)
+{
+    _packet.Clear();
+    const auto timestamp = static_cast<uint32_t>(_granule + _encodedSamples);
+    const webrtc::ArrayView<const int16_t> block(samples, g_blockFrames * _channels);
+    const auto info = _encoder->Encode(timestamp, block, &_packet);
+    _encodedSamples += g_blockFrames;
+    if (info.encoded_bytes) {
+        // granule position counts all decoded samples, pre-skip included (RFC 7845 section 4)
+        _granule += _encodedSamples;
+        _encodedSamples = 0U;
+        return _ogg->addPacket(_packet.data(), _packet.size(), _granule);
+    }
+    return true;
+}
+
+void OggOpusFileEncoder::OnData(const void* audioData, int bitsPerSample, int sampleRate,
+                                size_t numberOfChannels, size_t numberOfFrames)
+{
+    if (_ok && 16 == bitsPerSample && g_opusRate == sampleRate &&
+        _channels == numberOfChannels && g_blockFrames == numberOfFrames) {
+        _ok = encode(reinterpret_cast<const int16_t*>(audioData));
+        if (!_ok) {
+            RTC_LOG(LS_ERROR) << "Failed to write Ogg page";
+        }
+    }
+}
+
+} // namespace LiveKitCpp
+
+namespace {
+
+template <typename T>
+void appendLE(std::vector<uint8_t>& dst, T value)
+{
+    const auto v = static_cast<std::make_unsigned_t<T>>(value);
+    for (size_t i = 0U; i < sizeof(T); ++i) {
+        dst.push_back(static_cast<uint8_t>(v >> (8U * i)));
+    }
+}
+
+}
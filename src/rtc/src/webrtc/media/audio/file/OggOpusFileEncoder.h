@@ -0,0 +1,65 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // OggOpusFileEncoder.h
+#include "AudioFileEncoder.h"
+#include "PushAudioPipeline.h"
+#include <rtc_base/buffer.h>
+#include <memory>
+
+namespace webrtc {
+class AudioEncoder;
+class FileWrapper;
+}
+
+namespace LiveKitCpp
+{
+
+class OggPageWriter;
+
+// input is resampled to 48 kHz by 10 ms blocks and encoded into 20 ms Opus packets (RFC 7845)
+class OggOpusFileEncoder : public AudioFileEncoder, private webrtc::AudioTrackSinkInterface
+{
+public:
+    OggOpusFileEncoder(int bitrate);
+    ~OggOpusFileEncoder() final;
+    // impl. of AudioFileEncoder
+    bool open(const std::string& filename, int sampleRate, size_t channels) final;
+    bool write(const int16_t* samples, size_t frames) final;
+    void close() final;
+private:
+    bool writeHeaders(size_t channels, int inputSampleRate);
+    bool encode(const int16_t* samples);
+    // impl. of webrtc::AudioTrackSinkInterface
+    void OnData(const void* audioData, int bitsPerSample, int sampleRate,
+                size_t numberOfChannels, size_t numberOfFrames) final;
+private:
+    const int _bitrate;
+    PushAudioPipeline _pipeline;
+    PushAudioPipeline::Sinks _sinks;
+    std::unique_ptr<webrtc::FileWrapper> _file;
+    std::unique_ptr<OggPageWriter> _ogg;
+    std::unique_ptr<webrtc::AudioEncoder> _encoder;
+    webrtc::Buffer _packet;
+    int _inputRate = 0;
+    size_t _inputChannels = 0U;
+    size_t _channels = 0U;
+    // input frames (per channel) at [_inputRate]
+    int64_t _inputFrames = 0;
+    // 48 kHz samples per channel: not yet packetized & total in packets
+    uint32_t _encodedSamples = 0U;
+    int64_t _granule = 0;
+    bool _ok = false;
+};
+
+} // namespace LiveKitCpp
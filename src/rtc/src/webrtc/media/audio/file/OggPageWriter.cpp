@@ -0,0 +1,142 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "OggPageWriter.h"
+#include <rtc_base/system/file_wrapper.h>
+#include <algorithm>
+#include <array>
+
+namespace {
+
+enum HeaderType : uint8_t
+{
+    BeginOfStream = 0x02,
+    EndOfStream = 0x04,
+};
+
+// ~1 second of 20 ms Opus packets per page
+constexpr size_t g_maxPacketsPerPage = 50U;
+constexpr size_t g_maxSegments = 255U;
+constexpr size_t g_headerSize = 27U;
+
+// CRC-32 with polynomial 0x04c11db7, no reflection, zero initial value and no final XOR
+std::array<uint32_t, 256U> makeCrcTable();
+uint32_t crc32(const uint8_t* data, size_t size);
+void writeLE(uint8_t* dst, uint64_t value, size_t bytes);
+
+}
+
+namespace LiveKitCpp
+{
+
+OggPageWriter::OggPageWriter(webrtc::FileWrapper* file, uint32_t serial)
+    : _file(file)
+    , _serial(serial)
+{
+    _lacing.reserve(g_maxSegments);
+}
+
+bool OggPageWriter::addPacket(const uint8_t* data, size_t size, int64_t granule, bool flush)
+{
+    const auto segments = size / 255U + 1U;
+    if (segments > g_maxSegments) {
+        return false;
+    }
+    if (_lacing.size() + segments > g_maxSegments && !flushPage(_granule, false)) {
+        return false;
+    }
+    _lacing.insert(_lacing.end(), segments - 1U, 255U);
+    _lacing.push_back(static_cast<uint8_t>(size % 255U));
+    _body.insert(_body.end(), data, data + size);
+    _granule = granule;
+    if (flush || ++_packets >= g_maxPacketsPerPage) {
+        return flushPage(_granule, false);
+    }
+    return true;
+}
+
+bool OggPageWriter::finish(int64_t granule)
+{
+    // empty page with EOS flag is valid if all packets were already flushed
+    return flushPage(granule, true);
+}
+
+bool OggPageWriter::flushPage(int64_t granule, bool eos)
+{
+    if (_lacing.empty() && !eos) {
+        return true;
+    }
+    uint8_t type = 0U;
+    if (0U == _sequence) {
+        type |= BeginOfStream;
+    }
+    if (eos) {
+        type |= EndOfStream;
+    }
+    _page.resize(g_headerSize + _lacing.size() + _body.size());
+    auto header = _page.data();
+    header[0] = 'O';
+    header[1] = 'g';
+    header[2] = 'g';
+    header[3] = 'S';
+    header[4] = 0U; // version
+    header[5] = type;
+    writeLE(header + 6, static_cast<uint64_t>(granule), 8U);
+    writeLE(header + 14, _serial, 4U);
+    writeLE(header + 18, _sequence++, 4U);
+    writeLE(header + 22, 0U, 4U); // CRC placeholder
+    header[26] = static_cast<uint8_t>(_lacing.size());
+    std::copy(_lacing.begin(), _lacing.end(), header + g_headerSize);
+    std::copy(_body.begin(), _body.end(), header + g_headerSize + _lacing.size());
+    writeLE(header + 22, crc32(_page.data(), _page.size()), 4U);
+    _lacing.clear();
+    _body.clear();
+    _packets = 0U;
+    return _file->Write(_page.data(), _page.size());
+}
+
+} // namespace LiveKitCpp
+
+namespace {
+
+std::array<uint32_t, 256U> makeCrcTable()
+{
+    std::array<uint32_t, 256U> table = {};
+    for (uint32_t i = 0U; i < table.size(); ++i) {
+        uint32_t r = i << 24;
+        for (int bit = 0; bit < 8; ++bit) {
+            r = (r & 0x80000000U) ? ((r << 1) ^ 0x04c11db7U) : (r << 1);
+        }
+        table[i] = r;
+    }
+    return table;
+}
+
+uint32_t crc32(const uint8_t* data, size_t size)
+{
+    static const auto table = makeCrcTable();
+    uint32_t crc = 0U;
+    for (size_t i = 0U; i < size; ++i) {
+        crc = (crc << 8) ^ table[((crc >> 24) ^ data[i]) & 0xFFU];
+    }
+    return crc;
+}
+
+void writeLE(uint8_t* dst, uint64_t value, size_t bytes)
+{
+    for (size_t i = 0U; i < bytes; ++i) {
+        dst[i] = static_cast<uint8_t>(value >> (8U * i));
+    }
+}
+
+}
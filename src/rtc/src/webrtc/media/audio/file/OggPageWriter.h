@@ -0,0 +1,48 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // OggPageWriter.h
+#include <cstdint>
+#include <vector>
+
+namespace webrtc {
+class FileWrapper;
+}
+
+namespace LiveKitCpp
+{
+
+// minimal Ogg muxer (RFC 3533) for a single logical stream,
+// packets larger than 255 lacing values (~64 KB) are not supported
+class OggPageWriter
+{
+public:
+    OggPageWriter(webrtc::FileWrapper* file, uint32_t serial);
+    // [granule] - position after the packet, [flush] - packet ends the page
+    bool addPacket(const uint8_t* data, size_t size, int64_t granule, bool flush = false);
+    // write pending packets (if any) as the last page of the stream
+    bool finish(int64_t granule);
+private:
+    bool flushPage(int64_t granule, bool eos);
+private:
+    webrtc::FileWrapper* const _file;
+    const uint32_t _serial;
+    uint32_t _sequence = 0U;
+    std::vector<uint8_t> _lacing;
+    std::vector<uint8_t> _body;
+    std::vector<uint8_t> _page;
+    size_t _packets = 0U;
+    int64_t _granule = 0;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,73 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "WavFileEncoder.h"
+#include <common_audio/wav_file.h>
+#include <rtc_base/logging.h>
+#include <rtc_base/system/file_wrapper.h>
+#include <limits>
+
+namespace {
+
+// sizes in RIFF header are 32-bit, leave some room for the header itself
+constexpr uint64_t g_maxDataBytes = std::numeric_limits<uint32_t>::max() - 1024U;
+
+}
+
+namespace LiveKitCpp
+{
+
+WavFileEncoder::WavFileEncoder()
+{
+}
+
+WavFileEncoder::~WavFileEncoder()
+{
+    close();
+}
+
+bool WavFileEncoder::open(const std::string& filename, int sampleRate, size_t channels)
+{
+    close();
+    auto file = webrtc::FileWrapper::OpenWriteOnly(filename);
+    if (!file.is_open()) {
+        RTC_LOG(LS_ERROR) << "Failed to open WAV file '" << filename << "' for writing";
+        return false;
+    }
+    _writer = std::make_unique<webrtc::WavWriter>(std::move(file), sampleRate, channels);
+    _channels = channels;
+    return true;
+}
+
+bool WavFileEncoder::write(const int16_t* samples, size_t frames)
+{
+    if (_writer) {
+        const auto bytes = frames * _channels * sizeof(int16_t);
+        if (_dataBytes + bytes <= g_maxDataBytes) {
+            _writer->WriteSamples(samples, frames * _channels);
+            _dataBytes += bytes;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WavFileEncoder::close()
+{
+    // header is updated by destructor of writer
+    _writer.reset();
+    _channels = 0U;
+    _dataBytes = 0ULL;
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,40 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // WavFileEncoder.h
+#include "AudioFileEncoder.h"
+#include <memory>
+
+namespace webrtc {
+class WavWriter;
+}
+
+namespace LiveKitCpp
+{
+
+class WavFileEncoder : public AudioFileEncoder
+{
+public:
+    WavFileEncoder();
+    ~WavFileEncoder() final;
+    // impl. of AudioFileEncoder
+    bool open(const std::string& filename, int sampleRate, size_t channels) final;
+    bool write(const int16_t* samples, size_t frames) final;
+    void close() final;
+private:
+    std::unique_ptr<webrtc::WavWriter> _writer;
+    size_t _channels = 0U;
+    uint64_t _dataBytes = 0ULL;
+};
+
+} // namespace LiveKitCpp
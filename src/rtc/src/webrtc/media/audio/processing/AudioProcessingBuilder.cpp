@@ -36,7 +36,7 @@ absl::Nullable<webrtc::scoped_refptr<webrtc::AudioProcessing>>
     if (processing) {
 #ifdef USE_RN_NOISE_SUPPRESSOR
         if (env.field_trials().IsEnabled("WebRTC-RNNoiseSuppressor")) {
-            processing = webrtc::make_ref_counted<RnNoiseAudioProcessor>(std::move(processing));
+            processing = webrtc::make_ref_counted<RnNoiseAudioProcessor>(std::move(processing), _controller);
         }
 #endif
         return webrtc::make_ref_counted<ControlledAudioProcessor>(std::move(processing), _controller);
@@ -38,6 +38,7 @@ AudioProcessingController::AudioProcessingController()
     : _enableRecProcessing(std::make_shared<Flag>(true))
     , _enablePlayProcessing(std::make_shared<Flag>(true))
     , _writer(std::make_shared<FramesWriter>())
+    , _recVoiceProbability(std::make_shared<Probability>(0.f))
 {
 }
 
@@ -65,6 +66,11 @@ bool AudioProcessingController::playProcessingEnabled() const
     return _enablePlayProcessing && _enablePlayProcessing->load();
 }
 
+float AudioProcessingController::recVoiceProbability() const
+{
+    return _recVoiceProbability ? _recVoiceProbability->load() : 0.f;
+}
+
 void AudioProcessingController::setRecWriter(AudioFramesWriter* writer)
 {
     if (_writer) {
@@ -129,6 +135,13 @@ void AudioProcessingController::commitPlayAudioFrame(const float* data,
     }
 }
 
+void AudioProcessingController::setRecVoiceProbability(float probability) const
+{
+    if (_recVoiceProbability) {
+        _recVoiceProbability->store(probability);
+    }
+}
+
 void AudioProcessingController::FramesWriter::writeRecAudioFrame(const int16_t* data,
                                                                  const webrtc::StreamConfig& config) const
 {
@@ -27,8 +27,10 @@ class AudioFramesWriter;
 class AudioProcessingController
 {
     using Flag = std::atomic_bool;
+    using Probability = std::atomic<float>;
     class FramesWriter;
     friend class ControlledAudioProcessor;
+    friend class RnNoiseAudioProcessor;
 public:
     AudioProcessingController();
     AudioProcessingController(const AudioProcessingController&) = default;
@@ -40,6 +42,9 @@ public:
     void setRecWriter(AudioFramesWriter* writer = nullptr);
     void setPlayWriter(AudioFramesWriter* writer = nullptr);
     bool processingEnabled() const { return recProcessingEnabled() || playProcessingEnabled(); }
+    // voice activity probability [0...1] of the last processed recording frame,
+    // zero if the denoiser is not active
+    float recVoiceProbability() const;
     void notifyThatRecStarted(bool started);
     void notifyThatPlayStarted(bool started);
     AudioProcessingController& operator = (const AudioProcessingController&) = default;
@@ -49,10 +54,12 @@ private:
     void commitRecAudioFrame(const float* data, const webrtc::StreamConfig& config) const;
     void commitPlayAudioFrame(const int16_t* data, const webrtc::StreamConfig& config) const;
     void commitPlayAudioFrame(const float* data, const webrtc::StreamConfig& config) const;
+    void setRecVoiceProbability(float probability) const;
 private:
     std::shared_ptr<Flag> _enableRecProcessing;
     std::shared_ptr<Flag> _enablePlayProcessing;
     std::shared_ptr<FramesWriter> _writer;
+    std::shared_ptr<Probability> _recVoiceProbability;
 };
 
 } // namespace LiveKitCpp
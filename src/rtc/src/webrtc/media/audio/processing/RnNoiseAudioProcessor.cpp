@@ -13,40 +13,15 @@
 // limitations under the License.
 #ifdef USE_RN_NOISE_SUPPRESSOR
 #include "RnNoiseAudioProcessor.h"
-#include "rnnoise.h"
-#include <modules/audio_processing/audio_buffer.h>
-#include <rtc_base/checks.h>
-
-namespace
-{
-
-inline webrtc::AudioBuffer makeBuffer(const webrtc::StreamConfig& config) {
-    return webrtc::AudioBuffer(config.sample_rate_hz(), config.num_channels(),
-                               config.sample_rate_hz(), config.num_channels(),
-                               config.sample_rate_hz(), config.num_channels());
-}
-
-}
+#include "RnNoiseEngine.h"
 
 namespace LiveKitCpp
 {
 
-class RnNoiseAudioProcessor::Denoiser
-{
-public:
-    Denoiser();
-    ~Denoiser();
-    void process(const int16_t* src, const webrtc::StreamConfig& config);
-    void process(const float* const* src, const webrtc::StreamConfig& config);
-private:
-    void denoise(webrtc::AudioBuffer* buffer);
-    void denoiseChannel(float* channel, size_t numFrames);
-private:
-    DenoiseState* const _state;
-};
-
-RnNoiseAudioProcessor::RnNoiseAudioProcessor(webrtc::scoped_refptr<webrtc::AudioProcessing> standardProcessing)
+RnNoiseAudioProcessor::RnNoiseAudioProcessor(webrtc::scoped_refptr<webrtc::AudioProcessing> standardProcessing,
+                                             const AudioProcessingController& controller)
     : AudioProcessingWrapper(std::move(standardProcessing))
+    , _controller(controller)
 {
 }
 
@@ -74,7 +49,9 @@ int RnNoiseAudioProcessor::ProcessStream(const int16_t* const src,
     if (src) {
         LOCK_READ_SAFE_OBJ(_denoiser);
         if (const auto& denoiser = _denoiser.constRef()) {
-            denoiser->process(src, inputConfig);
+            // denoised samples are passed to standard processing
+            denoiser->process(const_cast<int16_t*>(src), inputConfig);
+            _controller.setRecVoiceProbability(denoiser->voiceProbability());
         }
     }
     return AudioProcessingWrapper::ProcessStream(src, inputConfig, outputConfig, dest);
@@ -88,7 +65,8 @@ int RnNoiseAudioProcessor::ProcessStream(const float* const* src,
     if (src) {
         LOCK_READ_SAFE_OBJ(_denoiser);
         if (const auto& denoiser = _denoiser.constRef()) {
-            denoiser->process(src, inputConfig);
+            denoiser->process(const_cast<float* const*>(src), inputConfig);
+            _controller.setRecVoiceProbability(denoiser->voiceProbability());
         }
     }
     return AudioProcessingWrapper::ProcessStream(src, inputConfig, outputConfig, dest);
@@ -98,82 +76,14 @@ void RnNoiseAudioProcessor::createDenoiser()
 {
     LOCK_WRITE_SAFE_OBJ(_denoiser);
     if (!_denoiser.constRef()) {
-        _denoiser = std::make_unique<Denoiser>();
+        _denoiser = std::make_unique<RnNoiseEngine>();
     }
 }
 
 void RnNoiseAudioProcessor::destroyDenoiser()
 {
     _denoiser({});
-}
-
-RnNoiseAudioProcessor::Denoiser::Denoiser()
-    : _state(rnnoise_create(nullptr))
-{
-}
-
-RnNoiseAudioProcessor::Denoiser::~Denoiser()
-{
-    rnnoise_destroy(_state);
-}
-
-void RnNoiseAudioProcessor::Denoiser::process(const int16_t* src,
-                                              const webrtc::StreamConfig& config)
-{
-    if (src) {
-        auto buffer = makeBuffer(config);
-        buffer.CopyFrom(src, config);
-        denoise(&buffer);
-        buffer.CopyTo(config, const_cast<int16_t*>(src));
-    }
-}
-
-void RnNoiseAudioProcessor::Denoiser::process(const float* const* src,
-                                              const webrtc::StreamConfig& config)
-{
-    if (src) {
-        auto buffer = makeBuffer(config);
-        buffer.CopyFrom(src, config);
-        denoise(&buffer);
-        buffer.CopyTo(config, const_cast<float**>(src));
-    }
-}
-
-void RnNoiseAudioProcessor::Denoiser::denoise(webrtc::AudioBuffer* buffer)
-{
-    if (buffer) {
-        const size_t numFrames = buffer->num_frames();
-        for (size_t ch = 0U; ch < buffer->num_channels(); ++ch) {
-            denoiseChannel(buffer->channels()[ch], numFrames);
-        }
-    }
-}
-
-void RnNoiseAudioProcessor::Denoiser::denoiseChannel(float* channel, size_t numFrames)
-{
-    if (channel && numFrames) {
-        const size_t maxFrames = static_cast<size_t>(rnnoise_get_frame_size());
-        // sliding window
-        for (size_t i = 0U; i < numFrames; i += maxFrames) {
-            const auto data = channel + (sizeof(float) * i);
-            if (numFrames - i < maxFrames) {
-                const auto rest = numFrames - i;
-                const auto size = sizeof(float) * rest;
-                std::vector<float> processingBuffer;
-                processingBuffer.resize(maxFrames);
-                // copy source data to processing buffer
-                std::memcpy(processingBuffer.data(), data, size);
-                // padding zero
-                std::memset(processingBuffer.data() + size, 0, processingBuffer.size() - size);
-                rnnoise_process_frame(_state, processingBuffer.data(), processingBuffer.data());
-                // copy processed data to source buffer
-                std::memcpy(data, processingBuffer.data(), size);
-            }
-            else {
-                rnnoise_process_frame(_state, data, data);
-            }
-        }
-    }
+    _controller.setRecVoiceProbability(0.f);
 }
 
 } // namespace LiveKitCpp
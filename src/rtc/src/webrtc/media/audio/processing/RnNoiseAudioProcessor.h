@@ -14,16 +14,20 @@
 #pragma once // AudioProcessor.h
 #ifdef USE_RN_NOISE_SUPPRESSOR
 #include "AudioProcessingWrapper.h"
+#include "AudioProcessingController.h"
 #include "SafeObjAliases.h"
 
 namespace LiveKitCpp
 {
 
+class RnNoiseEngine;
+
 class RnNoiseAudioProcessor : public AudioProcessingWrapper
 {
-    class Denoiser;
 public:
-    RnNoiseAudioProcessor(webrtc::scoped_refptr<webrtc::AudioProcessing> standardProcessing);
+    // voice activity probability of the last processed frame is reported to the controller
+    RnNoiseAudioProcessor(webrtc::scoped_refptr<webrtc::AudioProcessing> standardProcessing,
+                          const AudioProcessingController& controller);
     ~RnNoiseAudioProcessor() override;
     // overrides of AudioProcessingWrapper
     void ApplyConfig(const webrtc::AudioProcessing::Config& config) final;
@@ -39,7 +43,8 @@ private:
     void createDenoiser();
     void destroyDenoiser();
 private:
-    Bricks::SafeUniquePtr<Denoiser> _denoiser;
+    const AudioProcessingController _controller;
+    Bricks::SafeUniquePtr<RnNoiseEngine> _denoiser;
 };
 
 } // namespace LiveKitCpp
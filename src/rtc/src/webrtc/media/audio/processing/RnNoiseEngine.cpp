@@ -0,0 +1,209 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifdef USE_RN_NOISE_SUPPRESSOR
+#include "RnNoiseEngine.h"
+#include "rnnoise.h"
+#include <common_audio/include/audio_util.h>
+#include <common_audio/resampler/push_sinc_resampler.h>
+#include <algorithm>
+#include <array>
+
+namespace LiveKitCpp
+{
+
+class RnNoiseEngine::Channel
+{
+public:
+    Channel(int sampleRate, size_t blockSize);
+    ~Channel();
+    // 10 ms block at the stream rate, in FloatS16 scale (as expected by RNNoise)
+    float* samples() { return _samples.data(); }
+    // previous processed block, source of output in delayed mode
+    const float* delayed() const { return _delayed.data(); }
+    // processed block becomes the delayed one, without copying
+    void swapDelayed() { _samples.swap(_delayed); }
+    float voiceProbability() const { return _voiceProbability; }
+    // denoise [samples] in place
+    void process();
+private:
+    DenoiseState* const _state;
+    // both are null for the native rate
+    const std::unique_ptr<webrtc::PushSincResampler> _upsampler;
+    const std::unique_ptr<webrtc::PushSincResampler> _downsampler;
+    std::vector<float> _samples;
+    std::vector<float> _delayed;
+    std::array<float, nativeFrameSize()> _frame = {};
+    float _voiceProbability = 0.f;
+};
+
+RnNoiseEngine::RnNoiseEngine() = default;
+
+RnNoiseEngine::~RnNoiseEngine() = default;
+
+void RnNoiseEngine::process(int16_t* data, const webrtc::StreamConfig& config)
+{
+    if (data && configure(config)) {
+        const auto channels = _channels.size();
+        const auto frames = config.num_frames();
+        if (!_delayed && 0U != frames % _blockSize) {
+            _delayed = true;
+        }
+        if (_delayed) {
+            for (size_t offset = 0U; offset < frames;) {
+                const auto count = std::min(frames - offset, _blockSize - _pending);
+                for (size_t ch = 0U; ch < channels; ++ch) {
+                    const auto input = _channels[ch]->samples() + _pending;
+                    const auto output = _channels[ch]->delayed() + _pending;
+                    for (size_t i = 0U; i < count; ++i) {
+                        auto& sample = data[(offset + i) * channels + ch];
+                        input[i] = sample;
+                        sample = webrtc::FloatS16ToS16(output[i]);
+                    }
+                }
+                offset += count;
+                _pending += count;
+                if (_pending == _blockSize) {
+                    processBlock();
+                    _pending = 0U;
+                }
+            }
+        }
+        else {
+            for (size_t offset = 0U; offset < frames; offset += _blockSize) {
+                const auto block = data + offset * channels;
+                for (size_t ch = 0U; ch < channels; ++ch) {
+                    const auto samples = _channels[ch]->samples();
+                    for (size_t i = 0U; i < _blockSize; ++i) {
+                        samples[i] = block[i * channels + ch];
+                    }
+                }
+                processBlock();
+                for (size_t ch = 0U; ch < channels; ++ch) {
+                    const auto samples = _channels[ch]->samples();
+                    for (size_t i = 0U; i < _blockSize; ++i) {
+                        block[i * channels + ch] = webrtc::FloatS16ToS16(samples[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void RnNoiseEngine::process(float* const* data, const webrtc::StreamConfig& config)
+{
+    if (data && configure(config)) {
+        const auto channels = _channels.size();
+        const auto frames = config.num_frames();
+        if (!_delayed && 0U != frames % _blockSize) {
+            _delayed = true;
+        }
+        if (_delayed) {
+            for (size_t offset = 0U; offset < frames;) {
+                const auto count = std::min(frames - offset, _blockSize - _pending);
+                for (size_t ch = 0U; ch < channels; ++ch) {
+                    const auto input = _channels[ch]->samples() + _pending;
+                    const auto output = _channels[ch]->delayed() + _pending;
+                    const auto samples = data[ch] + offset;
+                    for (size_t i = 0U; i < count; ++i) {
+                        input[i] = webrtc::FloatToFloatS16(samples[i]);
+                        samples[i] = webrtc::FloatS16ToFloat(output[i]);
+                    }
+                }
+                offset += count;
+                _pending += count;
+                if (_pending == _blockSize) {
+                    processBlock();
+                    _pending = 0U;
+                }
+            }
+        }
+        else {
+            for (size_t offset = 0U; offset < frames; offset += _blockSize) {
+                for (size_t ch = 0U; ch < channels; ++ch) {
+                    webrtc::FloatToFloatS16(data[ch] + offset, _blockSize, _channels[ch]->samples());
+                }
+                processBlock();
+                for (size_t ch = 0U; ch < channels; ++ch) {
+                    webrtc::FloatS16ToFloat(_channels[ch]->samples(), _blockSize, data[ch] + offset);
+                }
+            }
+        }
+    }
+}
+
+bool RnNoiseEngine::configure(const webrtc::StreamConfig& config)
+{
+    const auto sampleRate = config.sample_rate_hz();
+    const auto channels = config.num_channels();
+    if (sampleRate != _sampleRate || channels != _channels.size()) {
+        _channels.clear();
+        _sampleRate = 0;
+        _blockSize = 0U;
+        _pending = 0U;
+        _delayed = false;
+        if (sampleRate >= 100 && channels > 0U) {
+            _blockSize = static_cast<size_t>(sampleRate / 100);
+            _channels.reserve(channels);
+            for (size_t ch = 0U; ch < channels; ++ch) {
+                _channels.push_back(std::make_unique<Channel>(sampleRate, _blockSize));
+            }
+            _sampleRate = sampleRate;
+        }
+    }
+    return !_channels.empty();
+}
+
+void RnNoiseEngine::processBlock()
+{
+    float voiceProbability = 0.f;
+    for (const auto& channel : _channels) {
+        channel->process();
+        voiceProbability = std::max(voiceProbability, channel->voiceProbability());
+        if (_delayed) {
+            channel->swapDelayed();
+        }
+    }
+    _voiceProbability = voiceProbability;
+}
+
+RnNoiseEngine::Channel::Channel(int sampleRate, size_t blockSize)
+    : _state(rnnoise_create(nullptr))
+    , _upsampler(nativeSampleRate() == sampleRate ? nullptr :
+                 std::make_unique<webrtc::PushSincResampler>(blockSize, nativeFrameSize()))
+    , _downsampler(nativeSampleRate() == sampleRate ? nullptr :
+                   std::make_unique<webrtc::PushSincResampler>(nativeFrameSize(), blockSize))
+    , _samples(blockSize, 0.f)
+    , _delayed(blockSize, 0.f)
+{
+}
+
+RnNoiseEngine::Channel::~Channel()
+{
+    rnnoise_destroy(_state);
+}
+
+void RnNoiseEngine::Channel::process()
+{
+    if (_upsampler && _downsampler) {
+        _upsampler->Resample(_samples.data(), _samples.size(), _frame.data(), _frame.size());
+        _voiceProbability = rnnoise_process_frame(_state, _frame.data(), _frame.data());
+        _downsampler->Resample(_frame.data(), _frame.size(), _samples.data(), _samples.size());
+    }
+    else {
+        _voiceProbability = rnnoise_process_frame(_state, _samples.data(), _samples.data());
+    }
+}
+
+} // namespace LiveKitCpp
+#endif
@@ -0,0 +1,59 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // RnNoiseEngine.h
+#ifdef USE_RN_NOISE_SUPPRESSOR
+#include <api/audio/audio_processing.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// RNNoise denoiser with preallocated per-channel state, all buffers are allocated
+// only when stream format is changed, so no heap activity on the real-time audio thread;
+// input is split into 10 ms blocks and resampled to native 48 kHz rate (480 samples per frame)
+// if needed, channels are processed sequentially on the caller thread;
+// if input is not a multiple of 10 ms block then the tail is carried over to the next call
+// and the output is delayed for one block (until the next format change)
+class RnNoiseEngine
+{
+    class Channel;
+public:
+    RnNoiseEngine();
+    ~RnNoiseEngine();
+    static constexpr int nativeSampleRate() { return 48000; }
+    static constexpr size_t nativeFrameSize() { return nativeSampleRate() / 100; }
+    // voice activity probability [0...1] of the last processed block,
+    // maximum across all channels
+    float voiceProbability() const { return _voiceProbability; }
+    // interleaved samples, denoised in place
+    void process(int16_t* data, const webrtc::StreamConfig& config);
+    // deinterleaved samples in [-1...1] range, denoised in place
+    void process(float* const* data, const webrtc::StreamConfig& config);
+private:
+    bool configure(const webrtc::StreamConfig& config);
+    void processBlock();
+private:
+    std::vector<std::unique_ptr<Channel>> _channels;
+    int _sampleRate = 0;
+    size_t _blockSize = 0U;
+    // delayed mode: number of samples (per channel) accumulated in the current block
+    size_t _pending = 0U;
+    bool _delayed = false;
+    std::atomic<float> _voiceProbability = 0.f;
+};
+
+} // namespace LiveKitCpp
+#endif
@@ -0,0 +1,106 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AsyncPushAudioSourceImpl.h"
+#include <api/audio/builtin_audio_processing_builder.h>
+#include <api/environment/environment_factory.h>
+
+namespace LiveKitCpp
+{
+
+AsyncPushAudioSourceImpl::AsyncPushAudioSourceImpl(std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
+                                                   const std::shared_ptr<Bricks::Logger>& logger,
+                                                   const AudioRecordingOptions& options)
+    : AsyncAudioSourceImpl(std::move(signalingQueue), logger, true)
+    , _apm(createApm(options))
+    , _stereoSwapping(options._stereoSwapping.value_or(false))
+{
+}
+
+AsyncPushAudioSourceImpl::~AsyncPushAudioSourceImpl()
+{
+    close();
+    _sinks.clear();
+}
+
+bool AsyncPushAudioSourceImpl::pushFrames(const int16_t* data, int sampleRate,
+                                          size_t channels, size_t frames)
+{
+    return push(data, sampleRate, channels, frames);
+}
+
+bool AsyncPushAudioSourceImpl::pushFrames(const float* data, int sampleRate,
+                                          size_t channels, size_t frames)
+{
+    return push(data, sampleRate, channels, frames);
+}
+
+void AsyncPushAudioSourceImpl::addSink(webrtc::AudioTrackSinkInterface* sink)
+{
+    _sinks.add(sink);
+}
+
+void AsyncPushAudioSourceImpl::removeSink(webrtc::AudioTrackSinkInterface* sink)
+{
+    _sinks.remove(sink);
+}
+
+std::string_view AsyncPushAudioSourceImpl::logCategory() const
+{
+    static const std::string_view category("push_audio_source");
+    return category;
+}
+
+void AsyncPushAudioSourceImpl::onMuted()
+{
+    AsyncAudioSourceImpl::onMuted();
+    // don't glue samples before & after of mute
+    LOCK_WRITE_SAFE_OBJ(_pipeline);
+    _pipeline->reset();
+}
+
+template <typename T>
+bool AsyncPushAudioSourceImpl::push(const T* data, int sampleRate, size_t channels, size_t frames)
+{
+    if (!data || !frames || !channels || !active() || !enabled() || _sinks.empty()) {
+        return false;
+    }
+    if (!PushAudioPipeline::validSampleRate(sampleRate)) {
+        if (canLogWarning()) {
+            logWarning("sample rate " + std::to_string(sampleRate) + " Hz is not supported, samples dropped");
+        }
+        return false;
+    }
+    LOCK_WRITE_SAFE_OBJ(_pipeline);
+    _pipeline->setFormat(sampleRate, channels);
+    _pipeline->write(data, frames, _stereoSwapping, _apm.get(), _sinks);
+    return true;
+}
+
+webrtc::scoped_refptr<webrtc::AudioProcessing> AsyncPushAudioSourceImpl::
+    createApm(const AudioRecordingOptions& options)
+{
+    // echo cancellation is not applicable: there is no playout reference for pushed audio
+    webrtc::AudioProcessing::Config config;
+    config.high_pass_filter.enabled = options._highpassFilter.value_or(false);
+    config.noise_suppression.enabled = options._noiseSuppression.value_or(false);
+    config.gain_controller1.enabled = options._autoGainControl.value_or(false);
+    config.gain_controller1.mode = webrtc::AudioProcessing::Config::GainController1::kAdaptiveDigital;
+    if (config.high_pass_filter.enabled || config.noise_suppression.enabled ||
+        config.gain_controller1.enabled) {
+        return webrtc::BuiltinAudioProcessingBuilder(config).Build(webrtc::CreateEnvironment());
+    }
+    return {};
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,57 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AsyncPushAudioSourceImpl.h
+#include "AsyncAudioSourceImpl.h"
+#include "PushAudioPipeline.h"
+#include "SafeObj.h"
+#include "livekit/rtc/media/AudioRecordingOptions.h"
+#include <api/scoped_refptr.h>
+
+namespace LiveKitCpp
+{
+
+class AsyncPushAudioSourceImpl : public AsyncAudioSourceImpl
+{
+public:
+    AsyncPushAudioSourceImpl(std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
+                             const std::shared_ptr<Bricks::Logger>& logger,
+                             const AudioRecordingOptions& options);
+    ~AsyncPushAudioSourceImpl() final;
+    // thread-safe, returns false if samples were dropped
+    bool pushFrames(const int16_t* data, int sampleRate, size_t channels, size_t frames);
+    bool pushFrames(const float* data, int sampleRate, size_t channels, size_t frames);
+    // impl. of AsyncAudioSourceImpl
+    void addSink(webrtc::AudioTrackSinkInterface* sink) final;
+    void removeSink(webrtc::AudioTrackSinkInterface* sink) final;
+    // options are not reported to webrtc, otherwise they would be applied to
+    // the shared APM of recording device, own APM is used instead
+    webrtc::AudioOptions options() const final { return {}; }
+protected:
+    // impl. of Bricks::LoggableS<>
+    std::string_view logCategory() const final;
+    // overrides of AsyncMediaSourceImpl
+    void onMuted() final;
+private:
+    template <typename T>
+    bool push(const T* data, int sampleRate, size_t channels, size_t frames);
+    static webrtc::scoped_refptr<webrtc::AudioProcessing> createApm(const AudioRecordingOptions& options);
+private:
+    // null if no processing was requested
+    const webrtc::scoped_refptr<webrtc::AudioProcessing> _apm;
+    const bool _stereoSwapping;
+    PushAudioPipeline::Sinks _sinks;
+    Bricks::SafeObj<PushAudioPipeline> _pipeline;
+};
+
+} // namespace LiveKitCpp
@@ -0,0 +1,190 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "PushAudioPipeline.h"
+#include <api/audio/channel_layout.h>
+#include <audio/utility/channel_mixing_matrix.h>
+#include <common_audio/include/audio_util.h>
+#include <common_audio/resampler/push_sinc_resampler.h>
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+
+// native rate of Opus & APM, no resampling is needed down the pipeline
+constexpr int g_outputRate = 48000;
+constexpr size_t g_outputFrames = g_outputRate / 100;
+constexpr size_t g_maxOutputChannels = 2U;
+// 100 ms
+constexpr size_t g_maxBlockDuration = 10U;
+
+inline float toFloatS16(int16_t sample) { return static_cast<float>(sample); }
+
+inline float toFloatS16(float sample) { return webrtc::FloatToFloatS16(sample); }
+
+}
+
+namespace LiveKitCpp
+{
+
+PushAudioPipeline::PushAudioPipeline() = default;
+
+PushAudioPipeline::~PushAudioPipeline() = default;
+
+bool PushAudioPipeline::validSampleRate(int sampleRate)
+{
+    return sampleRate > 0 && blockDuration(sampleRate) <= g_maxBlockDuration;
+}
+
+void PushAudioPipeline::setFormat(int sampleRate, size_t channels)
+{
+    if (sampleRate != _inputRate || channels != _inputChannels) {
+        _inputRate = sampleRate;
+        _inputChannels = channels;
+        _blockDuration = blockDuration(sampleRate);
+        _blockFrames = static_cast<size_t>(sampleRate) * _blockDuration / 100U;
+        _pendingFrames = 0U;
+        _channels.assign(std::min(channels, g_maxOutputChannels), std::vector<float>(_blockFrames));
+        _downmix = downmixMatrix(channels, outputChannels());
+        _frame.resize(g_outputFrames * outputChannels());
+        _resamplers.clear();
+        _resampled.clear();
+        if (g_outputRate != sampleRate) {
+            const auto outputFrames = g_outputFrames * _blockDuration;
+            _resamplers.reserve(outputChannels());
+            for (size_t i = 0U; i < outputChannels(); ++i) {
+                _resamplers.push_back(std::make_unique<webrtc::PushSincResampler>(_blockFrames, outputFrames));
+            }
+            _resampled.assign(outputChannels(), std::vector<float>(outputFrames));
+        }
+    }
+}
+
+void PushAudioPipeline::write(const int16_t* data, size_t frames, bool stereoSwapping,
+                              webrtc::AudioProcessing* apm, const Sinks& sinks)
+{
+    append(data, frames, stereoSwapping, apm, sinks);
+}
+
+void PushAudioPipeline::write(const float* data, size_t frames, bool stereoSwapping,
+                              webrtc::AudioProcessing* apm, const Sinks& sinks)
+{
+    append(data, frames, stereoSwapping, apm, sinks);
+}
+
+template <typename T>
+void PushAudioPipeline::append(const T* data, size_t frames, bool stereoSwapping,
+                               webrtc::AudioProcessing* apm, const Sinks& sinks)
+{
+    if (data && _blockFrames) {
+        for (size_t offset = 0U; offset < frames;) {
+            const auto count = std::min(frames - offset, _blockFrames - _pendingFrames);
+            if (_downmix.empty()) {
+                for (size_t ch = 0U; ch < outputChannels(); ++ch) {
+                    auto dst = _channels[ch].data() + _pendingFrames;
+                    auto src = data + offset * _inputChannels + ch;
+                    for (size_t i = 0U; i < count; ++i, src += _inputChannels) {
+                        dst[i] = toFloatS16(*src);
+                    }
+                }
+            }
+            else {
+                auto src = data + offset * _inputChannels;
+                for (size_t i = 0U; i < count; ++i, src += _inputChannels) {
+                    auto coeffs = _downmix.data();
+                    for (size_t ch = 0U; ch < outputChannels(); ++ch) {
+                        float sample = 0.f;
+                        for (size_t in = 0U; in < _inputChannels; ++in) {
+                            sample += *coeffs++ * toFloatS16(src[in]);
+                        }
+                        _channels[ch][_pendingFrames + i] = sample;
+                    }
+                }
+            }
+            offset += count;
+            _pendingFrames += count;
+            if (_pendingFrames == _blockFrames) {
+                flush(stereoSwapping, apm, sinks);
+                _pendingFrames = 0U;
+            }
+        }
+    }
+}
+
+void PushAudioPipeline::flush(bool stereoSwapping, webrtc::AudioProcessing* apm, const Sinks& sinks)
+{
+    using OnData = void(webrtc::AudioTrackSinkInterface::*)(const void*, int, int, size_t,
+                                                             size_t, std::optional<int64_t>);
+    const auto channels = outputChannels();
+    for (size_t ch = 0U; ch < _resamplers.size(); ++ch) {
+        _resamplers[ch]->Resample(_channels[ch].data(), _blockFrames,
+                                  _resampled[ch].data(), _resampled[ch].size());
+    }
+    const auto& output = _resamplers.empty() ? _channels : _resampled;
+    for (size_t frame = 0U; frame < _blockDuration; ++frame) {
+        for (size_t ch = 0U; ch < channels; ++ch) {
+            const auto samples = output[ch].data() + frame * g_outputFrames;
+            for (size_t i = 0U; i < g_outputFrames; ++i) {
+                _frame[i * channels + ch] = webrtc::FloatS16ToS16(samples[i]);
+            }
+        }
+        if (stereoSwapping && 2U == channels) {
+            for (size_t i = 0U; i < _frame.size(); i += 2U) {
+                std::swap(_frame[i], _frame[i + 1U]);
+            }
+        }
+        if (apm) {
+            const webrtc::StreamConfig config(g_outputRate, channels);
+            apm->ProcessStream(_frame.data(), config, config, _frame.data());
+        }
+        sinks.invoke(static_cast<OnData>(&webrtc::AudioTrackSinkInterface::OnData),
+                     _frame.data(), 16, g_outputRate, channels, g_outputFrames, std::nullopt);
+    }
+}
+
+size_t PushAudioPipeline::blockDuration(int sampleRate)
+{
+    // smallest count of 10 ms frames with whole number of input samples
+    return 100U / static_cast<size_t>(std::gcd(sampleRate, 100));
+}
+
+std::vector<float> PushAudioPipeline::downmixMatrix(size_t inputChannels, size_t outputChannels)
+{
+    std::vector<float> matrix;
+    if (inputChannels > outputChannels) {
+        // standard layouts for up to 8 channels (5.1, 7.1, etc.): center is mixed to both sides,
+        // for unknown layouts first channels are taken
+        const auto inputLayout = webrtc::GuessChannelLayout(int(inputChannels));
+        const auto outputLayout = webrtc::GuessChannelLayout(int(outputChannels));
+        if (webrtc::CHANNEL_LAYOUT_UNSUPPORTED != inputLayout &&
+            webrtc::CHANNEL_LAYOUT_UNSUPPORTED != outputLayout) {
+            std::vector<std::vector<float>> coeffs;
+            webrtc::ChannelMixingMatrix mixing(inputLayout, int(inputChannels),
+                                               outputLayout, int(outputChannels));
+            mixing.CreateTransformationMatrix(&coeffs);
+            if (coeffs.size() == outputChannels) {
+                matrix.reserve(inputChannels * outputChannels);
+                for (const auto& row : coeffs) {
+                    if (row.size() != inputChannels) {
+                        return {};
+                    }
+                    matrix.insert(matrix.end(), row.begin(), row.end());
+                }
+            }
+        }
+    }
+    return matrix;
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,75 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // PushAudioPipeline.h
+#include "Listeners.h"
+#include <api/audio/audio_processing.h>
+#include <api/media_stream_interface.h>
+#include <memory>
+#include <vector>
+
+namespace webrtc {
+class PushSincResampler;
+}
+
+namespace LiveKitCpp
+{
+
+// input is downmixed to stereo (if needed) and split into blocks of whole number of input frames
+// (deinterleaved, FloatS16 scale): 10 ms for rates multiple of 100 Hz, 20 ms for 22050 Hz, 40 ms for 11025 Hz, etc.,
+// every full block is resampled to 48 kHz, split into 10 ms frames, processed by APM and delivered to sinks,
+// not thread-safe
+class PushAudioPipeline
+{
+public:
+    using Sinks = Bricks::Listeners<webrtc::AudioTrackSinkInterface*>;
+public:
+    PushAudioPipeline();
+    ~PushAudioPipeline();
+    // block is not longer than 100 ms: rate is multiple of 10 Hz or 25 Hz
+    static bool validSampleRate(int sampleRate);
+    // buffers & resamplers are re-created only if format was changed
+    void setFormat(int sampleRate, size_t channels);
+    // drop incomplete block
+    void reset() { _pendingFrames = 0U; }
+    // input frames missing to complete the current block, 0 if there is no incomplete block
+    size_t missingFrames() const noexcept { return _pendingFrames ? _blockFrames - _pendingFrames : 0U; }
+    void write(const int16_t* data, size_t frames, bool stereoSwapping,
+               webrtc::AudioProcessing* apm, const Sinks& sinks);
+    void write(const float* data, size_t frames, bool stereoSwapping,
+               webrtc::AudioProcessing* apm, const Sinks& sinks);
+private:
+    size_t outputChannels() const noexcept { return _channels.size(); }
+    // number of 10 ms frames in block
+    static size_t blockDuration(int sampleRate);
+    // row-major [output x input] matrix or empty if first channels are taken as is
+    static std::vector<float> downmixMatrix(size_t inputChannels, size_t outputChannels);
+    template <typename T>
+    void append(const T* data, size_t frames, bool stereoSwapping,
+                webrtc::AudioProcessing* apm, const Sinks& sinks);
+    void flush(bool stereoSwapping, webrtc::AudioProcessing* apm, const Sinks& sinks);
+private:
+    int _inputRate = 0;
+    size_t _inputChannels = 0U;
+    size_t _blockFrames = 0U;
+    size_t _blockDuration = 0U;
+    std::vector<float> _downmix;
+    // per output channel, empty if input rate is 48 kHz
+    std::vector<std::unique_ptr<webrtc::PushSincResampler>> _resamplers;
+    std::vector<std::vector<float>> _channels;
+    std::vector<std::vector<float>> _resampled;
+    std::vector<int16_t> _frame;
+    size_t _pendingFrames = 0U;
+};
+
+} // namespace LiveKitCpp
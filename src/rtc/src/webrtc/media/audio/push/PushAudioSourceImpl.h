@@ -0,0 +1,36 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // PushAudioSourceImpl.h
+#include "AsyncPushAudioSourceImpl.h"
+#include "livekit/rtc/media/PushAudioSource.h"
+#include <atomic>
+
+namespace LiveKitCpp
+{
+
+class PushAudioSourceImpl : public PushAudioSource
+{
+public:
+    PushAudioSourceImpl(std::shared_ptr<AsyncPushAudioSourceImpl> impl);
+    // only one device can be created for the source
+    std::shared_ptr<AsyncPushAudioSourceImpl> attach();
+    // impl. of PushAudioSource
+    bool pushFrames(const int16_t* data, int sampleRate, size_t channels, size_t frames) final;
+    bool pushFrames(const float* data, int sampleRate, size_t channels, size_t frames) final;
+private:
+    const std::shared_ptr<AsyncPushAudioSourceImpl> _impl;
+    std::atomic_bool _attached = false;
+};
+
+} // namespace LiveKitCpp
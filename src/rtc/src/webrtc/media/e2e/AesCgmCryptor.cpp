@@ -13,6 +13,7 @@
 // limitations under the License.
 #include "AesCgmCryptor.h"
 #include "AesCgmCryptorObserver.h"
+#include "Metrics.h"
 #include "Utils.h"
 #include "livekit/rtc/e2e/KeyProvider.h"
 #include "livekit/rtc/e2e/KeyProviderOptions.h"
@@ -20,8 +21,12 @@
 #include <common_video/h264/h264_common.h>
 #include <common_video/h265/h265_common.h>
 #include <openssl/aead.h>
+#include <rtc_base/byte_order.h>
+#include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <map>
+#include <vector>
 
 namespace
 {
@@ -29,6 +34,7 @@ namespace
 using Sinks = std::map<uint32_t, webrtc::scoped_refptr<webrtc::TransformedFrameCallback>>;
 
 const std::string_view g_category("frame_codec");
+constexpr unsigned g_tagLengthBytes = 128U / 8U;
 
 inline void logInitError(const std::shared_ptr<Bricks::Logger>& logger,
                          std::string_view errorMessage) {
@@ -51,7 +57,7 @@ inline const EVP_AEAD* aesGcmAlgorithmFromKeySize(size_t keySizeBytes)
 }
 
 inline bool needsRbspUnescaping(const uint8_t* frameData, size_t frameSize) {
-    for (size_t i = 0; i < frameSize - 3; ++i) {
+    for (size_t i = 0; i + 2U < frameSize; ++i) {
         if (frameData[i] == 0 &&
             frameData[i + 1] == 0 &&
             frameData[i + 2] == 3) {
@@ -61,7 +67,25 @@ inline bool needsRbspUnescaping(const uint8_t* frameData, size_t frameSize) {
     return false;
 }
 
+inline bool isFailure(LiveKitCpp::AesCgmCryptorState state) {
+    switch (state) {
+        case LiveKitCpp::AesCgmCryptorState::New:
+        case LiveKitCpp::AesCgmCryptorState::Ok:
+        case LiveKitCpp::AesCgmCryptorState::KeyRatcheted:
+            return false;
+        default:
+            break;
+    }
+    return true;
+}
+
 uint8_t unencryptedBytes(const webrtc::TransformableFrameInterface* frame, webrtc::MediaType type);
+// RBSP unescaping of H264/H265 payload (the same as webrtc::H264::ParseRbsp),
+// [output] is cleared but keeps the capacity
+void parseRbsp(webrtc::ArrayView<const uint8_t> data, std::vector<uint8_t>& output);
+// emulation prevention of H264/H265 (the same as webrtc::H264::WriteRbsp) for
+// [offset, size) region of [buffer], in place
+void writeRbsp(webrtc::Buffer& buffer, size_t offset);
 bool frameIsH264(const webrtc::TransformableFrameInterface* frame, webrtc::MediaType type);
 bool frameIsH265(const webrtc::TransformableFrameInterface* frame, webrtc::MediaType type);
 
@@ -70,6 +94,26 @@ bool frameIsH265(const webrtc::TransformableFrameInterface* frame, webrtc::Media
 namespace LiveKitCpp
 {
 
+class AesCgmCryptor::AeadContext
+{
+public:
+    AeadContext(const EVP_AEAD* algorithm, const std::vector<uint8_t>& key);
+    bool init();
+    bool sameKey(const std::vector<uint8_t>& key) const { return key == _key; }
+    bool seal(webrtc::ArrayView<const uint8_t> iv,
+              webrtc::ArrayView<const uint8_t> additionalData,
+              webrtc::ArrayView<const uint8_t> data,
+              webrtc::Buffer& output) const;
+    bool open(webrtc::ArrayView<const uint8_t> iv,
+              webrtc::ArrayView<const uint8_t> additionalData,
+              webrtc::ArrayView<const uint8_t> data,
+              webrtc::Buffer& output) const;
+private:
+    const EVP_AEAD* const _algorithm;
+    const std::vector<uint8_t> _key;
+    bssl::ScopedEVP_AEAD_CTX _ctx;
+};
+
 AesCgmCryptor::AesCgmCryptor(webrtc::MediaType mediaType,
                              std::string identity,
                              std::string trackId,
@@ -237,47 +281,30 @@ void AesCgmCryptor::encryptFrame(std::unique_ptr<webrtc::TransformableFrameInter
             return;
         }
         
-        const auto frameHeaderSize = unencryptedBytes(frame.get(), _mediaType);
-        webrtc::Buffer frameHeader(frameHeaderSize);
-        for (size_t i = 0U; i < frameHeaderSize; i++) {
-            frameHeader[i] = dataIn[i];
-        }
+        // per-thread buffer keeps its capacity between frames,
+        // so steady-state encryption doesn't touch the heap
+        static thread_local webrtc::Buffer dataOut;
         
-        webrtc::Buffer iv = makeIv(frame->GetSsrc(), frame->GetTimestamp());
+        const auto frameHeaderSize = std::min<size_t>(dataIn.size(), unencryptedBytes(frame.get(), _mediaType));
+        const auto frameHeader = dataIn.subview(0U, frameHeaderSize);
+        const auto payload = dataIn.subview(frameHeaderSize);
         
-        webrtc::Buffer payload(dataIn.size() - frameHeaderSize);
-        for (size_t i = frameHeaderSize; i < dataIn.size(); i++) {
-            payload[i - frameHeaderSize] = dataIn[i];
-        }
+        std::array<uint8_t, ivSize()> iv;
+        makeIv(frame->GetSsrc(), frame->GetTimestamp(), iv.data());
         
-        std::vector<uint8_t> buffer;
-        if (encryptOrDecrypt(true, keySet->_encryptionKey, iv, frameHeader,
-                             payload, buffer)) {
-            webrtc::Buffer frameTrailer(2U);
-            frameTrailer[0] = ivSize();
-            frameTrailer[1] = _keyIndex;
-            
-            webrtc::Buffer encryptedPayload(buffer.data(), buffer.size());
-            webrtc::Buffer tag(encryptedPayload.data() + encryptedPayload.size() - 16, 16);
-            
-            webrtc::Buffer dataWithoutHeader;
-            dataWithoutHeader.AppendData(encryptedPayload);
-            dataWithoutHeader.AppendData(iv);
-            dataWithoutHeader.AppendData(frameTrailer);
-
-            webrtc::Buffer dataOut;
-            dataOut.AppendData(frameHeader);
-            if (frameIsH264(frame.get(), _mediaType)) {
-                webrtc::H264::WriteRbsp(dataWithoutHeader, &dataOut);
-            }
-            else if (frameIsH265(frame.get(), _mediaType)) {
-                webrtc::H265::WriteRbsp(dataWithoutHeader, &dataOut);
+        // frame is sealed directly behind the header, H264/H265 output is escaped in place
+        dataOut.SetData(frameHeader);
+        if (encryptOrDecrypt(true, keyIndex, keySet->_encryptionKey, iv,
+                             frameHeader, payload, dataOut)) {
+            const uint8_t frameTrailer[2] = {ivSize(), keyIndex};
+            dataOut.AppendData(iv.data(), iv.size());
+            dataOut.AppendData(frameTrailer, sizeof(frameTrailer));
+            if (frameIsH264(frame.get(), _mediaType) || frameIsH265(frame.get(), _mediaType)) {
+                writeRbsp(dataOut, frameHeaderSize);
             }
             else {
-                dataOut.AppendData(dataWithoutHeader);
-                RTC_CHECK_EQ(dataOut.size(), frameHeader.size() +
-                             encryptedPayload.size() + iv.size() +
-                             frameTrailer.size());
+                RTC_CHECK_EQ(dataOut.size(), frameHeader.size() + payload.size() +
+                             g_tagLengthBytes + iv.size() + sizeof(frameTrailer));
             }
             frame->SetData(dataOut);
             setLastEncryptState(AesCgmCryptorState::Ok);
@@ -312,6 +339,11 @@ void AesCgmCryptor::decryptFrame(std::unique_ptr<webrtc::TransformableFrameInter
             return;
         }
         
+        // the frame is decrypted directly behind the header of [dataOut],
+        // per-thread buffers keep their capacity between frames
+        static thread_local webrtc::Buffer dataOut;
+        static thread_local std::vector<uint8_t> unescaped;
+        
         const auto dataIn = frame->GetData();
         if (dataIn.empty() || !_enabledCryption) {
             if (canLogWarning()) {
@@ -326,13 +358,11 @@ void AesCgmCryptor::decryptFrame(std::unique_ptr<webrtc::TransformableFrameInter
         
         const auto sif = _keyProvider->sifTrailer();
         if (!sif.empty() && dataIn.size() >= sif.size()) {
-            auto tmp = dataIn.subview(dataIn.size() - (sif.size()), sif.size());
-            std::vector<uint8_t> data(tmp.begin(), tmp.end());
-            if (data == sif) {
+            if (std::equal(sif.begin(), sif.end(), dataIn.end() - sif.size())) {
                 // magic bytes detected, this is a non-encrypted frame,
-                // skip frame decryption
-                webrtc::Buffer dataOut;
-                dataOut.AppendData(dataIn.subview(0, dataIn.size() - sif.size()));
+                // skip frame decryption; [dataIn] is a view of the frame's own buffer,
+                // so copy it before replacing of the frame data
+                dataOut.SetData(dataIn.subview(0, dataIn.size() - sif.size()));
                 frame->SetData(dataOut);
                 sink->OnTransformedFrame(std::move(frame));
                 return;
@@ -340,16 +370,16 @@ void AesCgmCryptor::decryptFrame(std::unique_ptr<webrtc::TransformableFrameInter
         }
         
         const auto frameHeaderSize = unencryptedBytes(frame.get(), _mediaType);
-        webrtc::Buffer frameHeader(frameHeaderSize);
-        for (size_t i = 0U; i < frameHeaderSize; i++) {
-            frameHeader[i] = dataIn[i];
+        if (dataIn.size() < frameHeaderSize + ivSize() + 2U + g_tagLengthBytes) {
+            setLastDecryptState(AesCgmCryptorState::DecryptionFailed,
+                                "frame is too small for decryption",
+                                Bricks::LoggingSeverity::Warning);
+            return;
         }
+        const auto frameHeader = dataIn.subview(0U, frameHeaderSize);
         
-        webrtc::Buffer frameTrailer(2);
-        frameTrailer[0] = dataIn[dataIn.size() - 2];
-        frameTrailer[1] = dataIn[dataIn.size() - 1];
-        uint8_t ivLength = frameTrailer[0];
-        uint8_t keyIndex = frameTrailer[1];
+        const uint8_t ivLength = dataIn[dataIn.size() - 2];
+        const uint8_t keyIndex = dataIn[dataIn.size() - 1];
         if (ivLength != ivSize()) {
             setLastDecryptState(AesCgmCryptorState::DecryptionFailed,
                                 "incorrect IV size for decryption",
@@ -389,81 +419,71 @@ void AesCgmCryptor::decryptFrame(std::unique_ptr<webrtc::TransformableFrameInter
             return;
         }
         
-        webrtc::Buffer iv(ivLength);
-        for (size_t i = 0U; i < ivLength; i++) {
-            iv[i] = dataIn[dataIn.size() - 2 - ivLength + i];
-        }
-        
-        webrtc::Buffer encryptedBuffer(dataIn.size() - frameHeaderSize);
-        for (size_t i = frameHeaderSize; i < dataIn.size(); i++) {
-            encryptedBuffer[i - frameHeaderSize] = dataIn[i];
-        }
-        
-        if (frameIsH264(frame.get(), _mediaType)) {
+        webrtc::ArrayView<const uint8_t> encryptedBuffer = dataIn.subview(frameHeaderSize);
+        if (frameIsH264(frame.get(), _mediaType) || frameIsH265(frame.get(), _mediaType)) {
             if (needsRbspUnescaping(encryptedBuffer.data(), encryptedBuffer.size())) {
-                webrtc::H264::ParseRbsp(encryptedBuffer.data(), encryptedBuffer.size());
+                parseRbsp(encryptedBuffer, unescaped);
+                encryptedBuffer = unescaped;
             }
         }
-        else if (frameIsH265(frame.get(), _mediaType)) {
-            if (needsRbspUnescaping(encryptedBuffer.data(), encryptedBuffer.size())) {
-                webrtc::H265::ParseRbsp(encryptedBuffer.data(), encryptedBuffer.size());
-            }
+        if (encryptedBuffer.size() < ivLength + 2U + g_tagLengthBytes) {
+            setLastDecryptState(AesCgmCryptorState::DecryptionFailed,
+                                "frame is too small for decryption",
+                                Bricks::LoggingSeverity::Warning);
+            return;
         }
         
-        webrtc::Buffer encryptedPayload(encryptedBuffer.size() - ivLength - 2);
-        for (size_t i = 0U; i < encryptedPayload.size(); i++) {
-            encryptedPayload[i] = encryptedBuffer[i];
-        }
-
-        webrtc::Buffer tag(encryptedPayload.data() + encryptedPayload.size() - 16, 16);
-        std::vector<uint8_t> buffer;
-        auto initialKeyMaterial = keySet->_material;
-        bool decryptionSuccess = encryptOrDecrypt(false, keySet->_encryptionKey,
+        const auto iv = encryptedBuffer.subview(encryptedBuffer.size() - 2U - ivLength, ivLength);
+        const auto encryptedPayload = encryptedBuffer.subview(0U, encryptedBuffer.size() - ivLength - 2U);
+        
+        dataOut.SetData(frameHeader);
+        bool decryptionSuccess = encryptOrDecrypt(false, keyIndex, keySet->_encryptionKey,
                                                   iv, frameHeader,
-                                                  encryptedPayload, buffer);
+                                                  encryptedPayload, dataOut);
         if (!decryptionSuccess) {
             if (canLogWarning()) {
                 logWarning("decrypt frame failed");
             }
-            std::shared_ptr<KeySet> ratchetedKeySet;
-            size_t ratchetCount = 0U;
-            auto currentKeyMaterial = keySet->_material;
-            if (_keyProvider->options()._ratchetWindowSize > 0U) {
-                while (ratchetCount < _keyProvider->options()._ratchetWindowSize) {
-                    ratchetCount++;
-                    if (canLogVerbose()) {
-                        logVerbose("ratcheting key attempt " +
-                                   std::to_string(ratchetCount) + " of " +
-                                   std::to_string(_keyProvider->options()._ratchetWindowSize));
-                    }
-                    auto newMaterial = keyHandler->ratchetKeyMaterial(currentKeyMaterial);
-                    ratchetedKeySet = keyHandler->deriveKeys(newMaterial,
-                                                             _keyProvider->options()._ratchetSalt,
-                                                             128);
-                    decryptionSuccess = encryptOrDecrypt(false,
-                                                         ratchetedKeySet->_encryptionKey,
-                                                         iv, frameHeader,
-                                                         encryptedPayload, buffer);
-                    if (decryptionSuccess) {
-                        // success, so we set the new key
-                        keyHandler->setKeyFromMaterial(newMaterial, keyIndex);
-                        keyHandler->setHasValidKey();
-                        setLastDecryptState(AesCgmCryptorState::KeyRatcheted);
-                        break;
-                    }
-                    // for the next ratchet attempt
-                    currentKeyMaterial = newMaterial;
-                } // while (ratchetCount < _keyProvider->options()._ratchetWindowSize)
-                /* Since the key it is first send and only afterwards actually used for
-                   encrypting, there were situations when the decrypting failed due to the
-                   fact that the received frame was not encrypted yet and ratcheting, of
-                   course, did not solve the problem. So if we fail RATCHET_WINDOW_SIZE
-                   times, we come back to the initial key.
-                 */
-                if (!decryptionSuccess && ratchetCount >= _keyProvider->options()._ratchetWindowSize) {
-                    keyHandler->setKeyFromMaterial(std::move(initialKeyMaterial), keyIndex);
+            // ratcheted keys are derived ahead by key handler after each key change,
+            // here is only a lookup; steps are derived in order, so the first missing one ends the window
+            const auto ratchetWindowSize = _keyProvider->options()._ratchetWindowSize;
+            bool ratchetPending = false;
+            for (size_t step = 1U; step <= ratchetWindowSize; ++step) {
+                const auto ratchetedKeySet = keyHandler->ratchetedKeySet(keyIndex, step);
+                if (!ratchetedKeySet) {
+                    ratchetPending = true;
+                    break;
+                }
+                if (canLogVerbose()) {
+                    logVerbose("ratcheting key attempt " + std::to_string(step) +
+                               " of " + std::to_string(ratchetWindowSize));
+                }
+                // ratcheted key is not confirmed yet, so don't replace the cached context
+                dataOut.SetSize(frameHeaderSize);
+                decryptionSuccess = encryptOrDecrypt(false, std::nullopt,
+                                                     ratchetedKeySet->_encryptionKey,
+                                                     iv, frameHeader,
+                                                     encryptedPayload, dataOut);
+                if (decryptionSuccess) {
+                    // success, so we set the new key
+                    keyHandler->commitRatchet(keyIndex, step);
+                    setLastDecryptState(AesCgmCryptorState::KeyRatcheted);
+                    break;
                 }
-            } //  if (_keyProvider->options()._ratchetWindowSize > 0)
+            }
+            /* The current key stays untouched if the whole window fails: the key
+               may be sent before it's actually used for encrypting, so the frame
+               may be encrypted with the previous key and ratcheting can't help.
+             */
+            if (!decryptionSuccess && ratchetPending) {
+                // the window isn't derived yet (key was just changed), drop the frame without stalling
+                // decoding and without counting it against the failure tolerance
+                Metrics::instance()._e2eeRatchetPendingDrops.add();
+                if (canLogVerbose()) {
+                    logVerbose("frame dropped, ratcheted key is being derived");
+                }
+                return;
+            }
         }
         
         if (!decryptionSuccess) {
@@ -473,10 +493,6 @@ void AesCgmCryptor::decryptFrame(std::unique_ptr<webrtc::TransformableFrameInter
             return;
         }
         
-        webrtc::Buffer payload(buffer.data(), buffer.size());
-        webrtc::Buffer dataOut;
-        dataOut.AppendData(frameHeader);
-        dataOut.AppendData(payload);
         frame->SetData(dataOut);
         
         setLastDecryptState(AesCgmCryptorState::Ok);
@@ -488,6 +504,9 @@ void AesCgmCryptor::setLastEncryptState(AesCgmCryptorState state,
                                         const std::string& comment,
                                         Bricks::LoggingSeverity severity)
 {
+    if (isFailure(state)) {
+        Metrics::instance()._e2eeEncryptFailures.add();
+    }
     if (exchangeVal(state, _lastEncState)) {
         if (!comment.empty() && canLog(severity)) {
             log(severity, comment);
@@ -501,6 +520,9 @@ void AesCgmCryptor::setLastDecryptState(AesCgmCryptorState state,
                                         const std::string& comment,
                                         Bricks::LoggingSeverity severity)
 {
+    if (isFailure(state)) {
+        Metrics::instance()._e2eeDecryptFailures.add();
+    }
     if (exchangeVal(state, _lastDecState)) {
         if (!comment.empty() && canLog(severity)) {
             log(severity, comment);
@@ -519,61 +541,85 @@ std::shared_ptr<E2EKeyHandler> AesCgmCryptor::keyHandler() const
 }
 
 bool AesCgmCryptor::encryptOrDecrypt(bool encrypt,
+                                     const std::optional<uint8_t>& keyIndex,
                                      const std::vector<uint8_t>& rawKey,
-                                     const webrtc::ArrayView<uint8_t>& iv,
-                                     const webrtc::ArrayView<uint8_t>& additionalData,
-                                     const webrtc::ArrayView<uint8_t>& data,
-                                     std::vector<uint8_t>& buffer) const
+                                     webrtc::ArrayView<const uint8_t> iv,
+                                     webrtc::ArrayView<const uint8_t> additionalData,
+                                     webrtc::ArrayView<const uint8_t> data,
+                                     webrtc::Buffer& output)
 {
-    const EVP_AEAD* aeadAlg = aesGcmAlgorithmFromKeySize(rawKey.size());
-    if (!aeadAlg) {
-        if (canLogError()) {
-            logError("invalid AES-GCM key size");
-        }
-        return false;
+    if (!keyIndex) {
+        const auto context = makeContext(rawKey);
+        return context && encryptOrDecrypt(encrypt, *context, iv, additionalData, data, output);
     }
-    static constexpr unsigned tagLengthBytes = 128U / 8U;
-    
-    bssl::ScopedEVP_AEAD_CTX ctx;
-    if (!EVP_AEAD_CTX_init(ctx.get(), aeadAlg,
-                           rawKey.data(), rawKey.size(),
-                           tagLengthBytes, nullptr)) {
-        if (canLogError()) {
-            logError("failed to initialize AES-GCM context");
+    {
+        LOCK_READ_SAFE_OBJ(_contexts);
+        const auto& context = _contexts->at(keyIndex.value());
+        if (context && context->sameKey(rawKey)) {
+            return encryptOrDecrypt(encrypt, *context, iv, additionalData, data, output);
         }
+    }
+    // 1st usage of the slot or key was changed
+    auto context = makeContext(rawKey);
+    if (!context) {
         return false;
     }
-    size_t len = {};
-    int ok = {};
+    LOCK_WRITE_SAFE_OBJ(_contexts);
+    auto& slot = _contexts->at(keyIndex.value());
+    slot = std::move(context);
+    return encryptOrDecrypt(encrypt, *slot, iv, additionalData, data, output);
+}
+
+bool AesCgmCryptor::encryptOrDecrypt(bool encrypt, const AeadContext& context,
+                                     webrtc::ArrayView<const uint8_t> iv,
+                                     webrtc::ArrayView<const uint8_t> additionalData,
+                                     webrtc::ArrayView<const uint8_t> data,
+                                     webrtc::Buffer& output) const
+{
+    auto& metrics = Metrics::instance();
+    const MetricTimer timer(encrypt ? metrics._e2eeEncryptTime : metrics._e2eeDecryptTime);
+    bool ok = false;
     if (encrypt) {
-        buffer.resize(data.size() + EVP_AEAD_max_overhead(aeadAlg));
-        ok = EVP_AEAD_CTX_seal(ctx.get(), buffer.data(), &len, buffer.size(),
-                               iv.data(), iv.size(), data.data(), data.size(),
-                               additionalData.data(), additionalData.size());
+        ok = context.seal(iv, additionalData, data, output);
     }
     else {
-        if (data.size() < tagLengthBytes) {
+        if (data.size() < g_tagLengthBytes) {
             if (canLogError()) {
                 logError("data too small for AES-GCM tag");
             }
             return false;
         }
-        buffer.resize(data.size() - tagLengthBytes);
-        ok = EVP_AEAD_CTX_open(ctx.get(), buffer.data(), &len, buffer.size(),
-                               iv.data(), iv.size(), data.data(), data.size(),
-                               additionalData.data(), additionalData.size());
+        ok = context.open(iv, additionalData, data, output);
     }
     if (!ok) {
         if (canLogWarning()) {
             logWarning("failed to perform AES-GCM operation");
         }
-        return false;
     }
-    buffer.resize(len);
-    return true;
+    return ok;
+}
+
+std::unique_ptr<const AesCgmCryptor::AeadContext> AesCgmCryptor::
+    makeContext(const std::vector<uint8_t>& rawKey) const
+{
+    const EVP_AEAD* aeadAlg = aesGcmAlgorithmFromKeySize(rawKey.size());
+    if (!aeadAlg) {
+        if (canLogError()) {
+            logError("invalid AES-GCM key size");
+        }
+        return {};
+    }
+    auto context = std::make_unique<AeadContext>(aeadAlg, rawKey);
+    if (!context->init()) {
+        if (canLogError()) {
+            logError("failed to initialize AES-GCM context");
+        }
+        return {};
+    }
+    return context;
 }
 
-webrtc::Buffer AesCgmCryptor::makeIv(uint32_t ssrc, uint32_t timestamp)
+void AesCgmCryptor::makeIv(uint32_t ssrc, uint32_t timestamp, uint8_t* iv)
 {
     uint32_t sendCount = 0U;
     const auto it = _sendCounts.find(ssrc);
@@ -584,13 +630,58 @@ webrtc::Buffer AesCgmCryptor::makeIv(uint32_t ssrc, uint32_t timestamp)
     else {
         sendCount = it->second;
     }
-    webrtc::ByteBufferWriter buf;
-    buf.WriteUInt32(ssrc);
-    buf.WriteUInt32(timestamp);
-    buf.WriteUInt32(timestamp - (sendCount % 0xFFFF));
+    webrtc::SetBE32(iv, ssrc);
+    webrtc::SetBE32(iv + 4, timestamp);
+    webrtc::SetBE32(iv + 8, timestamp - (sendCount % 0xFFFF));
     _sendCounts[ssrc] = sendCount + 1;
-    RTC_CHECK_EQ(buf.Length(), ivSize());
-    return webrtc::Buffer(buf.Data(), buf.Length());
+}
+
+AesCgmCryptor::AeadContext::AeadContext(const EVP_AEAD* algorithm,
+                                        const std::vector<uint8_t>& key)
+    : _algorithm(algorithm)
+    , _key(key)
+{
+}
+
+bool AesCgmCryptor::AeadContext::init()
+{
+    return 1 == EVP_AEAD_CTX_init(_ctx.get(), _algorithm,
+                                  _key.data(), _key.size(),
+                                  g_tagLengthBytes, nullptr);
+}
+
+bool AesCgmCryptor::AeadContext::seal(webrtc::ArrayView<const uint8_t> iv,
+                                      webrtc::ArrayView<const uint8_t> additionalData,
+                                      webrtc::ArrayView<const uint8_t> data,
+                                      webrtc::Buffer& output) const
+{
+    bool ok = false;
+    output.AppendData(data.size() + EVP_AEAD_max_overhead(_algorithm),
+                      [&](webrtc::ArrayView<uint8_t> out) {
+        size_t len = 0U;
+        ok = 1 == EVP_AEAD_CTX_seal(_ctx.get(), out.data(), &len, out.size(),
+                                    iv.data(), iv.size(), data.data(), data.size(),
+                                    additionalData.data(), additionalData.size());
+        return ok ? len : 0U;
+    });
+    return ok;
+}
+
+bool AesCgmCryptor::AeadContext::open(webrtc::ArrayView<const uint8_t> iv,
+                                      webrtc::ArrayView<const uint8_t> additionalData,
+                                      webrtc::ArrayView<const uint8_t> data,
+                                      webrtc::Buffer& output) const
+{
+    bool ok = false;
+    output.AppendData(data.size() - g_tagLengthBytes,
+                      [&](webrtc::ArrayView<uint8_t> out) {
+        size_t len = 0U;
+        ok = 1 == EVP_AEAD_CTX_open(_ctx.get(), out.data(), &len, out.size(),
+                                    iv.data(), iv.size(), data.data(), data.size(),
+                                    additionalData.data(), additionalData.size());
+        return ok ? len : 0U;
+    });
+    return ok;
 }
 
 std::optional<E2ECryptoError> toCryptoError(AesCgmCryptorState state)
@@ -688,6 +779,54 @@ inline bool checkVideoCodecType(const webrtc::TransformableFrameInterface* frame
     return false;
 }
 
+void parseRbsp(webrtc::ArrayView<const uint8_t> data, std::vector<uint8_t>& output)
+{
+    output.clear();
+    output.reserve(data.size());
+    for (size_t i = 0U; i < data.size();) {
+        // 0x000003 -> 0x0000
+        if (data.size() - i >= 3U && 0U == data[i] && 0U == data[i + 1U] && 3U == data[i + 2U]) {
+            output.push_back(data[i++]);
+            output.push_back(data[i++]);
+            ++i;
+        }
+        else {
+            output.push_back(data[i++]);
+        }
+    }
+}
+
+void writeRbsp(webrtc::Buffer& buffer, size_t offset)
+{
+    // read-only pass collects positions of bytes which require the emulation
+    // prevention byte before them, so the common case (no escapes) doesn't move anything
+    static thread_local std::vector<size_t> escapes;
+    escapes.clear();
+    size_t zeros = 0U;
+    for (size_t i = offset; i < buffer.size(); ++i) {
+        const auto byte = buffer[i];
+        if (byte <= 3U && zeros >= 2U) {
+            escapes.push_back(i);
+            zeros = 0U;
+        }
+        zeros = 0U == byte ? zeros + 1U : 0U;
+    }
+    if (!escapes.empty()) {
+        auto end = buffer.size();
+        buffer.SetSize(end + escapes.size());
+        const auto data = buffer.data();
+        // tail segments are shifted first, so nothing is overwritten before the move
+        auto shift = escapes.size();
+        for (auto it = escapes.rbegin(); it != escapes.rend(); ++it) {
+            const auto pos = *it;
+            std::memmove(data + pos + shift, data + pos, end - pos);
+            --shift;
+            data[pos + shift] = 3U;
+            end = pos;
+        }
+    }
+}
+
 bool frameIsH264(const webrtc::TransformableFrameInterface* frame, webrtc::MediaType type)
 {
     return checkVideoCodecType(frame, type, webrtc::kVideoCodecH264);
@@ -19,9 +19,12 @@
 #include <api/media_types.h>
 #include <api/frame_transformer_interface.h>
 #include <api/task_queue/task_queue_base.h>
+#include <array>
 #include <atomic>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 
 namespace Bricks {
 class Logger;
@@ -37,7 +40,11 @@ class KeyProvider;
 // AES GGM codec
 class AesCgmCryptor : public Bricks::LoggableS<webrtc::FrameTransformerInterface>
 {
+    class AeadContext;
     using Sinks = std::map<uint32_t, webrtc::scoped_refptr<webrtc::TransformedFrameCallback>>;
+    // initialized AES-GCM contexts, indexed by key index (slot of the key ring)
+    using AeadContexts = std::array<std::unique_ptr<const AeadContext>,
+                                    std::numeric_limits<uint8_t>::max() + 1U>;
 public:
     ~AesCgmCryptor() override;
     static webrtc::scoped_refptr<AesCgmCryptor> create(webrtc::MediaType mediaType,
@@ -80,13 +87,24 @@ private:
                              const std::string& comment = {},
                              Bricks::LoggingSeverity severity = Bricks::LoggingSeverity::Verbose);
     std::shared_ptr<E2EKeyHandler> keyHandler() const;
+    // result is appended to [output], context for [keyIndex] slot is cached
+    // and re-initialized only if the key was changed (set or ratcheted),
+    // temporary context is used if [keyIndex] is not specified
     bool encryptOrDecrypt(bool encrypt,
+                          const std::optional<uint8_t>& keyIndex,
                           const std::vector<uint8_t>& rawKey,
-                          const webrtc::ArrayView<uint8_t>& iv,
-                          const webrtc::ArrayView<uint8_t>& additionalData,
-                          const webrtc::ArrayView<uint8_t>& data,
-                          std::vector<uint8_t>& buffer) const;
-    webrtc::Buffer makeIv(uint32_t ssrc, uint32_t timestamp);
+                          webrtc::ArrayView<const uint8_t> iv,
+                          webrtc::ArrayView<const uint8_t> additionalData,
+                          webrtc::ArrayView<const uint8_t> data,
+                          webrtc::Buffer& output);
+    bool encryptOrDecrypt(bool encrypt, const AeadContext& context,
+                          webrtc::ArrayView<const uint8_t> iv,
+                          webrtc::ArrayView<const uint8_t> additionalData,
+                          webrtc::ArrayView<const uint8_t> data,
+                          webrtc::Buffer& output) const;
+    std::unique_ptr<const AeadContext> makeContext(const std::vector<uint8_t>& rawKey) const;
+    // writes [ivSize()] bytes to [iv]
+    void makeIv(uint32_t ssrc, uint32_t timestamp, uint8_t* iv);
 private:
     static thread_local inline std::map<uint32_t, uint32_t> _sendCounts;
     const webrtc::MediaType _mediaType;
@@ -99,6 +117,7 @@ private:
     AsyncListener<std::weak_ptr<AesCgmCryptorObserver>, true> _observer;
     SafeScopedRefPtr<webrtc::TransformedFrameCallback> _sink;
     Bricks::SafeObj<Sinks> _sinks;
+    Bricks::SafeObj<AeadContexts> _contexts;
     std::atomic<AesCgmCryptorState> _lastEncState = AesCgmCryptorState::New;
     std::atomic<AesCgmCryptorState> _lastDecState = AesCgmCryptorState::New;
 };
@@ -13,7 +13,9 @@
 // limitations under the License.
 #include "livekit/rtc/e2e/E2EKeyHandler.h"
 #include "livekit/rtc/e2e/KeyProviderOptions.h"
+#include "KeyDerivationCache.h"
 #include "Loggable.h"
+#include "RtcUtils.h"
 #include "SafeObj.h"
 #include "Utils.h"
 #include <openssl/evp.h>
@@ -21,20 +23,41 @@
 
 namespace {
 
+struct KeySlot
+{
+    std::shared_ptr<LiveKitCpp::KeySet> _keySet;
+    // [_ratchets[i]] is the key set after i + 1 ratchets of [_keySet],
+    // filled by background derivation ahead of decryptors
+    std::vector<std::shared_ptr<LiveKitCpp::KeySet>> _ratchets;
+    // number of steps to derive, the ratchet window after each key change
+    size_t _ratchetsTarget = 0U;
+    // derivation task is scheduled for the current generation
+    bool _deriving = false;
+    // incremented on each key change, outdated derivations are discarded
+    uint64_t _generation = 0ULL;
+};
+
 struct Data
 {
     bool _hasValidKey = false;
     uint64_t _decryptionFailureCount = 0ULL;
     uint8_t _currentKeyIndex = 0;
-    std::vector<std::shared_ptr<LiveKitCpp::KeySet>> _cryptoKeyRing;
+    std::vector<KeySlot> _cryptoKeyRing;
     inline size_t boundIndex(uint8_t index) const {
         return std::min<uint8_t>(_cryptoKeyRing.size(), index);
     }
     inline size_t index(const std::optional<uint8_t>& keyIndex) const {
         return keyIndex ? boundIndex(keyIndex.value()) : _currentKeyIndex;
     }
+    inline size_t slot(const std::optional<uint8_t>& keyIndex) const {
+        return index(keyIndex) % _cryptoKeyRing.size();
+    }
 };
 
+// PBKDF2 with 100K iterations takes tens of milliseconds,
+// ratchet windows of all participants are derived on this queue
+std::shared_ptr<webrtc::TaskQueueBase> derivationQueue();
+
 inline std::string toUint8List(const uint8_t* data, size_t len) {
     std::string res = "[";
     if (data && len) {
@@ -57,16 +80,31 @@ inline std::string toUint8List(const std::vector<uint8_t>& data) {
 namespace LiveKitCpp
 {
 
-struct E2EKeyHandler::Impl : public Bricks::LoggableS<>
+struct E2EKeyHandler::Impl : public Bricks::LoggableS<>,
+                             public std::enable_shared_from_this<E2EKeyHandler::Impl>
 {
     const KeyProviderOptions _options;
+    // null if ratchet window is disabled
+    const std::shared_ptr<webrtc::TaskQueueBase> _derivationQueue;
     Bricks::SafeObj<Data> _data;
     Impl(const KeyProviderOptions& options, const std::shared_ptr<Bricks::Logger>& logger);
-    std::unique_ptr<Impl> clone() const;
+    std::shared_ptr<Impl> clone() const;
     bool derivePBKDF2KeyFromRawKey(const std::vector<uint8_t>& rawKey,
                                    const std::vector<uint8_t>& salt,
                                    unsigned int optionalLengthBits,
                                    std::vector<uint8_t>& derivedKey) const;
+    std::shared_ptr<KeySet> ratchet(const KeySet& keySet) const;
+    // [ratchets] - already derived part of the window for [keySet],
+    // the rest of the window is derived in background
+    void setKeySet(std::shared_ptr<KeySet> keySet, const std::optional<uint8_t>& keyIndex,
+                   std::vector<std::shared_ptr<KeySet>> ratchets = {});
+    // returns derived step or schedules derivation up to [step]
+    std::shared_ptr<KeySet> ratchetedKeySet(uint8_t keyIndex, size_t step);
+    // marks [slot] as deriving if its window is incomplete, must be called under the lock,
+    // true if [scheduleRatchets] should be called after unlocking
+    static bool startRatchets(KeySlot& slot);
+    void scheduleRatchets(size_t slot, uint64_t generation);
+    void deriveRatchets(size_t slot, uint64_t generation);
 protected:
     // impl. of Bricks::LoggableS<>
     std::string_view logCategory() const final;
@@ -74,7 +112,7 @@ protected:
 
 E2EKeyHandler::E2EKeyHandler(const KeyProviderOptions& options,
                              const std::shared_ptr<Bricks::Logger>& logger)
-    : _impl(std::make_unique<Impl>(options, logger))
+    : _impl(std::make_shared<Impl>(options, logger))
 {
     auto keyRingSize = options._keyRingSize;
     if (0 == keyRingSize) {
@@ -86,7 +124,7 @@ E2EKeyHandler::E2EKeyHandler(const KeyProviderOptions& options,
     _impl->_data->_cryptoKeyRing.resize(keyRingSize);
 }
 
-E2EKeyHandler::E2EKeyHandler(std::unique_ptr<Impl> impl)
+E2EKeyHandler::E2EKeyHandler(std::shared_ptr<Impl> impl)
     : _impl(std::move(impl))
 {
 }
@@ -103,11 +141,21 @@ std::shared_ptr<E2EKeyHandler> E2EKeyHandler::clone() const
 std::vector<uint8_t> E2EKeyHandler::ratchetKey(const std::optional<uint8_t>& keyIndex)
 {
     if (const auto keySet = this->keySet(keyIndex)) {
-        std::vector<uint8_t> newMaterial;
-        if (_impl->derivePBKDF2KeyFromRawKey(keySet->_material,
-                                             _impl->_options._ratchetSalt, 256U,
-                                             newMaterial)) {
-            setKeyFromMaterial(newMaterial, keyIndex);
+        std::vector<std::shared_ptr<KeySet>> ratchets;
+        {
+            LOCK_READ_SAFE_OBJ(_impl->_data);
+            const auto& slot = _impl->_data->_cryptoKeyRing[_impl->_data->slot(keyIndex)];
+            if (slot._keySet == keySet) {
+                ratchets = slot._ratchets;
+            }
+        }
+        auto ratcheted = ratchets.empty() ? _impl->ratchet(*keySet) : ratchets.front();
+        if (ratcheted) {
+            auto newMaterial = ratcheted->_material;
+            if (!ratchets.empty()) {
+                ratchets.erase(ratchets.begin());
+            }
+            _impl->setKeySet(std::move(ratcheted), keyIndex, std::move(ratchets));
             setHasValidKey();
             return newMaterial;
         }
@@ -118,7 +166,37 @@ std::vector<uint8_t> E2EKeyHandler::ratchetKey(const std::optional<uint8_t>& key
 std::shared_ptr<KeySet> E2EKeyHandler::keySet(const std::optional<uint8_t>& keyIndex) const
 {
     LOCK_READ_SAFE_OBJ(_impl->_data);
-    return _impl->_data->_cryptoKeyRing.at(_impl->_data->index(keyIndex));
+    return _impl->_data->_cryptoKeyRing.at(_impl->_data->slot(keyIndex))._keySet;
+}
+
+std::shared_ptr<KeySet> E2EKeyHandler::ratchetedKeySet(uint8_t keyIndex, size_t step) const
+{
+    if (step && step <= _impl->_options._ratchetWindowSize) {
+        return _impl->ratchetedKeySet(keyIndex, step);
+    }
+    return {};
+}
+
+bool E2EKeyHandler::commitRatchet(uint8_t keyIndex, size_t step)
+{
+    if (step) {
+        std::shared_ptr<KeySet> keySet;
+        std::vector<std::shared_ptr<KeySet>> ratchets;
+        {
+            LOCK_READ_SAFE_OBJ(_impl->_data);
+            const auto& slot = _impl->_data->_cryptoKeyRing.at(_impl->_data->slot(keyIndex));
+            if (step <= slot._ratchets.size()) {
+                keySet = slot._ratchets[step - 1U];
+                ratchets.assign(slot._ratchets.begin() + step, slot._ratchets.end());
+            }
+        }
+        if (keySet) {
+            _impl->setKeySet(std::move(keySet), keyIndex, std::move(ratchets));
+            setHasValidKey();
+            return true;
+        }
+    }
+    return false;
 }
 
 void E2EKeyHandler::setKey(std::vector<uint8_t> password, const std::optional<uint8_t>& keyIndex)
@@ -177,15 +255,8 @@ void E2EKeyHandler::setHasValidKey()
 void E2EKeyHandler::setKeyFromMaterial(std::vector<uint8_t> password,
                                        const std::optional<uint8_t>& keyIndex)
 {
-    LOCK_WRITE_SAFE_OBJ(_impl->_data);
-    auto& data = _impl->_data;
-    if (keyIndex.has_value()) {
-        const auto index = data->boundIndex(keyIndex.value());
-        data->_currentKeyIndex = index % uint8_t(data->_cryptoKeyRing.size());
-    }
-    data->_cryptoKeyRing[data->_currentKeyIndex] = deriveKeys(_impl->_options._ratchetSalt,
-                                                              std::move(password),
-                                                              128U);
+    // derivation is performed outside of the lock, decryption threads are not blocked by KDF
+    _impl->setKeySet(deriveKeys(_impl->_options._ratchetSalt, std::move(password), 128U), keyIndex);
 }
 
 void E2EKeyHandler::setKeyFromMaterial(std::string_view password,
@@ -206,20 +277,36 @@ bool E2EKeyHandler::decryptionFailure()
     decryptionFailureCount++;
     hasValidKey = decryptionFailureCount < options._failureTolerance.value();
     return !hasValidKey;
-    return true;
 }
 
 E2EKeyHandler::Impl::Impl(const KeyProviderOptions& options,
                           const std::shared_ptr<Bricks::Logger>& logger)
     : Bricks::LoggableS<>(logger)
     , _options(options)
+    , _derivationQueue(options._ratchetWindowSize ? derivationQueue() : nullptr)
 {
 }
 
-std::unique_ptr<E2EKeyHandler::Impl> E2EKeyHandler::Impl::clone() const
+std::shared_ptr<E2EKeyHandler::Impl> E2EKeyHandler::Impl::clone() const
 {
-    auto impl = std::make_unique<Impl>(_options, logger());
+    auto impl = std::make_shared<Impl>(_options, logger());
     impl->_data = _data();
+    // pending derivations of this instance are not applied to the clone,
+    // it completes windows by own tasks
+    std::vector<std::pair<size_t, uint64_t>> scheduled;
+    {
+        LOCK_WRITE_SAFE_OBJ(impl->_data);
+        auto& ring = impl->_data->_cryptoKeyRing;
+        for (size_t i = 0U; i < ring.size(); ++i) {
+            ring[i]._deriving = false;
+            if (startRatchets(ring[i])) {
+                scheduled.emplace_back(i, ring[i]._generation);
+            }
+        }
+    }
+    for (const auto& slot : scheduled) {
+        impl->scheduleRatchets(slot.first, slot.second);
+    }
     return impl;
 }
 
@@ -229,28 +316,144 @@ bool E2EKeyHandler::Impl::derivePBKDF2KeyFromRawKey(const std::vector<uint8_t>&
                                                     std::vector<uint8_t>& derivedKey) const
 {
     const size_t keySizeBytes = optionalLengthBits / 8;
-    derivedKey.resize(keySizeBytes);
-    const auto res = PKCS5_PBKDF2_HMAC((const char*)rawKey.data(), int(rawKey.size()),
-                                       salt.data(), int(salt.size()),
-                                       100000, EVP_sha256(),
-                                       int(keySizeBytes), derivedKey.data());
-    if (1 != res) {
-        if (canLogError()) {
-            logError("failed to derive AES key from password, error code: " + std::to_string(res));
+    derivedKey = KeyDerivationCache::instance().get(rawKey, salt, optionalLengthBits,
+                                                    [&](std::vector<uint8_t>& key) {
+        key.resize(keySizeBytes);
+        const auto res = PKCS5_PBKDF2_HMAC((const char*)rawKey.data(), int(rawKey.size()),
+                                           salt.data(), int(salt.size()),
+                                           100000, EVP_sha256(),
+                                           int(keySizeBytes), key.data());
+        if (1 != res) {
+            if (canLogError()) {
+                logError("failed to derive AES key from password, error code: " + std::to_string(res));
+            }
+            return false;
+        }
+        if (canLogVerbose()) {
+            logVerbose("raw key " + toUint8List(rawKey) +
+                       " len " + std::to_string(rawKey.size()));
+            logVerbose("salt " + toUint8List(salt) +
+                       " len " + std::to_string(salt.size()));
+            logVerbose("derived key " + toUint8List(key) +
+                       " len " + std::to_string(key.size()));
+        }
+        return true;
+    });
+    return keySizeBytes && derivedKey.size() == keySizeBytes;
+}
+
+std::shared_ptr<KeySet> E2EKeyHandler::Impl::ratchet(const KeySet& keySet) const
+{
+    std::vector<uint8_t> newMaterial, encryptionKey;
+    if (derivePBKDF2KeyFromRawKey(keySet._material, _options._ratchetSalt, 256U, newMaterial) &&
+        derivePBKDF2KeyFromRawKey(newMaterial, _options._ratchetSalt, 128U, encryptionKey)) {
+        return std::make_shared<KeySet>(std::move(newMaterial), std::move(encryptionKey));
+    }
+    return {};
+}
+
+void E2EKeyHandler::Impl::setKeySet(std::shared_ptr<KeySet> keySet,
+                                    const std::optional<uint8_t>& keyIndex,
+                                    std::vector<std::shared_ptr<KeySet>> ratchets)
+{
+    size_t slotIndex = 0U;
+    uint64_t generation = 0ULL;
+    {
+        LOCK_WRITE_SAFE_OBJ(_data);
+        if (keyIndex.has_value()) {
+            _data->_currentKeyIndex = static_cast<uint8_t>(_data->slot(keyIndex));
+        }
+        slotIndex = _data->_currentKeyIndex;
+        auto& slot = _data->_cryptoKeyRing[slotIndex];
+        slot._keySet = std::move(keySet);
+        slot._ratchets = std::move(ratchets);
+        // the whole window is derived ahead, so ratcheting on decryption failure is a lookup
+        slot._ratchetsTarget = _options._ratchetWindowSize;
+        slot._deriving = false;
+        generation = ++slot._generation;
+        if (!startRatchets(slot)) {
+            return;
         }
-        return false;
     }
-    if (canLogVerbose()) {
-        logVerbose("raw key " + toUint8List(rawKey) +
-                   " len " + std::to_string(rawKey.size()));
-        logVerbose("salt " + toUint8List(salt) +
-                   " len " + std::to_string(salt.size()));
-        logVerbose("derived key " + toUint8List(derivedKey) +
-                   " len " + std::to_string(derivedKey.size()));
+    scheduleRatchets(slotIndex, generation);
+}
+
+std::shared_ptr<KeySet> E2EKeyHandler::Impl::ratchetedKeySet(uint8_t keyIndex, size_t step)
+{
+    size_t slotIndex = 0U;
+    uint64_t generation = 0ULL;
+    {
+        LOCK_WRITE_SAFE_OBJ(_data);
+        slotIndex = _data->slot(keyIndex);
+        auto& slot = _data->_cryptoKeyRing.at(slotIndex);
+        if (step <= slot._ratchets.size()) {
+            return slot._ratchets[step - 1U];
+        }
+        if (!slot._keySet) {
+            return {};
+        }
+        // the window is being derived ahead, or its derivation failed before
+        slot._ratchetsTarget = std::max(slot._ratchetsTarget, step);
+        if (!startRatchets(slot)) {
+            return {};
+        }
+        generation = slot._generation;
     }
-    return true;
+    scheduleRatchets(slotIndex, generation);
+    return {};
 }
 
+bool E2EKeyHandler::Impl::startRatchets(KeySlot& slot)
+{
+    if (slot._keySet && !slot._deriving && slot._ratchets.size() < slot._ratchetsTarget) {
+        slot._deriving = true;
+        return true;
+    }
+    return false;
+}
+
+void E2EKeyHandler::Impl::scheduleRatchets(size_t slot, uint64_t generation)
+{
+    if (_derivationQueue) {
+        _derivationQueue->PostTask([weak = weak_from_this(), slot, generation]() {
+            if (const auto self = weak.lock()) {
+                self->deriveRatchets(slot, generation);
+            }
+        });
+    }
+}
+
+void E2EKeyHandler::Impl::deriveRatchets(size_t slot, uint64_t generation)
+{
+    std::shared_ptr<KeySet> last;
+    {
+        LOCK_READ_SAFE_OBJ(_data);
+        const auto& keySlot = _data->_cryptoKeyRing[slot];
+        if (keySlot._generation != generation) {
+            return;
+        }
+        last = keySlot._ratchets.empty() ? keySlot._keySet : keySlot._ratchets.back();
+    }
+    while (true) {
+        auto next = last ? ratchet(*last) : nullptr;
+        // every derived step is available for decryptors immediately
+        LOCK_WRITE_SAFE_OBJ(_data);
+        auto& keySlot = _data->_cryptoKeyRing[slot];
+        if (keySlot._generation != generation) {
+            // key was changed, [_deriving] is reset by the new key
+            break;
+        }
+        if (next) {
+            keySlot._ratchets.push_back(next);
+        }
+        // steps requested while deriving are derived by this task too
+        if (!next || keySlot._ratchets.size() >= keySlot._ratchetsTarget) {
+            keySlot._deriving = false;
+            break;
+        }
+        last = std::move(next);
+    }
+}
 
 std::string_view E2EKeyHandler::Impl::logCategory() const
 {
@@ -259,3 +462,19 @@ std::string_view E2EKeyHandler::Impl::logCategory() const
 }
 
 } // namespace LiveKitCpp
+
+namespace {
+
+std::shared_ptr<webrtc::TaskQueueBase> derivationQueue()
+{
+    static Bricks::SafeObj<std::weak_ptr<webrtc::TaskQueueBase>> queue;
+    LOCK_WRITE_SAFE_OBJ(queue);
+    auto instance = queue->lock();
+    if (!instance) {
+        instance = LiveKitCpp::createTaskQueueS("e2e_key_derivation");
+        queue = instance;
+    }
+    return instance;
+}
+
+}
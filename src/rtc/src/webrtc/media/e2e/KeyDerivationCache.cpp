@@ -0,0 +1,120 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "KeyDerivationCache.h"
+#include <openssl/evp.h>
+#include <openssl/mem.h>
+#include <algorithm>
+#include <memory>
+
+namespace LiveKitCpp
+{
+
+KeyDerivationCache& KeyDerivationCache::instance()
+{
+    static KeyDerivationCache cache;
+    return cache;
+}
+
+std::vector<uint8_t> KeyDerivationCache::get(const std::vector<uint8_t>& rawKey,
+                                             const std::vector<uint8_t>& salt,
+                                             unsigned int lengthBits,
+                                             const Derivation& derivation)
+{
+    const auto key = makeKey(rawKey, salt, lengthBits);
+    if (key.empty()) {
+        return derive(derivation);
+    }
+    std::promise<Material> promise;
+    Entry entry;
+    bool owner = false;
+    {
+        LOCK_WRITE_SAFE_OBJ(_data);
+        const auto it = _data->_entries.find(key);
+        if (it != _data->_entries.end()) {
+            entry = it->second;
+        }
+        else {
+            entry._serial = ++_data->_serial;
+            entry._result = promise.get_future().share();
+            _data->_entries.emplace(key, entry);
+            _data->_order.push_back(key);
+            if (_data->_order.size() > _maxEntries) {
+                // waiters of evicted entry still hold its shared state
+                _data->_entries.erase(_data->_order.front());
+                _data->_order.pop_front();
+            }
+            owner = true;
+        }
+    }
+    if (owner) {
+        Material material;
+        material._key = derive(derivation);
+        if (material._key.empty()) {
+            LOCK_WRITE_SAFE_OBJ(_data);
+            const auto it = _data->_entries.find(key);
+            // entry may be already evicted and re-added by another request
+            if (it != _data->_entries.end() && it->second._serial == entry._serial) {
+                _data->_entries.erase(it);
+                const auto order = std::find(_data->_order.begin(), _data->_order.end(), key);
+                if (order != _data->_order.end()) {
+                    _data->_order.erase(order);
+                }
+            }
+        }
+        promise.set_value(std::move(material));
+    }
+    return entry._result.get()._key;
+}
+
+std::string KeyDerivationCache::makeKey(const std::vector<uint8_t>& rawKey,
+                                        const std::vector<uint8_t>& salt,
+                                        unsigned int lengthBits)
+{
+    std::string key;
+    // digest context is cleansed by EVP_MD_CTX_free
+    const std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+    if (ctx) {
+        const uint32_t header[2] = {lengthBits, static_cast<uint32_t>(salt.size())};
+        unsigned int size = 0U;
+        key.resize(EVP_MAX_MD_SIZE);
+        if (EVP_DigestInit_ex(ctx.get(), EVP_sha256(), nullptr) &&
+            EVP_DigestUpdate(ctx.get(), header, sizeof(header)) &&
+            EVP_DigestUpdate(ctx.get(), salt.data(), salt.size()) &&
+            EVP_DigestUpdate(ctx.get(), rawKey.data(), rawKey.size()) &&
+            EVP_DigestFinal_ex(ctx.get(), reinterpret_cast<uint8_t*>(key.data()), &size)) {
+            key.resize(size);
+        }
+        else {
+            key.clear();
+        }
+    }
+    return key;
+}
+
+std::vector<uint8_t> KeyDerivationCache::derive(const Derivation& derivation)
+{
+    std::vector<uint8_t> derivedKey;
+    if (!derivation || !derivation(derivedKey)) {
+        OPENSSL_cleanse(derivedKey.data(), derivedKey.size());
+        derivedKey.clear();
+    }
+    return derivedKey;
+}
+
+KeyDerivationCache::Material::~Material()
+{
+    OPENSSL_cleanse(_key.data(), _key.size());
+}
+
+} // namespace LiveKitCpp
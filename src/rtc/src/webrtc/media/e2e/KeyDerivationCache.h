@@ -0,0 +1,74 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // KeyDerivationCache.h
+#include "SafeObj.h"
+#include <deque>
+#include <functional>
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// process-wide cache of PBKDF2 results: the same material is set for many participants
+// (shared key, key rotation in large rooms) and ratchet chains are derived from the same roots,
+// so each derivation is performed once, concurrent requests wait for the first one;
+// entries are keyed by SHA-256 of inputs (passwords are not kept), derived keys are zeroed on release
+class KeyDerivationCache
+{
+    // derived key, zeroed when the last holder (cache or waiter) releases it
+    struct Material
+    {
+        Material() = default;
+        Material(Material&&) = default;
+        ~Material();
+        std::vector<uint8_t> _key;
+    };
+    struct Entry
+    {
+        // distinguishes re-added entry with the same key from evicted one
+        uint64_t _serial = 0ULL;
+        std::shared_future<Material> _result;
+    };
+    struct Data
+    {
+        std::unordered_map<std::string, Entry> _entries;
+        std::deque<std::string> _order;
+        uint64_t _serial = 0ULL;
+    };
+public:
+    // returns false in case of failure, result isn't cached
+    using Derivation = std::function<bool(std::vector<uint8_t>& derivedKey)>;
+public:
+    static KeyDerivationCache& instance();
+    // empty result if derivation failed
+    std::vector<uint8_t> get(const std::vector<uint8_t>& rawKey,
+                             const std::vector<uint8_t>& salt,
+                             unsigned int lengthBits,
+                             const Derivation& derivation);
+private:
+    KeyDerivationCache() = default;
+    // empty if hashing failed
+    static std::string makeKey(const std::vector<uint8_t>& rawKey,
+                               const std::vector<uint8_t>& salt,
+                               unsigned int lengthBits);
+    static std::vector<uint8_t> derive(const Derivation& derivation);
+private:
+    static constexpr size_t _maxEntries = 2048U;
+    Bricks::SafeObj<Data> _data;
+};
+
+} // namespace LiveKitCpp
@@ -106,7 +106,7 @@ void MediaTimer::singleShot(MediaTimerCallback* callback,
                             uint64_t delayMs, uint64_t id)
 {
     if (callback) {
-        singleShot([timerId = this->id(), callback]() {
+        singleShot([timerId = id ? id : this->id(), callback]() {
             callback->onTimeout(timerId);
         }, delayMs, id);
     }
@@ -116,7 +116,7 @@ void MediaTimer::singleShot(const std::shared_ptr<MediaTimerCallback>& callback,
                             uint64_t delayMs, uint64_t id)
 {
     if (callback) {
-        singleShot([timerId = this->id(), callback]() {
+        singleShot([timerId = id ? id : this->id(), callback]() {
             callback->onTimeout(timerId);
         }, delayMs, id);
     }
@@ -126,7 +126,7 @@ void MediaTimer::singleShot(std::unique_ptr<MediaTimerCallback> callback,
                             uint64_t delayMs, uint64_t id)
 {
     if (callback) {
-        singleShot([timerId = this->id(), callback = std::move(callback)]() {
+        singleShot([timerId = id ? id : this->id(), callback = std::move(callback)]() {
             callback->onTimeout(timerId);
         }, delayMs, id);
     }
@@ -14,21 +14,14 @@
 #include "MediaTimerImpl.h"
 #include "MediaTimerCallback.h"
 #include "Utils.h"
-
-namespace {
-
-inline constexpr webrtc::TimeDelta toTimeDelta(uint64_t intervalMs) {
-    return webrtc::TimeDelta::Millis(intervalMs);
-}
-
-}
+#include <algorithm>
 
 namespace LiveKitCpp
 {
 
 MediaTimerImpl::MediaTimerImpl(uint64_t timerId, const std::shared_ptr<webrtc::TaskQueueBase>& queue)
     : _timerId(timerId)
-    , _queue(queue)
+    , _wheel(MediaTimerWheel::get(queue))
 {
 }
 
@@ -37,78 +30,108 @@ void MediaTimerImpl::setInvalid()
     if (exchangeVal(false, _valid)) {
         stop();
         setCallback(nullptr);
-        _singleShotIds({});
+        SingleShots singleShots;
+        {
+            LOCK_WRITE_SAFE_OBJ(_singleShots);
+            singleShots = _singleShots.take();
+        }
+        for (const auto& singleShot : singleShots) {
+            _wheel->cancel(singleShot.second.first);
+        }
     }
 }
 
 void MediaTimerImpl::start(uint64_t intervalMs)
 {
-    if (!_queue.expired() && !_started.exchange(true)) {
-        post(intervalMs, true);
+    if (_wheel && !_started.exchange(true)) {
+        // first tick is immediate, next ones are aligned to the start time
+        auto entry = _wheel->schedule([weak = weak_from_this()]() {
+            if (const auto self = weak.lock()) {
+                self->onTick();
+            }
+        }, 0ULL, std::max<uint64_t>(1ULL, intervalMs), _precision);
+        LOCK_WRITE_SAFE_OBJ(_periodic);
+        if (_started) {
+            _wheel->cancel(_periodic.constRef());
+            _periodic = std::move(entry);
+        }
+        else { // stopped concurrently
+            _wheel->cancel(entry);
+        }
+    }
+}
+
+void MediaTimerImpl::stop()
+{
+    if (_started.exchange(false)) {
+        LOCK_WRITE_SAFE_OBJ(_periodic);
+        if (_wheel) {
+            _wheel->cancel(_periodic.take());
+        }
     }
 }
 
 void MediaTimerImpl::singleShot(absl::AnyInvocable<void()&&> task, uint64_t delayMs, uint64_t id)
 {
-    if (const auto q = _queue.lock()) {
-        pushSingleShot(id);
-        auto fn = [id, task = std::move(task), weak = weak_from_this()]() mutable {
+    if (_wheel && task) {
+        const auto serial = ++_singleShotSerial;
+        auto fn = [id, serial, task = std::move(task), weak = weak_from_this()]() mutable {
             const auto self = weak.lock();
-            if (self && self->valid(false) && self->popSingleShot(id)) {
+            if (self && self->valid() && self->popSingleShot(id, serial)) {
                 std::move(task)();
             }
         };
-        q->PostDelayedTaskWithPrecision(_precision, std::move(fn), toTimeDelta(delayMs));
+        if (id) {
+            // lock is held during scheduling, so the entry is registered before it may fire
+            LOCK_WRITE_SAFE_OBJ(_singleShots);
+            if (auto entry = _wheel->schedule(std::move(fn), delayMs, 0ULL, _precision)) {
+                auto& singleShot = _singleShots->try_emplace(id).first->second;
+                _wheel->cancel(singleShot.first);
+                singleShot = std::make_pair(std::move(entry), serial);
+            }
+        }
+        else {
+            _wheel->schedule(std::move(fn), delayMs, 0ULL, _precision);
+        }
     }
 }
 
-bool MediaTimerImpl::valid(bool queueOnly) const noexcept
+void MediaTimerImpl::cancelSingleShot(uint64_t id)
 {
-    return !_queue.expired() && (queueOnly || _valid());
-}
-
-void MediaTimerImpl::pushSingleShot(uint64_t id)
-{
-    if (id) {
-        LOCK_WRITE_SAFE_OBJ(_singleShotIds);
-        _singleShotIds->insert(id);
+    if (id && _wheel) {
+        Entry entry;
+        {
+            LOCK_WRITE_SAFE_OBJ(_singleShots);
+            const auto it = _singleShots->find(id);
+            if (it != _singleShots->end()) {
+                entry = std::move(it->second.first);
+                _singleShots->erase(it);
+            }
+        }
+        _wheel->cancel(entry);
     }
 }
 
-bool MediaTimerImpl::popSingleShot(uint64_t id)
+bool MediaTimerImpl::popSingleShot(uint64_t id, uint64_t serial)
 {
     if (id) {
-        LOCK_WRITE_SAFE_OBJ(_singleShotIds);
-        return _singleShotIds->erase(id) > 0U;
+        LOCK_WRITE_SAFE_OBJ(_singleShots);
+        const auto it = _singleShots->find(id);
+        if (it != _singleShots->end() && serial == it->second.second) {
+            _singleShots->erase(it);
+            return true;
+        }
+        return false;
     }
     return true;
 }
 
-void MediaTimerImpl::post(uint64_t intervalMs, bool first)
+void MediaTimerImpl::onTick()
 {
-    const auto q = _queue.lock();
-    if (q && started()) {
-        q->PostDelayedTaskWithPrecision(_precision, [intervalMs, weak = weak_from_this()]() {
-            if (const auto self = weak.lock()) {
-                self->nextTick(intervalMs);
-            }
-        }, toTimeDelta(first ? 0LL : intervalMs));
-    }
-}
-
-void MediaTimerImpl::nextTick(uint64_t intervalMs)
-{
-    if (valid(true) && _started) {
-        bool next = false;
-        {
-            LOCK_READ_SAFE_OBJ(_valid);
-            if (_valid.constRef()) {
-                _callback.invoke(&MediaTimerCallback::onTimeout, _timerId);
-                next = true;
-            }
-        }
-        if (next) {
-            post(intervalMs, false);
+    if (_started) {
+        LOCK_READ_SAFE_OBJ(_valid);
+        if (_valid.constRef()) {
+            _callback.invoke(&MediaTimerCallback::onTimeout, _timerId);
         }
     }
 }
@@ -13,9 +13,10 @@
 // limitations under the License.
 #pragma once // MediaTimerImpl.h
 #include "Listener.h"
+#include "MediaTimerWheel.h"
 #include <api/task_queue/task_queue_base.h>
 #include <memory>
-#include <unordered_set>
+#include <unordered_map>
 
 
 namespace LiveKitCpp
@@ -25,6 +26,9 @@ class MediaTimerCallback;
 
 class MediaTimerImpl : public std::enable_shared_from_this<MediaTimerImpl>
 {
+    using Entry = std::shared_ptr<MediaTimerWheel::Entry>;
+    // entry & serial number of single shot with the same ID
+    using SingleShots = std::unordered_map<uint64_t, std::pair<Entry, uint64_t>>;
 public:
     MediaTimerImpl(uint64_t timerId, const std::shared_ptr<webrtc::TaskQueueBase>& queue);
     ~MediaTimerImpl() { setInvalid(); }
@@ -34,21 +38,22 @@ public:
     void setCallback(MediaTimerCallback* callback) { _callback = callback; }
     bool started() const { return _started; }
     void start(uint64_t intervalMs);
-    void stop() { _started = false; }
+    void stop();
+    // pending single shot with the same non-zero ID is replaced
     void singleShot(absl::AnyInvocable<void()&&> task, uint64_t delayMs = 0ULL, uint64_t id = 0ULL);
-    void cancelSingleShot(uint64_t id) { popSingleShot(id); }
+    void cancelSingleShot(uint64_t id);
 private:
-    bool valid(bool queueOnly) const noexcept;
-    void pushSingleShot(uint64_t id);
-    bool popSingleShot(uint64_t id);
-    void post(uint64_t intervalMs, bool first);
-    void nextTick(uint64_t intervalMs);
+    bool valid() const noexcept { return _valid(); }
+    bool popSingleShot(uint64_t id, uint64_t serial);
+    void onTick();
 private:
     const uint64_t _timerId;
-    const std::weak_ptr<webrtc::TaskQueueBase> _queue;
+    const std::shared_ptr<MediaTimerWheel> _wheel;
     Bricks::SafeObj<bool> _valid = true;
     Bricks::Listener<MediaTimerCallback*> _callback;
-    Bricks::SafeObj<std::unordered_set<uint64_t>> _singleShotIds;
+    Bricks::SafeObj<Entry> _periodic;
+    Bricks::SafeObj<SingleShots> _singleShots;
+    std::atomic<uint64_t> _singleShotSerial = 0ULL;
     std::atomic<webrtc::TaskQueueBase::DelayPrecision> _precision = webrtc::TaskQueueBase::DelayPrecision::kLow;
     std::atomic_bool _started = false;
 };
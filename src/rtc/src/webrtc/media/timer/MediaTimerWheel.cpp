@@ -0,0 +1,306 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "MediaTimerWheel.h"
+#include <rtc_base/time_utils.h>
+#include <algorithm>
+#include <unordered_map>
+
+namespace LiveKitCpp
+{
+
+MediaTimerWheel::Entry::Entry(Task task, int64_t deadlineMs, uint64_t intervalMs, bool highPrecision)
+    : _task(std::move(task))
+    , _deadlineMs(deadlineMs)
+    , _intervalMs(int64_t(intervalMs))
+    , _highPrecision(highPrecision)
+{
+}
+
+MediaTimerWheel::MediaTimerWheel(const std::shared_ptr<webrtc::TaskQueueBase>& queue)
+    : _queue(queue)
+    , _currentMs(nowMs())
+{
+}
+
+MediaTimerWheel::~MediaTimerWheel()
+{
+    // break self-references of linked entries
+    const std::lock_guard guard(_mutex);
+    for (auto& level : _levels) {
+        for (auto& slot : level) {
+            while (slot._head) {
+                unlink(slot._head);
+            }
+        }
+    }
+}
+
+std::shared_ptr<MediaTimerWheel> MediaTimerWheel::get(const std::shared_ptr<webrtc::TaskQueueBase>& queue)
+{
+    if (queue) {
+        static std::mutex mutex;
+        static std::unordered_map<const webrtc::TaskQueueBase*, std::weak_ptr<MediaTimerWheel>> wheels;
+        const std::lock_guard guard(mutex);
+        auto& weak = wheels[queue.get()];
+        auto wheel = weak.lock();
+        // address of destroyed queue may be reused by a new one
+        if (!wheel || wheel->_queue.lock() != queue) {
+            wheel.reset(new MediaTimerWheel(queue));
+            weak = wheel;
+            for (auto it = wheels.begin(); it != wheels.end();) {
+                if (it->second.expired()) {
+                    it = wheels.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+        }
+        return wheel;
+    }
+    return {};
+}
+
+std::shared_ptr<MediaTimerWheel::Entry> MediaTimerWheel::schedule(Task task, uint64_t delayMs,
+                                                                  uint64_t intervalMs,
+                                                                  webrtc::TaskQueueBase::DelayPrecision precision)
+{
+    if (task && !_queue.expired()) {
+        const bool highPrecision = webrtc::TaskQueueBase::DelayPrecision::kHigh == precision;
+        auto entry = std::make_shared<Entry>(std::move(task), nowMs() + int64_t(delayMs),
+                                             intervalMs, highPrecision);
+        int64_t wakeUp = _noWakeUp;
+        {
+            const std::lock_guard guard(_mutex);
+            link(entry);
+            wakeUp = requestWakeUp(entry->_deadlineMs);
+            precision = wakeUpPrecision();
+        }
+        if (_noWakeUp != wakeUp) {
+            postWakeUp(wakeUp, precision);
+        }
+        return entry;
+    }
+    return {};
+}
+
+void MediaTimerWheel::cancel(const std::shared_ptr<Entry>& entry)
+{
+    if (entry && !entry->_cancelled.exchange(true)) {
+        // pending wake-up (if any) is not revoked, it just finds nothing to fire
+        const std::lock_guard guard(_mutex);
+        unlink(entry.get());
+    }
+}
+
+int64_t MediaTimerWheel::nowMs()
+{
+    return webrtc::TimeMillis();
+}
+
+void MediaTimerWheel::link(const std::shared_ptr<Entry>& entry, bool cascading)
+{
+    // deadlines on the block boundary are due right at the cascading tick
+    const auto deadline = std::max(entry->_deadlineMs, cascading ? _currentMs : _currentMs + 1);
+    const auto delta = deadline - _currentMs;
+    size_t level = 0U;
+    while (level + 1U < _levelsCount && delta >= (int64_t(1) << (_levelBits * (level + 1U)))) {
+        ++level;
+    }
+    // deadlines beyond of the top level are placed to its farthest slot
+    const auto maxDelta = (int64_t(1) << (_levelBits * _levelsCount)) - 1;
+    const auto position = std::min(deadline, _currentMs + maxDelta);
+    auto& slot = _levels[level][size_t(position >> (_levelBits * level)) & (_slotsCount - 1U)];
+    entry->_self = entry;
+    entry->_slot = &slot;
+    entry->_level = level;
+    entry->_prev = nullptr;
+    entry->_next = slot._head;
+    if (slot._head) {
+        slot._head->_prev = entry.get();
+    }
+    slot._head = entry.get();
+    ++_levelSizes[level];
+    if (entry->_highPrecision) {
+        ++_highPrecisionCount;
+    }
+}
+
+void MediaTimerWheel::unlink(Entry* entry)
+{
+    if (const auto slot = entry->_slot) {
+        if (entry->_prev) {
+            entry->_prev->_next = entry->_next;
+        }
+        else {
+            slot->_head = entry->_next;
+        }
+        if (entry->_next) {
+            entry->_next->_prev = entry->_prev;
+        }
+        --_levelSizes[entry->_level];
+        if (entry->_highPrecision) {
+            --_highPrecisionCount;
+        }
+        entry->_slot = nullptr;
+        entry->_prev = entry->_next = nullptr;
+        // entry may be destroyed here
+        const auto self = std::move(entry->_self);
+    }
+}
+
+void MediaTimerWheel::advance(int64_t timeMs, std::vector<std::shared_ptr<Entry>>& expired)
+{
+    while (_currentMs < timeMs) {
+        if (0U == _levelSizes[0]) {
+            // skip ticks without expirations up to the end of block of the lowest non-empty level
+            size_t level = 1U;
+            while (level < _levelsCount && 0U == _levelSizes[level]) {
+                ++level;
+            }
+            if (level == _levelsCount) {
+                _currentMs = timeMs;
+                break;
+            }
+            const auto blockEnd = _currentMs | ((int64_t(1) << (_levelBits * level)) - 1);
+            if (blockEnd > _currentMs) {
+                _currentMs = std::min(timeMs, blockEnd);
+                continue;
+            }
+        }
+        const auto tick = ++_currentMs;
+        // cascade higher levels at block boundaries, from top to bottom
+        size_t top = 0U;
+        while (top + 1U < _levelsCount && 0 == (tick & ((int64_t(1) << (_levelBits * (top + 1U))) - 1))) {
+            ++top;
+        }
+        for (size_t level = top; level > 0U; --level) {
+            cascade(level);
+        }
+        auto& slot = _levels[0][size_t(tick) & (_slotsCount - 1U)];
+        while (slot._head) {
+            expired.push_back(slot._head->_self);
+            unlink(slot._head);
+        }
+    }
+}
+
+void MediaTimerWheel::cascade(size_t level)
+{
+    auto& slot = _levels[level][size_t(_currentMs >> (_levelBits * level)) & (_slotsCount - 1U)];
+    auto entry = slot._head;
+    while (entry) {
+        const auto next = entry->_next;
+        const auto self = entry->_self;
+        unlink(entry);
+        // always lands to the lower level or to another slot of the top level
+        link(self, true);
+        entry = next;
+    }
+}
+
+int64_t MediaTimerWheel::nextExpiration() const
+{
+    int64_t next = _noWakeUp;
+    for (size_t level = 0U; level < _levelsCount; ++level) {
+        if (_levelSizes[level]) {
+            const auto shift = _levelBits * level;
+            const auto current = _currentMs >> shift;
+            for (int64_t i = 1; i <= int64_t(_slotsCount); ++i) {
+                if (_levels[level][size_t(current + i) & (_slotsCount - 1U)]._head) {
+                    // exact deadline for the lowest level, cascading time for others
+                    next = std::min(next, (current + i) << shift);
+                    break;
+                }
+            }
+        }
+    }
+    return next;
+}
+
+int64_t MediaTimerWheel::requestWakeUp(int64_t timeMs)
+{
+    if (_noWakeUp != timeMs) {
+        timeMs = std::max(timeMs, _currentMs + 1);
+        if (timeMs < _wakeUpMs) {
+            _wakeUpMs = timeMs;
+            return timeMs;
+        }
+    }
+    return _noWakeUp;
+}
+
+webrtc::TaskQueueBase::DelayPrecision MediaTimerWheel::wakeUpPrecision() const
+{
+    if (_highPrecisionCount) {
+        return webrtc::TaskQueueBase::DelayPrecision::kHigh;
+    }
+    return webrtc::TaskQueueBase::DelayPrecision::kLow;
+}
+
+void MediaTimerWheel::postWakeUp(int64_t timeMs, webrtc::TaskQueueBase::DelayPrecision precision)
+{
+    if (const auto queue = _queue.lock()) {
+        const auto delay = std::max<int64_t>(0, timeMs - nowMs());
+        queue->PostDelayedTaskWithPrecision(precision, [timeMs, weak = weak_from_this()]() {
+            if (const auto self = weak.lock()) {
+                self->onWakeUp(timeMs);
+            }
+        }, webrtc::TimeDelta::Millis(delay));
+    }
+}
+
+void MediaTimerWheel::onWakeUp(int64_t timeMs)
+{
+    std::vector<std::shared_ptr<Entry>> expired;
+    int64_t wakeUp = _noWakeUp;
+    auto precision = webrtc::TaskQueueBase::DelayPrecision::kLow;
+    {
+        const std::lock_guard guard(_mutex);
+        if (timeMs == _wakeUpMs) {
+            _wakeUpMs = _noWakeUp;
+        }
+        const auto now = nowMs();
+        advance(now, expired);
+        // re-arm periodic entries before invocation, so they can be cancelled from callbacks
+        for (const auto& entry : expired) {
+            if (entry->_intervalMs > 0 && !entry->cancelled()) {
+                entry->_deadlineMs += entry->_intervalMs;
+                if (entry->_deadlineMs <= now) {
+                    // missed ticks are skipped, but the phase is kept
+                    const auto missed = (now - entry->_deadlineMs) / entry->_intervalMs + 1;
+                    entry->_deadlineMs += missed * entry->_intervalMs;
+                }
+                link(entry);
+            }
+        }
+        wakeUp = requestWakeUp(nextExpiration());
+        precision = wakeUpPrecision();
+    }
+    if (_noWakeUp != wakeUp) {
+        postWakeUp(wakeUp, precision);
+    }
+    for (const auto& entry : expired) {
+        if (0 == entry->_intervalMs) {
+            if (!entry->_cancelled.exchange(true)) {
+                entry->_task();
+            }
+        }
+        else if (!entry->cancelled()) {
+            entry->_task();
+        }
+    }
+}
+
+} // namespace LiveKitCpp
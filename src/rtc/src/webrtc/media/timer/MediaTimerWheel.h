@@ -0,0 +1,101 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // MediaTimerWheel.h
+#include <absl/functional/any_invocable.h>
+#include <api/task_queue/task_queue_base.h>
+#include <array>
+#include <limits>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// hierarchical timing wheel with 1 ms resolution, shared by all timers of the same task queue:
+// absolute deadlines (periodic timers don't drift), O(1) insert & cancel,
+// expired timers are fired by one batch from the single wake-up task
+class MediaTimerWheel : public std::enable_shared_from_this<MediaTimerWheel>
+{
+public:
+    class Entry;
+private:
+    struct Slot
+    {
+        Entry* _head = nullptr;
+    };
+public:
+    using Task = absl::AnyInvocable<void()>;
+    ~MediaTimerWheel();
+    // returns null if [queue] is null
+    static std::shared_ptr<MediaTimerWheel> get(const std::shared_ptr<webrtc::TaskQueueBase>& queue);
+    // first expiration after [delayMs], periodic if [intervalMs] is positive,
+    // returns null if queue is already destroyed
+    std::shared_ptr<Entry> schedule(Task task, uint64_t delayMs, uint64_t intervalMs = 0ULL,
+                                    webrtc::TaskQueueBase::DelayPrecision precision = webrtc::TaskQueueBase::DelayPrecision::kLow);
+    // task will not be invoked after return (unless it's running right now)
+    void cancel(const std::shared_ptr<Entry>& entry);
+private:
+    MediaTimerWheel(const std::shared_ptr<webrtc::TaskQueueBase>& queue);
+    static int64_t nowMs();
+    // both methods require locked [_mutex],
+    // [cascading] entries may land to the slot of the current tick, it's processed right after cascade
+    void link(const std::shared_ptr<Entry>& entry, bool cascading = false);
+    void unlink(Entry* entry);
+    // moves wheel time to [timeMs], expired entries are unlinked and collected to [expired]
+    void advance(int64_t timeMs, std::vector<std::shared_ptr<Entry>>& expired);
+    void cascade(size_t level);
+    int64_t nextExpiration() const;
+    // returns time of wake-up which should be posted or [_noWakeUp]
+    int64_t requestWakeUp(int64_t timeMs);
+    webrtc::TaskQueueBase::DelayPrecision wakeUpPrecision() const;
+    void postWakeUp(int64_t timeMs, webrtc::TaskQueueBase::DelayPrecision precision);
+    void onWakeUp(int64_t timeMs);
+private:
+    static constexpr size_t _levelBits = 6U;
+    static constexpr size_t _slotsCount = 1U << _levelBits;
+    static constexpr size_t _levelsCount = 4U; // ~4.6 hours, longer delays are re-cascaded
+    static constexpr int64_t _noWakeUp = std::numeric_limits<int64_t>::max();
+    const std::weak_ptr<webrtc::TaskQueueBase> _queue;
+    std::mutex _mutex;
+    // all slots up to this time are processed
+    int64_t _currentMs;
+    std::array<std::array<Slot, _slotsCount>, _levelsCount> _levels;
+    std::array<size_t, _levelsCount> _levelSizes = {};
+    size_t _highPrecisionCount = 0U;
+    int64_t _wakeUpMs = _noWakeUp;
+};
+
+class MediaTimerWheel::Entry
+{
+    friend class MediaTimerWheel;
+public:
+    Entry(Task task, int64_t deadlineMs, uint64_t intervalMs, bool highPrecision);
+    bool cancelled() const noexcept { return _cancelled; }
+private:
+    Task _task;
+    int64_t _deadlineMs;
+    const int64_t _intervalMs;
+    const bool _highPrecision;
+    std::atomic_bool _cancelled = false;
+    // intrusive list of slot, guarded by wheel mutex
+    std::shared_ptr<Entry> _self; // non-null while linked
+    Slot* _slot = nullptr;
+    size_t _level = 0U;
+    Entry* _prev = nullptr;
+    Entry* _next = nullptr;
+};
+
+} // namespace LiveKitCpp
@@ -13,6 +13,7 @@
 // limitations under the License.
 #include "AsyncVideoSourceImpl.h"
 #include "VideoSinkBroadcast.h"
+#include "VideoFrameRenditions.h"
 #include "VideoFrameBufferPoolSource.h"
 #include "VideoUtils.h"
 #include "VideoFrameImpl.h"
@@ -62,7 +63,10 @@ AsyncVideoSourceImpl::AsyncVideoSourceImpl(std::weak_ptr<webrtc::TaskQueueBase>
     // TODO: add assertion
 #endif
     if (_framesPool) {
-        _framesPool->resize(webrtc::videocapturemodule::kDefaultFrameRate);
+        // pool is shared with sink broadcasters, for scaled & rotated renditions too,
+        // so reserve room for them in addition to captured frames
+        _framesPool->resize(2U * webrtc::videocapturemodule::kDefaultFrameRate);
+        _framesPool->setContentHint(initialContentHint);
     }
 }
 
@@ -138,8 +142,7 @@ bool AsyncVideoSourceImpl::addOrUpdateSink(webrtc::VideoSinkInterface<webrtc::Vi
             }
             else {
                 if (!it->second) {
-                    it->second = std::make_unique<VideoSinkBroadcast>(sink, wants);
-                    it->second->setContentHint(contentHint());
+                    it->second = std::make_unique<VideoSinkBroadcast>(sink, wants, framesPool());
                 }
                 else {
                     it->second->updateSinkWants(wants);
@@ -149,8 +152,7 @@ bool AsyncVideoSourceImpl::addOrUpdateSink(webrtc::VideoSinkInterface<webrtc::Vi
         else {
             std::unique_ptr<VideoSinkBroadcast> adapter;
             if (!isDefaultWants(wants)) {
-                adapter = std::make_unique<VideoSinkBroadcast>(sink, wants);
-                adapter->setContentHint(contentHint());
+                adapter = std::make_unique<VideoSinkBroadcast>(sink, wants, framesPool());
             }
             _broadcasters->insert(std::make_pair(sink, std::move(adapter)));
             return 1U == _broadcasters->size();
@@ -176,12 +178,6 @@ void AsyncVideoSourceImpl::updateAfterContentHintChanges(VideoContentHint hint)
         if (_framesPool) {
             _framesPool->setContentHint(hint);
         }
-        LOCK_READ_SAFE_OBJ(_broadcasters);
-        for (auto it = _broadcasters->begin(); it != _broadcasters->end(); ++it) {
-            if (it->second) {
-                it->second->setContentHint(hint);
-            }
-        }
     }
 }
 
@@ -322,10 +318,12 @@ void AsyncVideoSourceImpl::OnConstraintsChanged(const webrtc::VideoTrackSourceCo
 void AsyncVideoSourceImpl::broadcast(const webrtc::VideoFrame& frame)
 {
     _lastResolution = clueToUint64(frame.width(), frame.height());
+    // each distinct crop/scale/rotation is computed once per frame for all sinks
+    VideoFrameRenditions renditions(frame, framesPool());
     LOCK_READ_SAFE_OBJ(_broadcasters);
     for (auto it = _broadcasters->begin(); it != _broadcasters->end(); ++it) {
         if (it->second) {
-            it->second->OnFrame(frame);
+            it->second->onFrame(renditions);
         }
         else {
             it->first->OnFrame(frame);
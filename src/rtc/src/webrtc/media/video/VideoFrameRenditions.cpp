@@ -0,0 +1,184 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "VideoFrameRenditions.h"
+#include "LibyuvImport.h"
+#include <api/video/i420_buffer.h>
+#include <api/video/nv12_buffer.h>
+
+namespace
+{
+
+inline bool swapDimensions(webrtc::VideoRotation rotation) {
+    return webrtc::kVideoRotation_90 == rotation || webrtc::kVideoRotation_270 == rotation;
+}
+
+}
+
+namespace LiveKitCpp
+{
+
+VideoFrameRenditions::VideoFrameRenditions(const webrtc::VideoFrame& source,
+                                           VideoFrameBufferPool framesPool)
+    : _source(source)
+    , _framesPool(std::move(framesPool))
+{
+}
+
+std::optional<webrtc::VideoFrame> VideoFrameRenditions::rendition(int cropX, int cropY,
+                                                                  int cropWidth, int cropHeight,
+                                                                  int width, int height,
+                                                                  bool applyRotation)
+{
+    Key key;
+    // origin is rounded down to even for keeping of luma & chroma planes aligned,
+    // like in libyuv & webrtc::I420Buffer::CropAndScaleFrom
+    key._cropX = cropX & ~1;
+    key._cropY = cropY & ~1;
+    key._cropWidth = cropWidth;
+    key._cropHeight = cropHeight;
+    key._width = width;
+    key._height = height;
+    key._rotated = applyRotation && webrtc::kVideoRotation_0 != _source.rotation();
+    if (identical(key)) {
+        return _source;
+    }
+    if (auto renditionBuffer = buffer(key)) {
+        webrtc::VideoFrame frame(_source);
+        frame.set_video_frame_buffer(std::move(renditionBuffer));
+        if (key._rotated) {
+            frame.set_rotation(webrtc::kVideoRotation_0);
+        }
+        return frame;
+    }
+    return std::nullopt;
+}
+
+bool VideoFrameRenditions::identical(const Key& key) const
+{
+    return !key._rotated && 0 == key._cropX && 0 == key._cropY &&
+        key._cropWidth == _source.width() && key._cropHeight == _source.height() &&
+        key._width == _source.width() && key._height == _source.height();
+}
+
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer> VideoFrameRenditions::buffer(const Key& key)
+{
+    for (const auto& rendition : _renditions) {
+        if (rendition.first == key) {
+            return rendition.second;
+        }
+    }
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> output;
+    if (key._rotated) {
+        // rotation is applied on top of (probably shared) not rotated rendition
+        auto notRotatedKey = key;
+        notRotatedKey._rotated = false;
+        if (identical(notRotatedKey)) {
+            output = rotate(_source.video_frame_buffer());
+        }
+        else {
+            output = rotate(buffer(notRotatedKey));
+        }
+    }
+    else {
+        output = cropAndScale(key);
+    }
+    // failures are cached too, for avoiding of repeated attempts by other sinks
+    _renditions.push_back(std::make_pair(key, output));
+    return output;
+}
+
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer> VideoFrameRenditions::cropAndScale(const Key& key) const
+{
+    const auto& source = _source.video_frame_buffer();
+    if (source) {
+        switch (source->type()) {
+            case webrtc::VideoFrameBuffer::Type::kI420:
+                if (const auto scaled = _framesPool.createI420(key._width, key._height)) {
+                    const auto i420 = source->GetI420();
+                    const auto uvOffsetX = key._cropX / 2, uvOffsetY = key._cropY / 2;
+                    if (0 == libyuv::I420Scale(i420->DataY() + i420->StrideY() * key._cropY + key._cropX,
+                                               i420->StrideY(),
+                                               i420->DataU() + i420->StrideU() * uvOffsetY + uvOffsetX,
+                                               i420->StrideU(),
+                                               i420->DataV() + i420->StrideV() * uvOffsetY + uvOffsetX,
+                                               i420->StrideV(),
+                                               key._cropWidth, key._cropHeight,
+                                               scaled->MutableDataY(), scaled->StrideY(),
+                                               scaled->MutableDataU(), scaled->StrideU(),
+                                               scaled->MutableDataV(), scaled->StrideV(),
+                                               scaled->width(), scaled->height(),
+                                               mapLibYUV(_framesPool.contentHint()))) {
+                        return scaled;
+                    }
+                }
+                break;
+            case webrtc::VideoFrameBuffer::Type::kNV12:
+                if (const auto scaled = _framesPool.createNV12(key._width, key._height)) {
+                    scaled->CropAndScaleFrom(*source->GetNV12(), key._cropX, key._cropY,
+                                             key._cropWidth, key._cropHeight);
+                    return scaled;
+                }
+                break;
+            default:
+                // native buffers are scaled by own implementation (pooled if possible)
+                break;
+        }
+        return source->CropAndScale(key._cropX, key._cropY, key._cropWidth,
+                                    key._cropHeight, key._width, key._height);
+    }
+    return nullptr;
+}
+
+webrtc::scoped_refptr<webrtc::VideoFrameBuffer> VideoFrameRenditions::
+    rotate(const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer) const
+{
+    if (buffer) {
+        webrtc::scoped_refptr<const webrtc::I420BufferInterface> i420;
+        if (webrtc::VideoFrameBuffer::Type::kI420 == buffer->type()) {
+            i420 = webrtc::scoped_refptr<const webrtc::I420BufferInterface>(buffer->GetI420());
+        }
+        else {
+            i420 = buffer->ToI420();
+        }
+        if (i420) {
+            const auto rotation = _source.rotation();
+            int width = i420->width(), height = i420->height();
+            if (swapDimensions(rotation)) {
+                std::swap(width, height);
+            }
+            if (const auto rotated = _framesPool.createI420(width, height)) {
+                if (0 == libyuv::I420Rotate(i420->DataY(), i420->StrideY(),
+                                            i420->DataU(), i420->StrideU(),
+                                            i420->DataV(), i420->StrideV(),
+                                            rotated->MutableDataY(), rotated->StrideY(),
+                                            rotated->MutableDataU(), rotated->StrideU(),
+                                            rotated->MutableDataV(), rotated->StrideV(),
+                                            i420->width(), i420->height(),
+                                            static_cast<libyuv::RotationMode>(rotation))) {
+                    return rotated;
+                }
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool VideoFrameRenditions::Key::operator == (const Key& other) const
+{
+    return _cropX == other._cropX && _cropY == other._cropY &&
+        _cropWidth == other._cropWidth && _cropHeight == other._cropHeight &&
+        _width == other._width && _height == other._height && _rotated == other._rotated;
+}
+
+} // namespace LiveKitCpp
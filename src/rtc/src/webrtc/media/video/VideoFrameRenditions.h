@@ -0,0 +1,66 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // VideoFrameRenditions.h
+#include "VideoFrameBufferPool.h"
+#include <api/video/video_frame.h>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// per-frame cache of cropped, scaled & rotated variants of the source frame:
+// each distinct rendition is produced only once and the same refcounted buffer
+// is shared between all sinks which requested it, not thread-safe -
+// intended for a single broadcast pass on the capturer thread
+class VideoFrameRenditions
+{
+public:
+    VideoFrameRenditions(const webrtc::VideoFrame& source, VideoFrameBufferPool framesPool = {});
+    const webrtc::VideoFrame& source() const noexcept { return _source; }
+    // returns source frame if no cropping, scaling or rotation is required,
+    // [applyRotation] means that output buffer is rotated according to source rotation
+    std::optional<webrtc::VideoFrame> rendition(int cropX, int cropY,
+                                                int cropWidth, int cropHeight,
+                                                int width, int height,
+                                                bool applyRotation);
+private:
+    struct Key
+    {
+        int _cropX = 0;
+        int _cropY = 0;
+        int _cropWidth = 0;
+        int _cropHeight = 0;
+        int _width = 0;
+        int _height = 0;
+        bool _rotated = false;
+        bool operator == (const Key& other) const;
+    };
+    using Rendition = std::pair<Key, webrtc::scoped_refptr<webrtc::VideoFrameBuffer>>;
+private:
+    bool identical(const Key& key) const;
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer(const Key& key);
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> cropAndScale(const Key& key) const;
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer>
+        rotate(const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer) const;
+private:
+    const webrtc::VideoFrame& _source;
+    const VideoFrameBufferPool _framesPool;
+    // number of distinct renditions is small (a few sinks per source),
+    // so linear search is faster than hashing
+    std::vector<Rendition> _renditions;
+};
+
+} // namespace LiveKitCpp
@@ -12,29 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "VideoSinkBroadcast.h"
-#include "VideoFrameBufferPoolSource.h"
-
-namespace {
-
-inline webrtc::scoped_refptr<const webrtc::I420BufferInterface> toI420(const webrtc::VideoFrame& frame) {
-    if (const auto buffer = frame.video_frame_buffer()) {
-        if (webrtc::VideoFrameBuffer::Type::kI420 == buffer->type()) {
-            return webrtc::scoped_refptr<const webrtc::I420BufferInterface>(buffer->GetI420());
-        }
-        return buffer->ToI420();
-    }
-    return {};
-}
-
-}
+#include "VideoFrameRenditions.h"
 
 namespace LiveKitCpp
 {
 
 VideoSinkBroadcast::VideoSinkBroadcast(webrtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
-                                       const webrtc::VideoSinkWants& wants)
+                                       const webrtc::VideoSinkWants& wants,
+                                       VideoFrameBufferPool framesPool)
     : _sink(sink)
-    , _framesPool(VideoFrameBufferPoolSource::create())
+    , _framesPool(std::move(framesPool))
     , _adapter(2)
 {
     assert(_sink);
@@ -49,34 +36,31 @@ void VideoSinkBroadcast::updateSinkWants(const webrtc::VideoSinkWants& wants)
     _rotationApplied = wants.rotation_applied;
 }
 
-void VideoSinkBroadcast::setContentHint(VideoContentHint hint)
-{
-    if (_framesPool) {
-        _framesPool->setContentHint(hint);
-    }
-}
-
-void VideoSinkBroadcast::OnFrame(const webrtc::VideoFrame& frame)
+void VideoSinkBroadcast::onFrame(VideoFrameRenditions& renditions)
 {
-    if (auto buffer = frame.video_frame_buffer()) {
+    const auto& frame = renditions.source();
+    if (frame.video_frame_buffer()) {
         int adaptedWidth, adaptedHeight, cropWidth, cropHeight, cropX, cropY;
         if (adaptFrame(frame.width(), frame.height(), frame.timestamp_us(),
                        adaptedWidth, adaptedHeight,
                        cropWidth, cropHeight, cropX, cropY)) {
-            if (adaptedWidth == frame.width() && adaptedHeight == frame.height()) {
-                // No adaption - optimized path.
-                broadcast(frame);
-            }
-            else {
-                buffer = buffer->CropAndScale(cropX, cropY, cropWidth, cropHeight, adaptedWidth, adaptedHeight);
-                webrtc::VideoFrame adapted(frame);
-                adapted.set_video_frame_buffer(buffer);
-                broadcast(adapted);
+            // source frame is returned if no adaption & rotation - optimized path
+            if (const auto adapted = renditions.rendition(cropX, cropY,
+                                                          cropWidth, cropHeight,
+                                                          adaptedWidth, adaptedHeight,
+                                                          _rotationApplied)) {
+                _broadcaster.OnFrame(adapted.value());
             }
         }
     }
 }
 
+void VideoSinkBroadcast::OnFrame(const webrtc::VideoFrame& frame)
+{
+    VideoFrameRenditions renditions(frame, _framesPool);
+    onFrame(renditions);
+}
+
 void VideoSinkBroadcast::OnDiscardedFrame()
 {
     _broadcaster.OnDiscardedFrame();
@@ -107,20 +91,4 @@ bool VideoSinkBroadcast::adaptFrame(int width, int height, int64_t timeUs,
     return true;
 }
 
-void VideoSinkBroadcast::broadcast(const webrtc::VideoFrame& frame)
-{
-    if (_rotationApplied && frame.rotation() != webrtc::kVideoRotation_0) {
-        if (const auto srcI420 = toI420(frame)) {
-            webrtc::VideoFrame rotatedFrame(frame);
-            // TODO: change rotation code to usage of [framesPool]
-            auto rotatedBuffer = webrtc::I420Buffer::Rotate(*srcI420, frame.rotation());
-            rotatedFrame.set_video_frame_buffer(rotatedBuffer);
-            rotatedFrame.set_rotation(webrtc::kVideoRotation_0);
-            _broadcaster.OnFrame(rotatedFrame);
-        }
-    } else {
-        _broadcaster.OnFrame(frame);
-    }
-}
-
 } // namespace LiveKitCpp
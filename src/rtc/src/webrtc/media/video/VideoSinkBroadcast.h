@@ -16,20 +16,22 @@
 #include <media/base/video_adapter.h>
 #include <media/base/video_broadcaster.h>
 #include <atomic>
-#include <memory>
 
 namespace LiveKitCpp
 {
 
-class VideoFrameBufferPoolSource;
+class VideoFrameRenditions;
 
 class VideoSinkBroadcast : public webrtc::VideoSinkInterface<webrtc::VideoFrame>
 {
 public:
     VideoSinkBroadcast(webrtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
-                       const webrtc::VideoSinkWants& wants = {});
+                       const webrtc::VideoSinkWants& wants = {},
+                       VideoFrameBufferPool framesPool = {});
     void updateSinkWants(const webrtc::VideoSinkWants& wants);
-    void setContentHint(VideoContentHint hint);
+    // adapted frame is taken from (or added to) renditions cache,
+    // shared with other broadcasters of the same source frame
+    void onFrame(VideoFrameRenditions& renditions);
     // impl. of webrtc::VideoSinkInterface<webrtc::VideoFrame>
     void OnFrame(const webrtc::VideoFrame& frame) final;
     void OnDiscardedFrame() final;
@@ -42,10 +44,9 @@ private:
                     int& outWidth, int& outHeight,
                     int& cropWidth, int& cropHeight,
                     int& cropX, int& cropY);
-    void broadcast(const webrtc::VideoFrame& frame);
 private:
     webrtc::VideoSinkInterface<webrtc::VideoFrame>* const _sink;
-    const std::shared_ptr<VideoFrameBufferPoolSource> _framesPool;
+    const VideoFrameBufferPool _framesPool;
     webrtc::VideoAdapter _adapter;
     webrtc::VideoBroadcaster _broadcaster;
     std::atomic_bool _rotationApplied = false;
@@ -23,6 +23,7 @@
 #endif
 #include "livekit/rtc/media/VideoOptions.h"
 #include <rtc_base/time_utils.h>
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 
@@ -274,6 +275,66 @@ CodecStatus decoderStatus(const webrtc::SdpVideoFormat& format)
     return status;
 }
 
+std::string simulcastRid(VideoQuality quality)
+{
+    switch (quality) {
+        case VideoQuality::Low:
+            return "q";
+        case VideoQuality::Medium:
+            return "h";
+        case VideoQuality::High:
+            return "f";
+        default:
+            break;
+    }
+    return {};
+}
+
+std::optional<VideoQuality> simulcastQuality(std::string_view rid)
+{
+    if (rid == "q") {
+        return VideoQuality::Low;
+    }
+    if (rid == "h") {
+        return VideoQuality::Medium;
+    }
+    if (rid == "f") {
+        return VideoQuality::High;
+    }
+    return std::nullopt;
+}
+
+std::vector<webrtc::RtpEncodingParameters> makeSimulcastEncodings(const std::vector<VideoSimulcastLayer>& layers)
+{
+    std::vector<webrtc::RtpEncodingParameters> encodings;
+    encodings.reserve(layers.size());
+    for (const auto& layer : layers) {
+        auto rid = simulcastRid(layer._quality);
+        if (rid.empty()) {
+            continue;
+        }
+        const auto duplicate = std::any_of(encodings.begin(), encodings.end(),
+                                           [&rid](const auto& e) { return e.rid == rid; });
+        if (!duplicate) {
+            webrtc::RtpEncodingParameters encoding;
+            encoding.rid = std::move(rid);
+            encoding.scale_resolution_down_by = std::max(1., layer._scaleResolutionDownBy);
+            if (layer._maxBitrateBps > 0) {
+                encoding.max_bitrate_bps = layer._maxBitrateBps;
+            }
+            if (layer._maxFramerate > 0) {
+                encoding.max_framerate = layer._maxFramerate;
+            }
+            encodings.push_back(std::move(encoding));
+        }
+    }
+    // WebRTC expects encodings in order of increasing resolution
+    std::stable_sort(encodings.begin(), encodings.end(), [](const auto& l, const auto& r) {
+        return l.scale_resolution_down_by.value_or(1.) > r.scale_resolution_down_by.value_or(1.);
+    });
+    return encodings;
+}
+
 std::vector<webrtc::SdpVideoFormat> mergeFormats(std::vector<webrtc::SdpVideoFormat> f1,
                                                  std::vector<webrtc::SdpVideoFormat> f2)
 {
@@ -19,7 +19,9 @@
 #include <VideoToolbox/VideoToolbox.h>
 #endif
 #include "livekit/rtc/media/VideoContentHint.h"
+#include "livekit/rtc/media/VideoSimulcastLayer.h"
 #include <api/media_stream_interface.h>
+#include <api/rtp_parameters.h>
 #include <api/video/video_frame.h>
 #include <api/video_codecs/sdp_video_format.h>
 #include <modules/video_capture/video_capture_config.h> // for values in webrtc::videocapturemodule
@@ -49,6 +51,12 @@ VideoContentHint map(webrtc::VideoTrackInterface::ContentHint hint);
 constexpr VideoContentHint defaultCameraContentHint() { return VideoContentHint::Motion; }
 // or VideoContentHint::Detailed?
 constexpr VideoContentHint defaultSharingContentHint() { return VideoContentHint::Text; }
+// simulcast, RIDs are compatible with LiveKit clients: 'q', 'h' & 'f'
+std::string simulcastRid(VideoQuality quality);
+std::optional<VideoQuality> simulcastQuality(std::string_view rid);
+// send encodings ordered from low to high quality,
+// layers with duplicated or 'Off' quality are ignored
+std::vector<webrtc::RtpEncodingParameters> makeSimulcastEncodings(const std::vector<VideoSimulcastLayer>& layers);
 
 bool scaleNV12(const uint8_t* srcY, int srcStrideY,
                const uint8_t* srcUV, int srcStrideUV,
@@ -13,9 +13,15 @@
 // limitations under the License.
 #include "VideoFrameBufferPoolSource.h"
 #include "VideoFrameBufferPool.h"
+#include "Metrics.h"
 #include "RgbVideoFrameBuffer.h"
+#include "Utils.h"
 #include <api/make_ref_counted.h>
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <tuple>
+#include <type_traits>
 
 namespace
 {
@@ -52,6 +58,17 @@ inline webrtc::VideoFrameBuffer::Type type<webrtc::NV12Buffer>() { return webrtc
 template <>
 inline webrtc::VideoFrameBuffer::Type type<LiveKitCpp::RgbVideoFrameBuffer>() { return webrtc::VideoFrameBuffer::Type::kNative; }
 
+inline size_t planarSize(int strideY, int strideU, int strideV,
+                         int height, int chromaHeight,
+                         size_t bytesPerSample = 1U) {
+    return bytesPerSample * (size_t(strideY) * height + size_t(strideU + strideV) * chromaHeight);
+}
+
+template <typename T>
+inline void hashCombine(size_t& seed, const T& value) {
+    seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
 }
 
 namespace LiveKitCpp
@@ -63,7 +80,14 @@ VideoFrameBufferPoolSource::VideoFrameBufferPoolSource()
 }
 
 VideoFrameBufferPoolSource::VideoFrameBufferPoolSource(size_t maxNumberOfBuffers)
+    : VideoFrameBufferPoolSource(maxNumberOfBuffers, defaultMaxMemoryUsage())
+{
+}
+
+VideoFrameBufferPoolSource::VideoFrameBufferPoolSource(size_t maxNumberOfBuffers,
+                                                       size_t maxMemoryUsage)
     : _maxNumberOfBuffers(maxNumberOfBuffers)
+    , _maxMemoryUsage(maxMemoryUsage)
 {
 }
 
@@ -77,38 +101,70 @@ std::shared_ptr<VideoFrameBufferPoolSource> VideoFrameBufferPoolSource::create(s
     return std::shared_ptr<VideoFrameBufferPoolSource>(new VideoFrameBufferPoolSource(maxNumberOfBuffers));
 }
 
+std::shared_ptr<VideoFrameBufferPoolSource> VideoFrameBufferPoolSource::create(size_t maxNumberOfBuffers,
+                                                                               size_t maxMemoryUsage)
+{
+    return std::shared_ptr<VideoFrameBufferPoolSource>(new VideoFrameBufferPoolSource(maxNumberOfBuffers,
+                                                                                      maxMemoryUsage));
+}
+
 bool VideoFrameBufferPoolSource::resize(size_t maxNumberOfBuffers)
 {
-    LOCK_WRITE_SAFE_OBJ(_buffers);
     if (maxNumberOfBuffers != _maxNumberOfBuffers) {
         size_t usedBuffersCount = 0U;
-        for (const auto& buffer : _buffers.constRef()) {
-            // If the buffer is in use, the ref count will be >= 2, one from the list we
-            // are looping over and one from the application. If the ref count is 1,
-            // then the list we are looping over holds the only reference and it's safe
-            // to reuse.
-            if (!hasOneRef(buffer)) {
-                usedBuffersCount++;
+        for (auto& shard : _shards) {
+            LOCK_READ_SAFE_OBJ(shard);
+            for (const auto& sizeClass : shard.constRef()) {
+                for (const auto& buffer : sizeClass.second._buffers) {
+                    // If the buffer is in use, the ref count will be >= 2, one from the list we
+                    // are looping over and one from the application. If the ref count is 1,
+                    // then the list we are looping over holds the only reference and it's safe
+                    // to reuse.
+                    if (!hasOneRef(buffer)) {
+                        usedBuffersCount++;
+                    }
+                }
             }
         }
         if (usedBuffersCount > maxNumberOfBuffers) {
             return false;
         }
         _maxNumberOfBuffers = maxNumberOfBuffers;
-        size_t buffersToPurge = _buffers->size() - _maxNumberOfBuffers;
-        auto it = _buffers->begin();
-        while (it != _buffers->end() && buffersToPurge > 0U) {
-            if (hasOneRef(*it)) {
-                it = _buffers->erase(it);
-                buffersToPurge--;
-            } else {
-                ++it;
-            }
-        }
+        evict(maxNumberOfBuffers, _maxMemoryUsage);
     }
     return true;
 }
 
+void VideoFrameBufferPoolSource::setMaxMemoryUsage(size_t maxMemoryUsage)
+{
+    if (exchangeVal(maxMemoryUsage, _maxMemoryUsage)) {
+        evict(_maxNumberOfBuffers, maxMemoryUsage);
+    }
+}
+
+VideoFrameBufferPoolSource::Stats VideoFrameBufferPoolSource::stats() const
+{
+    Stats stats;
+    stats._hits = _hits;
+    stats._misses = _misses;
+    stats._evictions = _evictions;
+    stats._buffersCount = _buffersCount;
+    stats._memoryUsage = _memoryUsage;
+    return stats;
+}
+
+void VideoFrameBufferPoolSource::release()
+{
+    for (auto& shard : _shards) {
+        LOCK_WRITE_SAFE_OBJ(shard);
+        for (const auto& sizeClass : shard.constRef()) {
+            const auto count = sizeClass.second._buffers.size();
+            unreserve(count, count * sizeClass.second._bufferSize);
+        }
+        shard->clear();
+    }
+}
+
 webrtc::scoped_refptr<webrtc::I420Buffer> VideoFrameBufferPoolSource::createI420(int width, int height)
 {
     return create<webrtc::I420Buffer, false>(width, height);
@@ -151,28 +207,30 @@ webrtc::scoped_refptr<RgbVideoFrameBuffer> VideoFrameBufferPoolSource::createRgb
     return create<RgbVideoFrameBuffer, true>(width, height, rgbFormat, stride);
 }
 
-template <typename... Args>
+VideoFrameBufferPoolSource::Shard& VideoFrameBufferPoolSource::shard(const SizeClass& sizeClass)
+{
+    return _shards[SizeClassHash{}(sizeClass) % _shardsCount];
+}
+
 webrtc::scoped_refptr<webrtc::VideoFrameBuffer> VideoFrameBufferPoolSource::
-    getExisting(int width, int height, webrtc::VideoFrameBuffer::Type type, Args&&... args)
-{
-    // Release buffers with wrong resolution or different type.
-    for (auto it = _buffers->begin(); it != _buffers->end();) {
-        const auto& buffer = *it;
-        if (!matched(buffer, width, height, type, std::forward<Args>(args)...)) {
-            it = _buffers->erase(it);
-        } else {
-            ++it;
-        }
-    }
-    // Look for a free buffer.
-    for (const auto& buffer : _buffers.constRef()) {
-        // If the buffer is in use, the ref count will be >= 2, one from the list we
-        // are looping over and one from the application. If the ref count is 1,
-        // then the list we are looping over holds the only reference and it's safe
-        // to reuse.
-        if (hasOneRef(buffer)) {
-            RTC_CHECK(buffer->type() == type);
-            return buffer;
+    getExisting(const SizeClass& sizeClass)
+{
+    const auto request = _requests.fetch_add(1ULL) + 1ULL;
+    auto& shard = this->shard(sizeClass);
+    LOCK_WRITE_SAFE_OBJ(shard);
+    const auto it = shard->find(sizeClass);
+    if (it != shard->end()) {
+        it->second._lastRequest = request;
+        // Look for a free buffer.
+        for (const auto& buffer : it->second._buffers) {
+            // If the buffer is in use, the ref count will be >= 2, one from the list we
+            // are looping over and one from the application. If the ref count is 1,
+            // then the list we are looping over holds the only reference and it's safe
+            // to reuse.
+            if (hasOneRef(buffer)) {
+                RTC_CHECK(buffer->type() == sizeClass._type);
+                return buffer;
+            }
         }
     }
     return {};
@@ -183,20 +241,21 @@ webrtc::scoped_refptr<TBuffer> VideoFrameBufferPoolSource::create(int width, int
                                                                   Args&&... args)
 {
     if (width > 0 && height > 0) {
-        LOCK_WRITE_SAFE_OBJ(_buffers);
-        if (auto buffer = getExisting(width, height, type<TBuffer>(), std::forward<Args>(args)...)) {
-            // Cast is safe because the only way kI420 buffer is created is
-            // in the same function below, where `RefCountedObject<I420Buffer>` is
+        const auto key = sizeClass<TBuffer>(width, height, args...);
+        if (auto buffer = getExisting(key)) {
+            _hits.fetch_add(1ULL);
+            Metrics::instance()._framePoolHits.add();
+            // Cast is safe because the only way buffer of this size class is created is
+            // in the same function below, where `RefCountedObject<TBuffer>` is
             // created.
             auto rawBuffer = static_cast<webrtc::RefCountedObject<TBuffer>*>(buffer.get());
             // Creates a new scoped_refptr, which is also pointing to the same
             // RefCountedObject as buffer, increasing ref count.
             return webrtc::scoped_refptr<TBuffer>(rawBuffer);
         }
-        if (_buffers->size() >= _maxNumberOfBuffers) {
-            return nullptr;
-        }
-        // Allocate new buffer.
+        _misses.fetch_add(1ULL);
+        Metrics::instance()._framePoolMisses.add();
+        // Allocate new buffer, outside of the shard lock.
         webrtc::scoped_refptr<TBuffer> buffer;
         if constexpr (attachFramePool) {
             buffer = TBuffer::Create(width, height, std::forward<Args>(args)..., weak_from_this());
@@ -204,30 +263,146 @@ webrtc::scoped_refptr<TBuffer> VideoFrameBufferPoolSource::create(int width, int
         else {
             buffer = TBuffer::Create(width, height, std::forward<Args>(args)...);
         }
-        _buffers->push_back(buffer);
+        if (buffer) {
+            const auto bytes = memorySize(buffer);
+            // buffer is not retained by the pool if limits are reached,
+            // it will be simply destroyed after usage
+            if (reserve(key, bytes)) {
+                auto& shard = this->shard(key);
+                LOCK_WRITE_SAFE_OBJ(shard);
+                auto& sizeClassBuffers = shard->try_emplace(key).first->second;
+                sizeClassBuffers._bufferSize = bytes;
+                sizeClassBuffers._buffers.push_back(buffer);
+            }
+        }
         return buffer;
     }
     return {};
 }
 
-template <typename... Args>
-bool VideoFrameBufferPoolSource::matched(const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer,
-                                         int width, int height,
-                                         webrtc::VideoFrameBuffer::Type type,
-                                         Args&&... args)
+bool VideoFrameBufferPoolSource::reserve(const SizeClass& sizeClass, size_t bytes)
 {
-    if (buffer && buffer->width() == width && buffer->height() == height && buffer->type() == type) {
-        if (webrtc::VideoFrameBuffer::Type::kNative == type) {
-            if constexpr (sizeof...(Args) > 0U) {
-                const auto rgb = static_cast<webrtc::RefCountedObject<NativeVideoFrameBuffer>*>(buffer.get());
-                return rgb->nativeType() == std::get<0U>(std::tie(args...));
-            }
+    const size_t maxNumberOfBuffers = _maxNumberOfBuffers;
+    const size_t maxMemoryUsage = _maxMemoryUsage;
+    if (maxNumberOfBuffers > 0U && bytes <= maxMemoryUsage) {
+        if (!fitLimits(maxNumberOfBuffers - 1U, maxMemoryUsage - bytes)) {
+            evict(maxNumberOfBuffers - 1U, maxMemoryUsage - bytes, &sizeClass);
         }
-        return true;
+        const auto buffersCount = _buffersCount.fetch_add(1U) + 1U;
+        const auto memoryUsage = _memoryUsage.fetch_add(bytes) + bytes;
+        Metrics::instance()._framePoolBuffers.add(1);
+        Metrics::instance()._framePoolBytes.add(static_cast<int64_t>(bytes));
+        if (buffersCount <= maxNumberOfBuffers && memoryUsage <= maxMemoryUsage) {
+            return true;
+        }
+        // concurrent allocation took the room
+        unreserve(1U, bytes);
     }
     return false;
 }
 
+void VideoFrameBufferPoolSource::unreserve(size_t buffers, size_t bytes)
+{
+    _buffersCount.fetch_sub(buffers);
+    _memoryUsage.fetch_sub(bytes);
+    Metrics::instance()._framePoolBuffers.sub(static_cast<int64_t>(buffers));
+    Metrics::instance()._framePoolBytes.sub(static_cast<int64_t>(bytes));
+}
+
+void VideoFrameBufferPoolSource::evict(size_t maxNumberOfBuffers, size_t maxMemoryUsage,
+                                       const SizeClass* except)
+{
+    // 1st pass: idle buffers of other size classes, 2nd pass: any idle buffers
+    for (int pass = 0; pass < 2 && !fitLimits(maxNumberOfBuffers, maxMemoryUsage); ++pass) {
+        for (auto& shard : _shards) {
+            LOCK_WRITE_SAFE_OBJ(shard);
+            // least recently used classes first
+            std::vector<SizeClasses::iterator> classes;
+            classes.reserve(shard->size());
+            for (auto it = shard->begin(); it != shard->end(); ++it) {
+                if (0 == pass && except && *except == it->first) {
+                    continue;
+                }
+                classes.push_back(it);
+            }
+            std::sort(classes.begin(), classes.end(), [](const auto& l, const auto& r) {
+                return l->second._lastRequest < r->second._lastRequest;
+            });
+            for (const auto& sizeClass : classes) {
+                auto& buffers = sizeClass->second._buffers;
+                for (auto it = buffers.begin(); it != buffers.end() && !fitLimits(maxNumberOfBuffers, maxMemoryUsage);) {
+                    if (hasOneRef(*it)) {
+                        it = buffers.erase(it);
+                        unreserve(1U, sizeClass->second._bufferSize);
+                        _evictions.fetch_add(1ULL);
+                        Metrics::instance()._framePoolEvictions.add();
+                    }
+                    else {
+                        ++it;
+                    }
+                }
+            }
+            for (auto it = shard->begin(); it != shard->end();) {
+                if (it->second._buffers.empty()) {
+                    it = shard->erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            if (fitLimits(maxNumberOfBuffers, maxMemoryUsage)) {
+                break;
+            }
+        }
+    }
+}
+
+bool VideoFrameBufferPoolSource::fitLimits(size_t maxNumberOfBuffers, size_t maxMemoryUsage) const
+{
+    return _buffersCount <= maxNumberOfBuffers && _memoryUsage <= maxMemoryUsage;
+}
+
+template <class TBuffer, typename... Args>
+VideoFrameBufferPoolSource::SizeClass VideoFrameBufferPoolSource::sizeClass(int width, int height,
+                                                                            Args&&... args)
+{
+    SizeClass key;
+    key._type = type<TBuffer>();
+    key._width = width;
+    key._height = height;
+    if constexpr (sizeof...(Args) > 0U) {
+        const auto params = std::forward_as_tuple(args...);
+        key._format = static_cast<int>(std::get<0U>(params));
+        if constexpr (sizeof...(Args) > 1U) {
+            key._stride = std::max<int>(0, std::get<1U>(params));
+        }
+    }
+    return key;
+}
+
+template <class TBuffer>
+size_t VideoFrameBufferPoolSource::memorySize(const webrtc::scoped_refptr<TBuffer>& buffer)
+{
+    if constexpr (std::is_base_of_v<webrtc::PlanarYuv8Buffer, TBuffer>) {
+        return planarSize(buffer->StrideY(), buffer->StrideU(), buffer->StrideV(),
+                          buffer->height(), buffer->ChromaHeight());
+    }
+    else if constexpr (std::is_base_of_v<webrtc::PlanarYuv16BBuffer, TBuffer>) {
+        return planarSize(buffer->StrideY(), buffer->StrideU(), buffer->StrideV(),
+                          buffer->height(), buffer->ChromaHeight(), sizeof(uint16_t));
+    }
+    else if constexpr (std::is_base_of_v<webrtc::BiplanarYuv8Buffer, TBuffer>) {
+        return size_t(buffer->StrideY()) * buffer->height() + size_t(buffer->StrideUV()) * buffer->ChromaHeight();
+    }
+    else {
+        size_t size = 0U;
+        for (size_t i = 0U, n = planesCount(buffer->nativeType()); i < n; ++i) {
+            size += buffer->dataSize(i);
+        }
+        return size;
+    }
+}
+
 bool VideoFrameBufferPoolSource::hasOneRef(const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer)
 {
     if (buffer) {
@@ -259,4 +434,21 @@ bool VideoFrameBufferPoolSource::hasOneRef(const webrtc::scoped_refptr<webrtc::V
     return false;
 }
 
+bool VideoFrameBufferPoolSource::SizeClass::operator == (const SizeClass& other) const
+{
+    return _type == other._type && _format == other._format &&
+        _width == other._width && _height == other._height && _stride == other._stride;
+}
+
+size_t VideoFrameBufferPoolSource::SizeClassHash::operator () (const SizeClass& sizeClass) const
+{
+    size_t seed = 0U;
+    hashCombine(seed, static_cast<int>(sizeClass._type));
+    hashCombine(seed, sizeClass._format);
+    hashCombine(seed, sizeClass._width);
+    hashCombine(seed, sizeClass._height);
+    hashCombine(seed, sizeClass._stride);
+    return seed;
+}
+
 } // namespace LiveKitCpp
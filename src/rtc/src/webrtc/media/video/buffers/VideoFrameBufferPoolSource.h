@@ -22,8 +22,10 @@
 #include <api/video/i422_buffer.h>
 #include <api/video/i444_buffer.h>
 #include <api/video/nv12_buffer.h>
+#include <array>
 #include <atomic>
-#include <list>
+#include <unordered_map>
+#include <vector>
 #include <stddef.h>
 
 namespace LiveKitCpp
@@ -32,22 +34,72 @@ namespace LiveKitCpp
 class RgbVideoFrameBuffer;
 enum class VideoFrameType;
 
-// concurrent & thread-safe version of webrtc::VideoFrameBufferPool
+// concurrent & thread-safe version of webrtc::VideoFrameBufferPool,
+// buffers are grouped into size classes (type, format, width, height & stride),
+// each class has own free list, classes are distributed between independent shards
+// for reducing of locks contention between different resolutions/formats;
+// the buffer is free when pool holds the only reference to it, so release is lock-free
 class VideoFrameBufferPoolSource : public std::enable_shared_from_this<VideoFrameBufferPoolSource>
 {
-    using BuffersList = std::list<webrtc::scoped_refptr<webrtc::VideoFrameBuffer>>;
+    struct SizeClass
+    {
+        webrtc::VideoFrameBuffer::Type _type = webrtc::VideoFrameBuffer::Type::kNative;
+        int _format = -1; // VideoFrameType for native buffers, -1 for others
+        int _width = 0;
+        int _height = 0;
+        int _stride = 0; // explicit stride for native buffers, 0 - default
+        bool operator == (const SizeClass& other) const;
+    };
+    struct SizeClassHash
+    {
+        size_t operator () (const SizeClass& sizeClass) const;
+    };
+    struct SizeClassBuffers
+    {
+        std::vector<webrtc::scoped_refptr<webrtc::VideoFrameBuffer>> _buffers;
+        // all buffers of the class have the same size, in bytes
+        size_t _bufferSize = 0U;
+        // value of [_requests] counter at the moment of last access
+        uint64_t _lastRequest = 0ULL;
+    };
+    using SizeClasses = std::unordered_map<SizeClass, SizeClassBuffers, SizeClassHash>;
+    using Shard = Bricks::SafeObj<SizeClasses>;
+public:
+    struct Stats
+    {
+        // number of requests satisfied by free buffers from the pool
+        uint64_t _hits = 0ULL;
+        // number of requests which required a new allocation
+        uint64_t _misses = 0ULL;
+        // number of idle buffers released for staying in memory limits
+        uint64_t _evictions = 0ULL;
+        // number of buffers owned by the pool (both free & in use)
+        size_t _buffersCount = 0U;
+        // total size of buffers owned by the pool, in bytes
+        size_t _memoryUsage = 0U;
+    };
 public:
     static std::shared_ptr<VideoFrameBufferPoolSource> create();
     static std::shared_ptr<VideoFrameBufferPoolSource> create(size_t maxNumberOfBuffers);
+    static std::shared_ptr<VideoFrameBufferPoolSource> create(size_t maxNumberOfBuffers,
+                                                              size_t maxMemoryUsage);
     ~VideoFrameBufferPoolSource() { release(); }
+    // 128 Mb, enough for ~40 I420 frames of 1080p
+    static constexpr size_t defaultMaxMemoryUsage() { return 128U * 1024U * 1024U; }
     VideoContentHint contentHint() const { return _contentHint; }
     void setContentHint(VideoContentHint hint) { _contentHint = hint; }
     // Changes the max amount of buffers in the pool to the new value.
     // Returns true if change was successful and false if the amount of already
     // allocated buffers is bigger than new value.
     bool resize(size_t maxNumberOfBuffers);
+    // Changes the upper limit for total size of pooled buffers (in bytes),
+    // idle buffers are evicted immediately if they exceed the new limit,
+    // new buffers beyond of the limit are not retained by the pool.
+    void setMaxMemoryUsage(size_t maxMemoryUsage);
+    size_t maxMemoryUsage() const { return _maxMemoryUsage; }
+    Stats stats() const;
     // Clears buffers
-    void release() { _buffers({}); }
+    void release();
     webrtc::scoped_refptr<webrtc::I420Buffer> createI420(int width, int height);
     webrtc::scoped_refptr<webrtc::I422Buffer> createI422(int width, int height);
     webrtc::scoped_refptr<webrtc::I444Buffer> createI444(int width, int height);
@@ -61,23 +113,39 @@ public:
 protected:
     VideoFrameBufferPoolSource();
     VideoFrameBufferPoolSource(size_t maxNumberOfBuffers);
+    VideoFrameBufferPoolSource(size_t maxNumberOfBuffers, size_t maxMemoryUsage);
 private:
-    template <typename... Args>
-    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> getExisting(int width, int height,
-                                                                webrtc::VideoFrameBuffer::Type type,
-                                                                Args&&... args);
+    Shard& shard(const SizeClass& sizeClass);
+    webrtc::scoped_refptr<webrtc::VideoFrameBuffer> getExisting(const SizeClass& sizeClass);
     template <class TBuffer, bool attachFramePool, typename... Args>
     webrtc::scoped_refptr<TBuffer> create(int width, int height, Args&&... args);
-    template <typename... Args>
-    static bool matched(const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer,
-                        int width, int height,
-                        webrtc::VideoFrameBuffer::Type type,
-                        Args&&... args);
+    // returns false if limits are exceeded even after eviction of idle buffers
+    bool reserve(const SizeClass& sizeClass, size_t bytes);
+    void unreserve(size_t buffers, size_t bytes);
+    // releases idle buffers (least recently used classes first) until both
+    // [maxNumberOfBuffers] & [maxMemoryUsage] limits are satisfied,
+    // buffers of [except] class are released only if nothing else is available
+    void evict(size_t maxNumberOfBuffers, size_t maxMemoryUsage, const SizeClass* except = nullptr);
+    bool fitLimits(size_t maxNumberOfBuffers, size_t maxMemoryUsage) const;
+    template <class TBuffer, typename... Args>
+    static SizeClass sizeClass(int width, int height, Args&&... args);
+    template <class TBuffer>
+    static size_t memorySize(const webrtc::scoped_refptr<TBuffer>& buffer);
     static bool hasOneRef(const webrtc::scoped_refptr<webrtc::VideoFrameBuffer>& buffer);
 private:
-    Bricks::SafeObj<BuffersList> _buffers;
-     // Max number of buffers this pool can have pending.
-    size_t _maxNumberOfBuffers;
+    static constexpr size_t _shardsCount = 8U;
+    std::array<Shard, _shardsCount> _shards;
+    // Max number of buffers this pool can have pending.
+    std::atomic<size_t> _maxNumberOfBuffers;
+    // Max total size of buffers in bytes.
+    std::atomic<size_t> _maxMemoryUsage;
+    std::atomic<size_t> _buffersCount = 0U;
+    std::atomic<size_t> _memoryUsage = 0U;
+    // monotonic counter of requests, used as LRU timestamp for size classes
+    std::atomic<uint64_t> _requests = 0ULL;
+    std::atomic<uint64_t> _hits = 0ULL;
+    std::atomic<uint64_t> _misses = 0ULL;
+    std::atomic<uint64_t> _evictions = 0ULL;
     std::atomic<VideoContentHint> _contentHint = VideoContentHint::None;
 };
 	
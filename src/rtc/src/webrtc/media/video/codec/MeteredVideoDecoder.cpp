@@ -0,0 +1,99 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "MeteredVideoDecoder.h"
+#include "Metrics.h"
+#include <modules/video_coding/include/video_error_codes.h>
+
+namespace LiveKitCpp
+{
+
+MeteredVideoDecoder::MeteredVideoDecoder(std::unique_ptr<webrtc::VideoDecoder> decoder)
+    : _decoder(std::move(decoder))
+    , _latency(Metrics::instance()._videoDecodeTime)
+{
+}
+
+MeteredVideoDecoder::~MeteredVideoDecoder()
+{
+    _decoder->RegisterDecodeCompleteCallback(nullptr);
+}
+
+bool MeteredVideoDecoder::Configure(const Settings& settings)
+{
+    return _decoder->Configure(settings);
+}
+
+int32_t MeteredVideoDecoder::Decode(const webrtc::EncodedImage& inputImage, int64_t renderTimeMs)
+{
+    _latency.input(inputImage.RtpTimestamp());
+    return _decoder->Decode(inputImage, renderTimeMs);
+}
+
+int32_t MeteredVideoDecoder::Decode(const webrtc::EncodedImage& inputImage,
+                                    bool missingFrames, int64_t renderTimeMs)
+{
+    _latency.input(inputImage.RtpTimestamp());
+    return _decoder->Decode(inputImage, missingFrames, renderTimeMs);
+}
+
+int32_t MeteredVideoDecoder::RegisterDecodeCompleteCallback(webrtc::DecodedImageCallback* callback)
+{
+    _callback = callback;
+    return _decoder->RegisterDecodeCompleteCallback(callback ? this : nullptr);
+}
+
+int32_t MeteredVideoDecoder::Release()
+{
+    return _decoder->Release();
+}
+
+webrtc::VideoDecoder::DecoderInfo MeteredVideoDecoder::GetDecoderInfo() const
+{
+    return _decoder->GetDecoderInfo();
+}
+
+const char* MeteredVideoDecoder::ImplementationName() const
+{
+    return _decoder->ImplementationName();
+}
+
+int32_t MeteredVideoDecoder::Decoded(webrtc::VideoFrame& decodedImage)
+{
+    _latency.output(decodedImage.rtp_timestamp());
+    if (const auto callback = _callback.load()) {
+        return callback->Decoded(decodedImage);
+    }
+    return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+}
+
+int32_t MeteredVideoDecoder::Decoded(webrtc::VideoFrame& decodedImage, int64_t decodeTimeMs)
+{
+    _latency.output(decodedImage.rtp_timestamp());
+    if (const auto callback = _callback.load()) {
+        return callback->Decoded(decodedImage, decodeTimeMs);
+    }
+    return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+}
+
+void MeteredVideoDecoder::Decoded(webrtc::VideoFrame& decodedImage,
+                                  std::optional<int32_t> decodeTimeMs,
+                                  std::optional<uint8_t> qp)
+{
+    _latency.output(decodedImage.rtp_timestamp());
+    if (const auto callback = _callback.load()) {
+        callback->Decoded(decodedImage, decodeTimeMs, qp);
+    }
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,49 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // MeteredVideoDecoder.h
+#include "MetricLatency.h"
+#include <api/video_codecs/video_decoder.h>
+#include <atomic>
+#include <memory>
+
+namespace LiveKitCpp
+{
+
+// transparent wrapper of decoder, measures time from input of encoded image till decoded frame
+class MeteredVideoDecoder : public webrtc::VideoDecoder, private webrtc::DecodedImageCallback
+{
+public:
+    MeteredVideoDecoder(std::unique_ptr<webrtc::VideoDecoder> decoder);
+    ~MeteredVideoDecoder() override;
+    // impl. of webrtc::VideoDecoder
+    bool Configure(const Settings& settings) final;
+    int32_t Decode(const webrtc::EncodedImage& inputImage, int64_t renderTimeMs) final;
+    int32_t Decode(const webrtc::EncodedImage& inputImage, bool missingFrames, int64_t renderTimeMs) final;
+    int32_t RegisterDecodeCompleteCallback(webrtc::DecodedImageCallback* callback) final;
+    int32_t Release() final;
+    DecoderInfo GetDecoderInfo() const final;
+    const char* ImplementationName() const final;
+private:
+    // impl. of webrtc::DecodedImageCallback
+    int32_t Decoded(webrtc::VideoFrame& decodedImage) final;
+    int32_t Decoded(webrtc::VideoFrame& decodedImage, int64_t decodeTimeMs) final;
+    void Decoded(webrtc::VideoFrame& decodedImage, std::optional<int32_t> decodeTimeMs,
+                 std::optional<uint8_t> qp) final;
+private:
+    const std::unique_ptr<webrtc::VideoDecoder> _decoder;
+    MetricLatency _latency;
+    std::atomic<webrtc::DecodedImageCallback*> _callback = nullptr;
+};
+
+} // namespace LiveKitCpp
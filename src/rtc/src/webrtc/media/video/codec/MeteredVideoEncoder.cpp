@@ -0,0 +1,102 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "MeteredVideoEncoder.h"
+#include "Metrics.h"
+
+namespace LiveKitCpp
+{
+
+MeteredVideoEncoder::MeteredVideoEncoder(std::unique_ptr<webrtc::VideoEncoder> encoder)
+    : _encoder(std::move(encoder))
+    , _latency(Metrics::instance()._videoEncodeTime)
+{
+}
+
+MeteredVideoEncoder::~MeteredVideoEncoder()
+{
+    _encoder->RegisterEncodeCompleteCallback(nullptr);
+}
+
+void MeteredVideoEncoder::SetFecControllerOverride(webrtc::FecControllerOverride* fecControllerOverride)
+{
+    _encoder->SetFecControllerOverride(fecControllerOverride);
+}
+
+int32_t MeteredVideoEncoder::InitEncode(const webrtc::VideoCodec* codecSettings, const Settings& encoderSettings)
+{
+    return _encoder->InitEncode(codecSettings, encoderSettings);
+}
+
+int32_t MeteredVideoEncoder::RegisterEncodeCompleteCallback(webrtc::EncodedImageCallback* callback)
+{
+    _callback = callback;
+    return _encoder->RegisterEncodeCompleteCallback(callback ? this : nullptr);
+}
+
+int32_t MeteredVideoEncoder::Release()
+{
+    return _encoder->Release();
+}
+
+int32_t MeteredVideoEncoder::Encode(const webrtc::VideoFrame& frame,
+                                    const std::vector<webrtc::VideoFrameType>* frameTypes)
+{
+    _latency.input(frame.rtp_timestamp());
+    return _encoder->Encode(frame, frameTypes);
+}
+
+void MeteredVideoEncoder::SetRates(const RateControlParameters& parameters)
+{
+    _encoder->SetRates(parameters);
+}
+
+void MeteredVideoEncoder::OnPacketLossRateUpdate(float packetLossRate)
+{
+    _encoder->OnPacketLossRateUpdate(packetLossRate);
+}
+
+void MeteredVideoEncoder::OnRttUpdate(int64_t rttMs)
+{
+    _encoder->OnRttUpdate(rttMs);
+}
+
+void MeteredVideoEncoder::OnLossNotification(const LossNotification& lossNotification)
+{
+    _encoder->OnLossNotification(lossNotification);
+}
+
+webrtc::VideoEncoder::EncoderInfo MeteredVideoEncoder::GetEncoderInfo() const
+{
+    return _encoder->GetEncoderInfo();
+}
+
+webrtc::EncodedImageCallback::Result MeteredVideoEncoder::
+    OnEncodedImage(const webrtc::EncodedImage& encodedImage,
+                   const webrtc::CodecSpecificInfo* codecSpecificInfo)
+{
+    _latency.output(encodedImage.RtpTimestamp());
+    if (const auto callback = _callback.load()) {
+        return callback->OnEncodedImage(encodedImage, codecSpecificInfo);
+    }
+    return Result(Result::ERROR_SEND_FAILED);
+}
+
+void MeteredVideoEncoder::OnDroppedFrame(DropReason reason)
+{
+    if (const auto callback = _callback.load()) {
+        callback->OnDroppedFrame(reason);
+    }
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,51 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // MeteredVideoEncoder.h
+#include "MetricLatency.h"
+#include <api/video_codecs/video_encoder.h>
+#include <atomic>
+#include <memory>
+
+namespace LiveKitCpp
+{
+
+// transparent wrapper of encoder, measures time from input of frame till encoded image
+class MeteredVideoEncoder : public webrtc::VideoEncoder, private webrtc::EncodedImageCallback
+{
+public:
+    MeteredVideoEncoder(std::unique_ptr<webrtc::VideoEncoder> encoder);
+    ~MeteredVideoEncoder() override;
+    // impl. of webrtc::VideoEncoder
+    void SetFecControllerOverride(webrtc::FecControllerOverride* fecControllerOverride) final;
+    int32_t InitEncode(const webrtc::VideoCodec* codecSettings, const Settings& encoderSettings) final;
+    int32_t RegisterEncodeCompleteCallback(webrtc::EncodedImageCallback* callback) final;
+    int32_t Release() final;
+    int32_t Encode(const webrtc::VideoFrame& frame, const std::vector<webrtc::VideoFrameType>* frameTypes) final;
+    void SetRates(const RateControlParameters& parameters) final;
+    void OnPacketLossRateUpdate(float packetLossRate) final;
+    void OnRttUpdate(int64_t rttMs) final;
+    void OnLossNotification(const LossNotification& lossNotification) final;
+    EncoderInfo GetEncoderInfo() const final;
+private:
+    // impl. of webrtc::EncodedImageCallback
+    Result OnEncodedImage(const webrtc::EncodedImage& encodedImage,
+                          const webrtc::CodecSpecificInfo* codecSpecificInfo) final;
+    void OnDroppedFrame(DropReason reason) final;
+private:
+    const std::unique_ptr<webrtc::VideoEncoder> _encoder;
+    MetricLatency _latency;
+    std::atomic<webrtc::EncodedImageCallback*> _callback = nullptr;
+};
+
+} // namespace LiveKitCpp
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "VideoDecoderFactory.h"
+#include "MeteredVideoDecoder.h"
 #include "VideoUtils.h"
 #include <api/video_codecs/video_decoder_factory_template.h>
 #include <api/video_codecs/video_decoder_factory_template_dav1d_adapter.h>  // nogncheck
@@ -53,7 +54,10 @@ std::unique_ptr<webrtc::VideoDecoder> VideoDecoderFactory::
         if (!decoder) {
             decoder = _defaultFallback->Create(env, format);
         }
-        if (!decoder) {
+        if (decoder) {
+            decoder = std::make_unique<MeteredVideoDecoder>(std::move(decoder));
+        }
+        else {
             RTC_LOG(LS_ERROR) << "Decoder for video format [" << originalFormat.value() << "] was not found";
         }
     }
@@ -12,12 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "VideoEncoderFactory.h"
+#include "MeteredVideoEncoder.h"
 #include "VideoUtils.h"
 #include <api/video_codecs/video_encoder_factory_template.h>
 #include <api/video_codecs/video_encoder_factory_template_libaom_av1_adapter.h>  // nogncheck
 #include <api/video_codecs/video_encoder_factory_template_libvpx_vp8_adapter.h>
 #include <api/video_codecs/video_encoder_factory_template_libvpx_vp9_adapter.h>
 #include <api/video_codecs/video_encoder_factory_template_open_h264_adapter.h>  // nogncheck
+#include <media/engine/simulcast_encoder_adapter.h>
 #include <rtc_base/logging.h>
 
 namespace {
@@ -31,9 +33,29 @@ using Factory = webrtc::VideoEncoderFactoryTemplate<webrtc::LibvpxVp8EncoderTemp
 namespace LiveKitCpp
 {
 
+// non-owning factory of single-layer encoders for webrtc::SimulcastEncoderAdapter
+class VideoEncoderFactory::LayerFactory : public webrtc::VideoEncoderFactory
+{
+public:
+    LayerFactory(const LiveKitCpp::VideoEncoderFactory* owner) : _owner(owner) {}
+    // impl. of webrtc::VideoEncoderFactory
+    std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const final { return _owner->GetSupportedFormats(); }
+    std::unique_ptr<webrtc::VideoEncoder> Create(const webrtc::Environment& env,
+                                                 const webrtc::SdpVideoFormat& format) final {
+        return _owner->createLayerEncoder(env, format);
+    }
+private:
+    const LiveKitCpp::VideoEncoderFactory* const _owner;
+};
+
 VideoEncoderFactory::VideoEncoderFactory(std::unique_ptr<webrtc::VideoEncoderFactory> platform)
     : _defaultFallback(std::make_unique<Factory>())
     , _platform(std::move(platform))
+    , _layerFactory(std::make_unique<LayerFactory>(this))
+{
+}
+
+VideoEncoderFactory::~VideoEncoderFactory()
 {
 }
 
@@ -44,6 +66,17 @@ std::vector<webrtc::SdpVideoFormat> VideoEncoderFactory::GetSupportedFormats() c
 
 std::unique_ptr<webrtc::VideoEncoder> VideoEncoderFactory::
     Create(const webrtc::Environment& env, const webrtc::SdpVideoFormat& format)
+{
+    if (const auto originalFormat = webrtc::FuzzyMatchSdpVideoFormat(GetSupportedFormats(), format)) {
+        return std::make_unique<webrtc::SimulcastEncoderAdapter>(env, _layerFactory.get(), nullptr,
+                                                                 originalFormat.value());
+    }
+    RTC_LOG(LS_ERROR) << "Requested video format [" << format << "] is not suitable for encoder factory";
+    return {};
+}
+
+std::unique_ptr<webrtc::VideoEncoder> VideoEncoderFactory::
+    createLayerEncoder(const webrtc::Environment& env, const webrtc::SdpVideoFormat& format) const
 {
     std::unique_ptr<webrtc::VideoEncoder> encoder;
     if (const auto originalFormat = webrtc::FuzzyMatchSdpVideoFormat(GetSupportedFormats(), format)) {
@@ -53,7 +86,10 @@ std::unique_ptr<webrtc::VideoEncoder> VideoEncoderFactory::
         if (!encoder) {
             encoder = _defaultFallback->Create(env, originalFormat.value());
         }
-        if (!encoder) {
+        if (encoder) {
+            encoder = std::make_unique<MeteredVideoEncoder>(std::move(encoder));
+        }
+        else {
             RTC_LOG(LS_ERROR) << "Encoder for video format [" << originalFormat.value() << "] was not found";
         }
     }
@@ -18,10 +18,14 @@
 namespace LiveKitCpp
 {
 
+// encoders are wrapped by simulcast adapter: single stream is passed to encoder as is,
+// simulcast streams are encoded by separate instances (platform & fallback encoders are single-stream)
 class VideoEncoderFactory : public webrtc::VideoEncoderFactory
 {
+    class LayerFactory;
 public:
     VideoEncoderFactory(std::unique_ptr<webrtc::VideoEncoderFactory> platform = {});
+    ~VideoEncoderFactory() override;
     // impl. of webrtc::VideoEncoderFactory
     std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const final;
     std::unique_ptr<webrtc::VideoEncoder> Create(const webrtc::Environment& env,
@@ -29,9 +33,14 @@ public:
     CodecSupport QueryCodecSupport(const webrtc::SdpVideoFormat& format,
                                    std::optional<std::string> scalabilityMode) const final;
     std::unique_ptr<EncoderSelectorInterface> GetEncoderSelector() const final;
+private:
+    // encoder for one simulcast layer, platform or fallback
+    std::unique_ptr<webrtc::VideoEncoder> createLayerEncoder(const webrtc::Environment& env,
+                                                             const webrtc::SdpVideoFormat& format) const;
 private:
     const std::unique_ptr<webrtc::VideoEncoderFactory> _defaultFallback;
     const std::unique_ptr<webrtc::VideoEncoderFactory> _platform;
+    const std::unique_ptr<LayerFactory> _layerFactory;
 };
 
 } // namespace LiveKitCpp
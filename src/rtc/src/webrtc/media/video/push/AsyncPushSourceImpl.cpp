@@ -0,0 +1,110 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AsyncPushSourceImpl.h"
+#include "VideoFrameImpl.h"
+#include <rtc_base/time_utils.h>
+#include <algorithm>
+
+namespace LiveKitCpp
+{
+
+AsyncPushSourceImpl::AsyncPushSourceImpl(std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
+                                         const std::shared_ptr<Bricks::Logger>& logger,
+                                         bool screencast)
+    : AsyncVideoSourceImpl(std::move(signalingQueue), logger,
+                           screencast ? VideoContentHint::Detailed : VideoContentHint::None,
+                           true)
+    , _screencast(screencast)
+    , _framesInFlight(std::make_shared<std::atomic<uint32_t>>(0U))
+{
+}
+
+bool AsyncPushSourceImpl::pushFrame(const std::shared_ptr<VideoFrame>& frame)
+{
+    // cheap checks before any conversion
+    if (frame && frameWanted() && _framesInFlight->load() < _maxFramesInFlight &&
+        !_delivering.exchange(true)) {
+        bool delivered = false;
+        if (const auto timestampUs = pacedTimestamp(frame->timestampUs())) {
+            if (auto rtcFrame = VideoFrameImpl::create(trackInFlight(frame), framesPool())) {
+                rtcFrame->set_timestamp_us(timestampUs);
+                OnFrame(rtcFrame.value());
+                delivered = true;
+            }
+            else if (canLogWarning()) {
+                logWarning("unsupported type of pushed video frame, dropped");
+            }
+        }
+        _delivering = false;
+        return delivered;
+    }
+    return false;
+}
+
+std::string_view AsyncPushSourceImpl::logCategory() const
+{
+    static const std::string_view category("push_video_source");
+    return category;
+}
+
+void AsyncPushSourceImpl::onOptionsChanged(const VideoOptions& options)
+{
+    AsyncVideoSourceImpl::onOptionsChanged(options);
+    if (options._maxFPS > 0) {
+        _frameIntervalUs = webrtc::kNumMicrosecsPerSec / options._maxFPS;
+    }
+    else {
+        _frameIntervalUs = 0LL;
+    }
+    _resetPacing = true;
+}
+
+void AsyncPushSourceImpl::onMuted()
+{
+    AsyncVideoSourceImpl::onMuted();
+    _resetPacing = true;
+}
+
+int64_t AsyncPushSourceImpl::pacedTimestamp(int64_t timestampUs)
+{
+    if (timestampUs <= 0LL) {
+        timestampUs = webrtc::TimeMicros();
+    }
+    if (_resetPacing.exchange(false)) {
+        _nextFrameUs = 0LL;
+    }
+    if (const auto intervalUs = _frameIntervalUs.load()) {
+        // small jitter of application clock is tolerated
+        if (timestampUs < _nextFrameUs - intervalUs / 8) {
+            return 0LL;
+        }
+        // schedule follows the ideal grid, but doesn't accumulate debt after pauses
+        _nextFrameUs = std::max(_nextFrameUs, timestampUs - intervalUs) + intervalUs;
+    }
+    // encoder requires strictly increasing timestamps
+    timestampUs = std::max(timestampUs, _lastTimestampUs + 1LL);
+    _lastTimestampUs = timestampUs;
+    return timestampUs;
+}
+
+std::shared_ptr<VideoFrame> AsyncPushSourceImpl::trackInFlight(const std::shared_ptr<VideoFrame>& frame) const
+{
+    // frames of SDK itself are unwrapped to their buffers and released at once, so they are not counted
+    _framesInFlight->fetch_add(1U);
+    return std::shared_ptr<VideoFrame>(frame.get(), [frame, framesInFlight = _framesInFlight](VideoFrame*) {
+        framesInFlight->fetch_sub(1U);
+    });
+}
+
+} // namespace LiveKitCpp
@@ -0,0 +1,61 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // AsyncPushSourceImpl.h
+#include "AsyncVideoSourceImpl.h"
+#include <atomic>
+#include <memory>
+
+namespace LiveKitCpp
+{
+
+class VideoFrame;
+
+class AsyncPushSourceImpl : public AsyncVideoSourceImpl
+{
+public:
+    AsyncPushSourceImpl(std::weak_ptr<webrtc::TaskQueueBase> signalingQueue,
+                        const std::shared_ptr<Bricks::Logger>& logger,
+                        bool screencast);
+    ~AsyncPushSourceImpl() final { close(); }
+    bool screencast() const noexcept { return _screencast; }
+    // thread-safe, returns false if frame was dropped
+    bool pushFrame(const std::shared_ptr<VideoFrame>& frame);
+protected:
+    // impl. of Bricks::LoggableS<>
+    std::string_view logCategory() const final;
+    // overrides of AsyncVideoSourceImpl
+    void onOptionsChanged(const VideoOptions& options) final;
+    void onMuted() final;
+private:
+    // returns zero if frame should be skipped, requires [_delivering]
+    int64_t pacedTimestamp(int64_t timestampUs);
+    // counted alias of [frame], buffers of delivered frame hold it until sinks & encoders release them
+    std::shared_ptr<VideoFrame> trackInFlight(const std::shared_ptr<VideoFrame>& frame) const;
+private:
+    // encoder queue & frame in encoding, plus renderers and a spare one
+    static constexpr uint32_t _maxFramesInFlight = 4U;
+    const bool _screencast;
+    // pushed frames which are still referenced downstream (queued or in encoding),
+    // frames are dropped if producer is faster than the encoder
+    const std::shared_ptr<std::atomic<uint32_t>> _framesInFlight;
+    // concurrent pushes are rejected, pacing state is not shared
+    std::atomic_bool _delivering = false;
+    std::atomic<int64_t> _frameIntervalUs = 0LL;
+    std::atomic_bool _resetPacing = false;
+    // guarded by [_delivering]
+    int64_t _lastTimestampUs = 0LL;
+    int64_t _nextFrameUs = 0LL;
+};
+
+} // namespace LiveKitCpp
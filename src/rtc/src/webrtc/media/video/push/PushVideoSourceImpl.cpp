@@ -0,0 +1,37 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "PushVideoSourceImpl.h"
+
+namespace LiveKitCpp
+{
+
+PushVideoSourceImpl::PushVideoSourceImpl(std::shared_ptr<AsyncPushSourceImpl> impl)
+    : _impl(std::move(impl))
+{
+}
+
+std::shared_ptr<AsyncPushSourceImpl> PushVideoSourceImpl::attach()
+{
+    if (_impl && !_attached.exchange(true)) {
+        return _impl;
+    }
+    return {};
+}
+
+bool PushVideoSourceImpl::pushFrame(const std::shared_ptr<VideoFrame>& frame)
+{
+    return _impl && _attached && _impl->pushFrame(frame);
+}
+
+} // namespace LiveKitCpp
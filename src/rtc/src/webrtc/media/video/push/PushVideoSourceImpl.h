@@ -0,0 +1,35 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // PushVideoSourceImpl.h
+#include "AsyncPushSourceImpl.h"
+#include "livekit/rtc/media/PushVideoSource.h"
+#include <atomic>
+
+namespace LiveKitCpp
+{
+
+class PushVideoSourceImpl : public PushVideoSource
+{
+public:
+    PushVideoSourceImpl(std::shared_ptr<AsyncPushSourceImpl> impl);
+    // only one device can be created for the source
+    std::shared_ptr<AsyncPushSourceImpl> attach();
+    // impl. of PushVideoSource
+    bool pushFrame(const std::shared_ptr<VideoFrame>& frame) final;
+private:
+    const std::shared_ptr<AsyncPushSourceImpl> _impl;
+    std::atomic_bool _attached = false;
+};
+
+} // namespace LiveKitCpp
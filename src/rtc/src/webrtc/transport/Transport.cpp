@@ -25,6 +25,7 @@
 #include "RoomUtils.h"
 #include "LocalVideoDeviceImpl.h"
 #include "Utils.h"
+#include "VideoUtils.h"
 #include <type_traits>
 
 namespace
@@ -168,8 +169,19 @@ void Transport::addTrack(std::shared_ptr<AudioDeviceImpl> device,
 
 void Transport::addTrack(std::shared_ptr<LocalVideoDeviceImpl> device,
                          EncryptionType encryption,
-                         const webrtc::RtpTransceiverInit& init)
-{
+                         const webrtc::RtpTransceiverInit& init,
+                         const std::vector<VideoSimulcastLayer>& simulcastLayers)
+{
+    if (device && !device->screencast() && simulcastLayers.size() > 1U) {
+        auto encodings = makeSimulcastEncodings(simulcastLayers);
+        // single RID is not a simulcast
+        if (encodings.size() > 1U) {
+            auto simulcastInit = init;
+            simulcastInit.send_encodings = std::move(encodings);
+            addTransceiver(std::move(device), encryption, simulcastInit);
+            return;
+        }
+    }
     addTransceiver(std::move(device), encryption, init);
 }
 
@@ -33,6 +33,8 @@ class Logger;
 namespace LiveKitCpp
 {
 
+struct VideoSimulcastLayer;
+
 class PeerConnectionFactory;
 class CreateSdpObserver;
 class SetLocalSdpObserver;
@@ -62,9 +64,11 @@ public:
     void addTrack(std::shared_ptr<AudioDeviceImpl> device,
                   EncryptionType encryption,
                   const webrtc::RtpTransceiverInit& init = {});
+    // camera track is published as simulcast if [simulcastLayers] contains 2 or more valid layers
     void addTrack(std::shared_ptr<LocalVideoDeviceImpl> device,
                   EncryptionType encryption,
-                  const webrtc::RtpTransceiverInit& init = {});
+                  const webrtc::RtpTransceiverInit& init = {},
+                  const std::vector<VideoSimulcastLayer>& simulcastLayers = {});
     bool removeTrack(const std::string& id);
     void addIceCandidate(std::unique_ptr<webrtc::IceCandidateInterface> candidate);
     // stats
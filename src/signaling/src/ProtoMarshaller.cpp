@@ -25,6 +25,11 @@ namespace  {
 template <typename T>
 inline std::string typeName() { return typeid(T).name(); }
 
+// steals the field of incoming message, [field] is a result of 'mutable_xxx()',
+// strings & repeated fields are moved out without copying
+template <typename T>
+inline T&& take(T* field) { return std::move(*field); }
+
 }
 
 #define LOG_ERROR(error) logError(error);
@@ -40,44 +45,42 @@ ProtoMarshaller::ProtoMarshaller(Bricks::Logger* logger)
 {
 }
 
-JoinResponse ProtoMarshaller::map(livekit::JoinResponse in) const
+JoinResponse ProtoMarshaller::map(livekit::JoinResponse&& in) const
 {
     JoinResponse out;
-    out._room = map(in.room());
-    out._participant = map(in.participant());
-    out._otherParticipants = rconv<ParticipantInfo, livekit::ParticipantInfo>(in.other_participants());
-    out._serverVersion = in.server_version();
-    out._iceServers = rconv<ICEServer, livekit::ICEServer>(in.ice_servers());
+    out._room = map(take(in.mutable_room()));
+    out._participant = map(take(in.mutable_participant()));
+    out._otherParticipants = rconv<ParticipantInfo, livekit::ParticipantInfo>(take(in.mutable_other_participants()));
+    out._serverVersion = take(in.mutable_server_version());
+    out._iceServers = rconv<ICEServer, livekit::ICEServer>(take(in.mutable_ice_servers()));
     out._subscriberPrimary = in.subscriber_primary();
-    out._alternativeUrl = in.alternative_url();
-    out._clientConfiguration = map(in.client_configuration());
-    out._serverRegion = in.server_region();
+    out._alternativeUrl = take(in.mutable_alternative_url());
+    out._clientConfiguration = map(take(in.mutable_client_configuration()));
+    out._serverRegion = take(in.mutable_server_region());
     out._pingTimeout = in.ping_timeout();
     out._pingInterval = in.ping_interval();
-    out._serverInfo = map(in.server_info());
-    out._sifTrailer = in.sif_trailer();
-    out._enabledPublishCodecs = rconv<Codec, livekit::Codec>(in.enabled_publish_codecs());
+    out._serverInfo = map(take(in.mutable_server_info()));
+    out._sifTrailer = take(in.mutable_sif_trailer());
+    out._enabledPublishCodecs = rconv<Codec, livekit::Codec>(take(in.mutable_enabled_publish_codecs()));
     out._fastPublish = in.fast_publish();
     return out;
 }
 
-SessionDescription ProtoMarshaller::map(livekit::SessionDescription in) const
+SessionDescription ProtoMarshaller::map(livekit::SessionDescription&& in) const
 {
     SessionDescription out;
-    out._type = in.type();
-    out._sdp = in.sdp();
+    out._type = take(in.mutable_type());
+    out._sdp = take(in.mutable_sdp());
     return out;
 }
 
-livekit::SessionDescription ProtoMarshaller::map(SessionDescription in) const
+void ProtoMarshaller::map(SessionDescription in, livekit::SessionDescription* out) const
 {
-    livekit::SessionDescription out;
-    out.set_type(std::move(in._type));
-    out.set_sdp(std::move(in._sdp));
-    return out;
+    out->set_type(std::move(in._type));
+    out->set_sdp(std::move(in._sdp));
 }
 
-TrickleRequest ProtoMarshaller::map(livekit::TrickleRequest in) const
+TrickleRequest ProtoMarshaller::map(livekit::TrickleRequest&& in) const
 {
     TrickleRequest out;
     const auto& candidateInit = in.candidateinit();
@@ -104,9 +107,8 @@ TrickleRequest ProtoMarshaller::map(livekit::TrickleRequest in) const
     return out;
 }
 
-livekit::TrickleRequest ProtoMarshaller::map(TrickleRequest in) const
+void ProtoMarshaller::map(TrickleRequest in, livekit::TrickleRequest* out) const
 {
-    livekit::TrickleRequest out;
     nlohmann::json candidateInit;
     candidateInit["candidate"] = std::move(in._candidate._sdp);
     candidateInit["sdpMid"] = std::move(in._candidate._sdpMid);
@@ -117,24 +119,23 @@ livekit::TrickleRequest ProtoMarshaller::map(TrickleRequest in) const
     else {
         candidateInit["usernameFragment"] = std::move(in._candidate._usernameFragment);
     }
-    out.set_candidateinit(nlohmann::to_string(candidateInit));
-    out.set_target(map(in._target));
-    out.set_final(in._final);
-    return out;
+    out->set_candidateinit(nlohmann::to_string(candidateInit));
+    out->set_target(map(in._target));
+    out->set_final(in._final);
 }
 
-ParticipantUpdate ProtoMarshaller::map(livekit::ParticipantUpdate in) const
+ParticipantUpdate ProtoMarshaller::map(livekit::ParticipantUpdate&& in) const
 {
     ParticipantUpdate out;
-    out._participants = rconv<ParticipantInfo, livekit::ParticipantInfo>(in.participants());
+    out._participants = rconv<ParticipantInfo, livekit::ParticipantInfo>(take(in.mutable_participants()));
     return out;
 }
 
-TrackPublishedResponse ProtoMarshaller::map(livekit::TrackPublishedResponse in) const
+TrackPublishedResponse ProtoMarshaller::map(livekit::TrackPublishedResponse&& in) const
 {
     TrackPublishedResponse out;
-    out._cid = in.cid();
-    out._track = map(in.track());
+    out._cid = take(in.mutable_cid());
+    out._track = map(take(in.mutable_track()));
     return out;
 }
 
@@ -146,197 +147,189 @@ livekit::TrackPublishedResponse ProtoMarshaller::map(TrackPublishedResponse in)
     return out;
 }
 
-TrackUnpublishedResponse ProtoMarshaller::map(livekit::TrackUnpublishedResponse in) const
+TrackUnpublishedResponse ProtoMarshaller::map(livekit::TrackUnpublishedResponse&& in) const
 {
     TrackUnpublishedResponse out;
-    out._trackSid = in.track_sid();
+    out._trackSid = take(in.mutable_track_sid());
     return out;
 }
 
-LeaveRequest ProtoMarshaller::map(livekit::LeaveRequest in) const
+LeaveRequest ProtoMarshaller::map(livekit::LeaveRequest&& in) const
 {
     LeaveRequest out;
     out._canReconnect = in.can_reconnect();
     out._reason = map(in.reason());
     out._action = map(in.action());
-    out._regions = map(in.regions());
+    out._regions = map(take(in.mutable_regions()));
     return out;
 }
 
-livekit::LeaveRequest ProtoMarshaller::map(LeaveRequest in) const
+void ProtoMarshaller::map(LeaveRequest in, livekit::LeaveRequest* out) const
 {
-    livekit::LeaveRequest out;
-    out.set_can_reconnect(in._canReconnect);
-    out.set_reason(map(in._reason));
-    out.set_action(map(in._action));
-    *out.mutable_regions() = map(std::move(in._regions));
-    return out;
+    out->set_can_reconnect(in._canReconnect);
+    out->set_reason(map(in._reason));
+    out->set_action(map(in._action));
+    *out->mutable_regions() = map(std::move(in._regions));
 }
 
-MuteTrackRequest ProtoMarshaller::map(livekit::MuteTrackRequest in) const
+MuteTrackRequest ProtoMarshaller::map(livekit::MuteTrackRequest&& in) const
 {
     MuteTrackRequest out;
-    out._sid = in.sid();
+    out._sid = take(in.mutable_sid());
     out._muted = in.muted();
     return out;
 }
 
-livekit::MuteTrackRequest ProtoMarshaller::map(MuteTrackRequest in) const
+void ProtoMarshaller::map(MuteTrackRequest in, livekit::MuteTrackRequest* out) const
 {
-    livekit::MuteTrackRequest out;
-    out.set_sid(std::move(in._sid));
-    out.set_muted(in._muted);
-    return out;
+    out->set_sid(std::move(in._sid));
+    out->set_muted(in._muted);
 }
 
-SpeakersChanged ProtoMarshaller::map(livekit::SpeakersChanged in) const
+SpeakersChanged ProtoMarshaller::map(livekit::SpeakersChanged&& in) const
 {
     SpeakersChanged out;
-    out._speakers = rconv<SpeakerInfo, livekit::SpeakerInfo>(in.speakers());
+    out._speakers = rconv<SpeakerInfo, livekit::SpeakerInfo>(take(in.mutable_speakers()));
     return out;
 }
 
-RoomUpdate ProtoMarshaller::map(livekit::RoomUpdate in) const
+RoomUpdate ProtoMarshaller::map(livekit::RoomUpdate&& in) const
 {
     RoomUpdate out;
     if (in.has_room()) {
-        out._room = map(in.room());
+        out._room = map(take(in.mutable_room()));
     }
     return out;
 }
 
-ConnectionQualityUpdate ProtoMarshaller::map(livekit::ConnectionQualityUpdate in) const
+ConnectionQualityUpdate ProtoMarshaller::map(livekit::ConnectionQualityUpdate&& in) const
 {
     ConnectionQualityUpdate out;
-    out._updates = rconv<ConnectionQualityInfo, livekit::ConnectionQualityInfo>(in.updates());
+    out._updates = rconv<ConnectionQualityInfo, livekit::ConnectionQualityInfo>(take(in.mutable_updates()));
     return out;
 }
 
-StreamStateUpdate ProtoMarshaller::map(livekit::StreamStateUpdate in) const
+StreamStateUpdate ProtoMarshaller::map(livekit::StreamStateUpdate&& in) const
 {
     StreamStateUpdate out;
-    out._streamStates = rconv<StreamStateInfo, livekit::StreamStateInfo>(in.stream_states());
+    out._streamStates = rconv<StreamStateInfo, livekit::StreamStateInfo>(take(in.mutable_stream_states()));
     return out;
 }
 
-SubscribedQualityUpdate ProtoMarshaller::map(livekit::SubscribedQualityUpdate in) const
+SubscribedQualityUpdate ProtoMarshaller::map(livekit::SubscribedQualityUpdate&& in) const
 {
     SubscribedQualityUpdate out;
-    out._trackSid = in.track_sid();
-    out._subscribedQualities = rconv<SubscribedQuality, livekit::SubscribedQuality>(in.subscribed_qualities());
-    out._subscribedCodecs = rconv<SubscribedCodec, livekit::SubscribedCodec>(in.subscribed_codecs());
+    out._trackSid = take(in.mutable_track_sid());
+    out._subscribedQualities = rconv<SubscribedQuality, livekit::SubscribedQuality>(take(in.mutable_subscribed_qualities()));
+    out._subscribedCodecs = rconv<SubscribedCodec, livekit::SubscribedCodec>(take(in.mutable_subscribed_codecs()));
     return out;
 }
 
-ReconnectResponse ProtoMarshaller::map(livekit::ReconnectResponse in) const
+ReconnectResponse ProtoMarshaller::map(livekit::ReconnectResponse&& in) const
 {
     ReconnectResponse out;
-    out._iceServers = rconv<ICEServer, livekit::ICEServer>(in.ice_servers());
+    out._iceServers = rconv<ICEServer, livekit::ICEServer>(take(in.mutable_ice_servers()));
     if (in.has_client_configuration()) {
-        out._clientConfiguration = map(in.client_configuration());
+        out._clientConfiguration = map(take(in.mutable_client_configuration()));
     }
     return out;
 }
 
-TrackSubscribed ProtoMarshaller::map(livekit::TrackSubscribed in) const
+TrackSubscribed ProtoMarshaller::map(livekit::TrackSubscribed&& in) const
 {
     TrackSubscribed out;
-    out._trackSid = in.track_sid();
+    out._trackSid = take(in.mutable_track_sid());
     return out;
 }
 
-RequestResponse ProtoMarshaller::map(livekit::RequestResponse in) const
+RequestResponse ProtoMarshaller::map(livekit::RequestResponse&& in) const
 {
     RequestResponse out;
     out._requestId = in.request_id();
     out._reason = map(in.reason());
-    out._message = in.message();
+    out._message = take(in.mutable_message());
     return out;
 }
 
-SubscriptionResponse ProtoMarshaller::map(livekit::SubscriptionResponse in) const
+SubscriptionResponse ProtoMarshaller::map(livekit::SubscriptionResponse&& in) const
 {
     SubscriptionResponse out;
-    out._trackSid = in.track_sid();
+    out._trackSid = take(in.mutable_track_sid());
     out._err = map(in.err());
     return out;
 }
 
-SubscriptionPermissionUpdate ProtoMarshaller::map(livekit::SubscriptionPermissionUpdate in) const
+SubscriptionPermissionUpdate ProtoMarshaller::map(livekit::SubscriptionPermissionUpdate&& in) const
 {
     SubscriptionPermissionUpdate out;
-    out._participantSid = in.participant_sid();
-    out._trackSid = in.track_sid();
+    out._participantSid = take(in.mutable_participant_sid());
+    out._trackSid = take(in.mutable_track_sid());
     out._allowed = in.allowed();
     return out;
 }
 
-AddTrackRequest ProtoMarshaller::map(livekit::AddTrackRequest in) const
+AddTrackRequest ProtoMarshaller::map(livekit::AddTrackRequest&& in) const
 {
     AddTrackRequest out;
-    out._cid = in.cid();
-    out._name = in.name();
+    out._cid = take(in.mutable_cid());
+    out._name = take(in.mutable_name());
     out._type = map(in.type());
     out._width = in.width();
     out._height = in.height();
     out._muted = in.muted();
     out._disableDtx = in.disable_dtx();
     out._source = map(in.source());
-    out._layers = rconv<VideoLayer, livekit::VideoLayer>(in.layers());
-    out._simulcastCodecs = rconv<SimulcastCodec, livekit::SimulcastCodec>(in.simulcast_codecs());
-    out._sid = in.sid();
+    out._layers = rconv<VideoLayer, livekit::VideoLayer>(take(in.mutable_layers()));
+    out._simulcastCodecs = rconv<SimulcastCodec, livekit::SimulcastCodec>(take(in.mutable_simulcast_codecs()));
+    out._sid = take(in.mutable_sid());
     out._stereo = in.stereo();
     out._disableRed = in.disable_red();
     out._encryption = map(in.encryption());
-    out._stream = in.stream();
+    out._stream = take(in.mutable_stream());
     out._backupCodecPolicy = map(in.backup_codec_policy());
     return out;
 }
 
-livekit::AddTrackRequest ProtoMarshaller::map(AddTrackRequest in) const
+void ProtoMarshaller::map(AddTrackRequest in, livekit::AddTrackRequest* out) const
 {
-    livekit::AddTrackRequest out;
-    out.set_cid(std::move(in._cid));
-    out.set_name(std::move(in._name));
-    out.set_type(map(in._type));
-    out.set_width(in._width);
-    out.set_height(in._height);
-    out.set_muted(in._muted);
-    out.set_disable_dtx(in._disableDtx);
-    out.set_source(map(in._source));
-    rconv(std::move(in._layers), out.mutable_layers());
-    rconv(std::move(in._simulcastCodecs), out.mutable_simulcast_codecs());
-    out.set_sid(std::move(in._sid));
-    out.set_stereo(in._stereo);
-    out.set_disable_red(in._disableRed);
-    out.set_encryption(map(in._encryption));
-    out.set_stream(std::move(in._stream));
-    out.set_backup_codec_policy(map(in._backupCodecPolicy));
-    return out;
+    out->set_cid(std::move(in._cid));
+    out->set_name(std::move(in._name));
+    out->set_type(map(in._type));
+    out->set_width(in._width);
+    out->set_height(in._height);
+    out->set_muted(in._muted);
+    out->set_disable_dtx(in._disableDtx);
+    out->set_source(map(in._source));
+    rconv(std::move(in._layers), out->mutable_layers());
+    rconv(std::move(in._simulcastCodecs), out->mutable_simulcast_codecs());
+    out->set_sid(std::move(in._sid));
+    out->set_stereo(in._stereo);
+    out->set_disable_red(in._disableRed);
+    out->set_encryption(map(in._encryption));
+    out->set_stream(std::move(in._stream));
+    out->set_backup_codec_policy(map(in._backupCodecPolicy));
 }
 
-UpdateSubscription ProtoMarshaller::map(livekit::UpdateSubscription in) const
+UpdateSubscription ProtoMarshaller::map(livekit::UpdateSubscription&& in) const
 {
     UpdateSubscription out;
-    out._trackSids = rconv<std::string>(in.track_sids());
+    out._trackSids = rconv<std::string>(take(in.mutable_track_sids()));
     out._subscribe = in.subscribe();
-    out._participantTracks = rconv<ParticipantTracks, livekit::ParticipantTracks>(in.participant_tracks());
+    out._participantTracks = rconv<ParticipantTracks, livekit::ParticipantTracks>(take(in.mutable_participant_tracks()));
     return out;
 }
 
-livekit::UpdateSubscription ProtoMarshaller::map(UpdateSubscription in) const
+void ProtoMarshaller::map(UpdateSubscription in, livekit::UpdateSubscription* out) const
 {
-    livekit::UpdateSubscription out;
-    rconv(std::move(in._trackSids), out.mutable_track_sids());
-    out.set_subscribe(in._subscribe);
-    rconv(std::move(in._participantTracks), out.mutable_participant_tracks());
-    return out;
+    rconv(std::move(in._trackSids), out->mutable_track_sids());
+    out->set_subscribe(in._subscribe);
+    rconv(std::move(in._participantTracks), out->mutable_participant_tracks());
 }
 
-UpdateTrackSettings ProtoMarshaller::map(livekit::UpdateTrackSettings in) const
+UpdateTrackSettings ProtoMarshaller::map(livekit::UpdateTrackSettings&& in) const
 {
     UpdateTrackSettings out;
-    out._trackSids = rconv<std::string>(in.track_sids());
+    out._trackSids = rconv<std::string>(take(in.mutable_track_sids()));
     out._disabled = in.disabled();
     out._quality = map(in.quality());
     out._width = in.width();
@@ -346,76 +339,68 @@ UpdateTrackSettings ProtoMarshaller::map(livekit::UpdateTrackSettings in) const
     return out;
 }
 
-livekit::UpdateTrackSettings ProtoMarshaller::map(UpdateTrackSettings in) const
+void ProtoMarshaller::map(UpdateTrackSettings in, livekit::UpdateTrackSettings* out) const
 {
-    livekit::UpdateTrackSettings out;
-    rconv(std::move(in._trackSids), out.mutable_track_sids());
-    out.set_disabled(in._disabled);
-    out.set_quality(map(in._quality));
-    out.set_width(in._width);
-    out.set_height(in._height);
-    out.set_fps(in._fps);
-    out.set_priority(in._priority);
-    return out;
+    rconv(std::move(in._trackSids), out->mutable_track_sids());
+    out->set_disabled(in._disabled);
+    out->set_quality(map(in._quality));
+    out->set_width(in._width);
+    out->set_height(in._height);
+    out->set_fps(in._fps);
+    out->set_priority(in._priority);
 }
 
-UpdateVideoLayers ProtoMarshaller::map(livekit::UpdateVideoLayers in) const
+UpdateVideoLayers ProtoMarshaller::map(livekit::UpdateVideoLayers&& in) const
 {
     UpdateVideoLayers out;
-    out._trackSid = in.track_sid();
-    out._layers = rconv<VideoLayer, livekit::VideoLayer>(in.layers());
+    out._trackSid = take(in.mutable_track_sid());
+    out._layers = rconv<VideoLayer, livekit::VideoLayer>(take(in.mutable_layers()));
     return out;
 }
 
-livekit::UpdateVideoLayers ProtoMarshaller::map(UpdateVideoLayers in) const
+void ProtoMarshaller::map(UpdateVideoLayers in, livekit::UpdateVideoLayers* out) const
 {
-    livekit::UpdateVideoLayers out;
-    out.set_track_sid(in._trackSid);
-    rconv(in._layers, out.mutable_layers());
-    return out;
+    out->set_track_sid(std::move(in._trackSid));
+    rconv(std::move(in._layers), out->mutable_layers());
 }
 
-SubscriptionPermission ProtoMarshaller::map(livekit::SubscriptionPermission in) const
+SubscriptionPermission ProtoMarshaller::map(livekit::SubscriptionPermission&& in) const
 {
     SubscriptionPermission out;
     out._allParticipants = in.all_participants();
-    out._trackPermissions = rconv<TrackPermission, livekit::TrackPermission>(in.track_permissions());
+    out._trackPermissions = rconv<TrackPermission, livekit::TrackPermission>(take(in.mutable_track_permissions()));
     return out;
 }
 
-livekit::SubscriptionPermission ProtoMarshaller::map(SubscriptionPermission in) const
+void ProtoMarshaller::map(SubscriptionPermission in, livekit::SubscriptionPermission* out) const
 {
-    livekit::SubscriptionPermission out;
-    out.set_all_participants(std::move(in._allParticipants));
-    rconv(std::move(in._trackPermissions), out.mutable_track_permissions());
-    return out;
+    out->set_all_participants(std::move(in._allParticipants));
+    rconv(std::move(in._trackPermissions), out->mutable_track_permissions());
 }
 
-SyncState ProtoMarshaller::map(livekit::SyncState in) const
+SyncState ProtoMarshaller::map(livekit::SyncState&& in) const
 {
     SyncState out;
-    out._answer = map(in.answer());
-    out._subscription = map(in.subscription());
-    out._publishTracks = rconv<TrackPublishedResponse, livekit::TrackPublishedResponse>(in.publish_tracks());
-    out._dataChannels = rconv<DataChannelInfo, livekit::DataChannelInfo>(in.data_channels());
-    out._offer = map(in.offer());
-    out._trackSidsDisabled = rconv<std::string>(in.track_sids_disabled());
+    out._answer = map(take(in.mutable_answer()));
+    out._subscription = map(take(in.mutable_subscription()));
+    out._publishTracks = rconv<TrackPublishedResponse, livekit::TrackPublishedResponse>(take(in.mutable_publish_tracks()));
+    out._dataChannels = rconv<DataChannelInfo, livekit::DataChannelInfo>(take(in.mutable_data_channels()));
+    out._offer = map(take(in.mutable_offer()));
+    out._trackSidsDisabled = rconv<std::string>(take(in.mutable_track_sids_disabled()));
     return out;
 }
 
-livekit::SyncState ProtoMarshaller::map(SyncState in) const
+void ProtoMarshaller::map(SyncState in, livekit::SyncState* out) const
 {
-    livekit::SyncState out;
-    *out.mutable_answer() = map(std::move(in._answer));
-    *out.mutable_subscription() = map(std::move(in._subscription));
-    rconv(std::move(in._publishTracks), out.mutable_publish_tracks());
-    rconv(std::move(in._dataChannels), out.mutable_data_channels());
-    *out.mutable_offer() = map(std::move(in._offer));
-    rconv(std::move(in._trackSidsDisabled), out.mutable_track_sids_disabled());
-    return out;
+    map(std::move(in._answer), out->mutable_answer());
+    map(std::move(in._subscription), out->mutable_subscription());
+    rconv(std::move(in._publishTracks), out->mutable_publish_tracks());
+    rconv(std::move(in._dataChannels), out->mutable_data_channels());
+    map(std::move(in._offer), out->mutable_offer());
+    rconv(std::move(in._trackSidsDisabled), out->mutable_track_sids_disabled());
 }
 
-SimulateScenario ProtoMarshaller::map(livekit::SimulateScenario in) const
+SimulateScenario ProtoMarshaller::map(livekit::SimulateScenario&& in) const
 {
     SimulateScenario out;
     switch (in.scenario_case()) {
@@ -464,67 +449,63 @@ SimulateScenario ProtoMarshaller::map(livekit::SimulateScenario in) const
     return out;
 }
 
-livekit::SimulateScenario ProtoMarshaller::map(SimulateScenario in) const
+void ProtoMarshaller::map(SimulateScenario in, livekit::SimulateScenario* out) const
 {
-    livekit::SimulateScenario out;
     switch (in._case) {
         case SimulateScenario::Case::NotSet:
             break;
         case SimulateScenario::Case::SpeakerUpdate:
-            out.set_speaker_update(in._scenario._speakerUpdate);
+            out->set_speaker_update(in._scenario._speakerUpdate);
             break;
         case SimulateScenario::Case::NodeFailure:
-            out.set_node_failure(in._scenario._nodeFailure);
+            out->set_node_failure(in._scenario._nodeFailure);
             break;
         case SimulateScenario::Case::Migration:
-            out.set_migration(in._scenario._migration);
+            out->set_migration(in._scenario._migration);
             break;
         case SimulateScenario::Case::ServerLeave:
-            out.set_server_leave(in._scenario._serverLeave);
+            out->set_server_leave(in._scenario._serverLeave);
             break;
         case SimulateScenario::Case::SwitchCandidateProtocol:
-            out.set_switch_candidate_protocol(map(in._scenario._switchCandidateProtocol));
+            out->set_switch_candidate_protocol(map(in._scenario._switchCandidateProtocol));
             break;
         case SimulateScenario::Case::SubscriberBandwidth:
-            out.set_subscriber_bandwidth(in._scenario._subscriberBandwidth);
+            out->set_subscriber_bandwidth(in._scenario._subscriberBandwidth);
             break;
         case SimulateScenario::Case::DisconnectSignalOnResume:
-            out.set_disconnect_signal_on_resume(in._scenario._disconnectSignalOnResume);
+            out->set_disconnect_signal_on_resume(in._scenario._disconnectSignalOnResume);
             break;
         case SimulateScenario::Case::DisconnectSignalOnResumeNoMessages:
-            out.set_disconnect_signal_on_resume_no_messages(in._scenario._disconnectSignalOnResumeNoMessages);
+            out->set_disconnect_signal_on_resume_no_messages(in._scenario._disconnectSignalOnResumeNoMessages);
             break;
         case SimulateScenario::Case::LeaveRequestFullReconnect:
-            out.set_leave_request_full_reconnect(in._scenario._leaveRequestFullReconnect);
+            out->set_leave_request_full_reconnect(in._scenario._leaveRequestFullReconnect);
             break;
         default:
             TYPE_CONVERSION_ERROR(SimulateScenario, livekit::SimulateScenario)
             break;
     }
-    return out;
 }
 
-UpdateParticipantMetadata ProtoMarshaller::map(livekit::UpdateParticipantMetadata in) const
+UpdateParticipantMetadata ProtoMarshaller::map(livekit::UpdateParticipantMetadata&& in) const
 {
     UpdateParticipantMetadata out;
-    out._metadata = in.metadata();
-    out._name = in.name();
-    out._attributes = mconv(in.attributes());
+    out._metadata = take(in.mutable_metadata());
+    out._name = take(in.mutable_name());
+    out._attributes = mconv(take(in.mutable_attributes()));
     out._requestId = in.request_id();
     return out;
 }
 
-livekit::UpdateParticipantMetadata ProtoMarshaller::map(UpdateParticipantMetadata in) const
+void ProtoMarshaller::map(UpdateParticipantMetadata in, livekit::UpdateParticipantMetadata* out) const
 {
-    livekit::UpdateParticipantMetadata out;
-    out.set_metadata(std::move(in._metadata));
-    out.set_name(std::move(in._name));
-    mconv(std::move(in._attributes), out.mutable_attributes());
-    out.set_request_id(in._requestId);
-    return out;
+    out->set_metadata(std::move(in._metadata));
+    out->set_name(std::move(in._name));
+    mconv(std::move(in._attributes), out->mutable_attributes());
+    out->set_request_id(in._requestId);
 }
 
-Ping ProtoMarshaller::map(livekit::Ping in) const
+Ping ProtoMarshaller::map(livekit::Ping&& in) const
 {
     Ping out;
     out._timestamp = in.timestamp();
@@ -532,15 +513,13 @@ Ping ProtoMarshaller::map(livekit::Ping in) const
     return out;
 }
 
-livekit::Ping ProtoMarshaller::map(Ping in) const
+void ProtoMarshaller::map(Ping in, livekit::Ping* out) const
 {
-    livekit::Ping out;
-    out.set_timestamp(in._timestamp);
-    out.set_rtt(in._rtt);
-    return out;
+    out->set_timestamp(in._timestamp);
+    out->set_rtt(in._rtt);
 }
 
-Pong ProtoMarshaller::map(livekit::Pong in) const
+Pong ProtoMarshaller::map(livekit::Pong&& in) const
 {
     Pong out;
     out._lastPingTimestamp = in.last_ping_timestamp();
@@ -556,54 +535,50 @@ livekit::Pong ProtoMarshaller::map(Pong in) const
     return out;
 }
 
-UpdateLocalAudioTrack ProtoMarshaller::map(livekit::UpdateLocalAudioTrack in) const
+UpdateLocalAudioTrack ProtoMarshaller::map(livekit::UpdateLocalAudioTrack&& in) const
 {
     UpdateLocalAudioTrack out;
-    out._trackSid = in.track_sid();
-    out._features = rconv<AudioTrackFeature, livekit::AudioTrackFeature>(in.features());
+    out._trackSid = take(in.mutable_track_sid());
+    out._features = rconv<AudioTrackFeature, livekit::AudioTrackFeature>(take(in.mutable_features()));
     return out;
 }
 
-livekit::UpdateLocalAudioTrack ProtoMarshaller::map(UpdateLocalAudioTrack in) const
+void ProtoMarshaller::map(UpdateLocalAudioTrack in, livekit::UpdateLocalAudioTrack* out) const
 {
-    livekit::UpdateLocalAudioTrack out;
-    out.set_track_sid(std::move(in._trackSid));
-    rconv(std::move(in._features), out.mutable_features());
-    return out;
+    out->set_track_sid(std::move(in._trackSid));
+    rconv(std::move(in._features), out->mutable_features());
 }
 
-UpdateLocalVideoTrack ProtoMarshaller::map(livekit::UpdateLocalVideoTrack in) const
+UpdateLocalVideoTrack ProtoMarshaller::map(livekit::UpdateLocalVideoTrack&& in) const
 {
     UpdateLocalVideoTrack out;
-    out._trackSid = in.track_sid();
+    out._trackSid = take(in.mutable_track_sid());
     out._width = in.width();
     out._height = in.height();
     return out;
 }
 
-livekit::UpdateLocalVideoTrack ProtoMarshaller::map(UpdateLocalVideoTrack in) const
+void ProtoMarshaller::map(UpdateLocalVideoTrack in, livekit::UpdateLocalVideoTrack* out) const
 {
-    livekit::UpdateLocalVideoTrack out;
-    out.set_track_sid(std::move(in._trackSid));
-    out.set_width(in._width);
-    out.set_height(in._height);
-    return out;
+    out->set_track_sid(std::move(in._trackSid));
+    out->set_width(in._width);
+    out->set_height(in._height);
 }
 
-ClientInfo ProtoMarshaller::map(livekit::ClientInfo in) const
+ClientInfo ProtoMarshaller::map(livekit::ClientInfo&& in) const
 {
     ClientInfo out;
     out._sdk = map(in.sdk());
-    out._version = in.version();
+    out._version = take(in.mutable_version());
     out._protocol = in.protocol();
-    out._os = in.os();
-    out._osVersion = in.os_version();
-    out._deviceModel = in.device_model();
-    out._browser = in.browser();
-    out._browserVersion = in.browser_version();
-    out._address = in.address();
-    out._network = in.network();
-    out._otherSdks = in.other_sdks();
+    out._os = take(in.mutable_os());
+    out._osVersion = take(in.mutable_os_version());
+    out._deviceModel = take(in.mutable_device_model());
+    out._browser = take(in.mutable_browser());
+    out._browserVersion = take(in.mutable_browser_version());
+    out._address = take(in.mutable_address());
+    out._network = take(in.mutable_network());
+    out._otherSdks = take(in.mutable_other_sdks());
     return out;
 }
 
@@ -624,34 +599,34 @@ livekit::ClientInfo ProtoMarshaller::map(ClientInfo in) const
     return out;
 }
 
-RoomInfo ProtoMarshaller::map(livekit::Room in) const
+RoomInfo ProtoMarshaller::map(livekit::Room&& in) const
 {
     RoomInfo out;
-    out._sid = in.sid();
-    out._name = in.name();
+    out._sid = take(in.mutable_sid());
+    out._name = take(in.mutable_name());
     out._emptyTimeout = in.empty_timeout();
     out._departureTimeout = in.departure_timeout();
     out._maxParticipants = in.max_participants();
     out._creationTime = in.creation_time();
     out._creationTimeMs = in.creation_time_ms();
-    out._turnPassword = in.turn_password();
-    out._enabledCodecs = rconv<Codec, livekit::Codec>(in.enabled_codecs());
-    out._metadata = in.metadata();
+    out._turnPassword = take(in.mutable_turn_password());
+    out._enabledCodecs = rconv<Codec, livekit::Codec>(take(in.mutable_enabled_codecs()));
+    out._metadata = take(in.mutable_metadata());
     out._numParticipants = in.num_participants();
     out._numPublishers = in.num_publishers();
     out._activeRecording = in.active_recording();
     if (in.has_version()) {
-        out._version = map(in.version());
+        out._version = map(take(in.mutable_version()));
     }
     return out;
 }
 
-Codec ProtoMarshaller::map(livekit::Codec in) const
+Codec ProtoMarshaller::map(livekit::Codec&& in) const
 {
-    return {in.mime(), in.fmtp_line()};
+    return {take(in.mutable_mime()), take(in.mutable_fmtp_line())};
 }
 
-TimedVersion ProtoMarshaller::map(livekit::TimedVersion in) const
+TimedVersion ProtoMarshaller::map(livekit::TimedVersion&& in) const
 {
     return {in.unix_micro(), in.ticks()};
 }
@@ -664,25 +639,25 @@ livekit::TimedVersion ProtoMarshaller::map(TimedVersion in) const
     return out;
 }
 
-ParticipantInfo ProtoMarshaller::map(livekit::ParticipantInfo in) const
+ParticipantInfo ProtoMarshaller::map(livekit::ParticipantInfo&& in) const
 {
     ParticipantInfo out;
-    out._sid = in.sid();
-    out._identity = in.identity();
+    out._sid = take(in.mutable_sid());
+    out._identity = take(in.mutable_identity());
     out._state = map(in.state());
-    out._tracks = rconv<TrackInfo, livekit::TrackInfo>(in.tracks());
-    out._metadata = in.metadata();
+    out._tracks = rconv<TrackInfo, livekit::TrackInfo>(take(in.mutable_tracks()));
+    out._metadata = take(in.mutable_metadata());
     out._joinedAt = in.joined_at();
     out.joinedAtMs = in.joined_at_ms();
-    out._name = in.name();
+    out._name = take(in.mutable_name());
     out._version = in.version();
     if (in.has_permission()) {
-        out._permission = map(in.permission());
+        out._permission = map(take(in.mutable_permission()));
     }
-    out._region = in.region();
+    out._region = take(in.mutable_region());
     out._isPublisher = in.is_publisher();
     out._kind = map(in.kind());
-    out._attributes = mconv(in.attributes());
+    out._attributes = mconv(take(in.mutable_attributes()));
     out._disconnectReason = map(in.disconnect_reason());
     return out;
 }
@@ -725,13 +700,13 @@ ParticipantState ProtoMarshaller::map(livekit::ParticipantInfo_State in) const
     return ParticipantState::Disconnected;
 }
 
-ParticipantPermission ProtoMarshaller::map(livekit::ParticipantPermission in) const
+ParticipantPermission ProtoMarshaller::map(livekit::ParticipantPermission&& in) const
 {
     ParticipantPermission out;
     out._canSubscribe = in.can_subscribe();
     out._canPublish = in.can_publish();
     out._canPublish_data = in.can_publish_data();
-    out._canPublishSources = rconv<TrackSource, livekit::TrackSource>(in.can_publish_sources());
+    out._canPublishSources = rconv<TrackSource, livekit::TrackSource>(take(in.mutable_can_publish_sources()));
     out._hidden = in.hidden();
     out._recorder = in.recorder();
     out._canUpdateMetadata = in.can_update_metadata();
@@ -860,30 +835,30 @@ livekit::TrackSource ProtoMarshaller::map(TrackSource in) const
     return livekit::UNKNOWN;
 }
 
-TrackInfo ProtoMarshaller::map(livekit::TrackInfo in) const
+TrackInfo ProtoMarshaller::map(livekit::TrackInfo&& in) const
 {
     TrackInfo out;
-    out._sid = in.sid();
+    out._sid = take(in.mutable_sid());
     out._type = map(in.type());
-    out._name = in.name();
+    out._name = take(in.mutable_name());
     out._muted = in.muted();
     out._width = in.width();
     out._height = in.height();
     out._simulcast = in.simulcast();
     out._disableDtx = in.disable_dtx();
     out._source = map(in.source());
-    out._layers = rconv<VideoLayer, livekit::VideoLayer>(in.layers());
-    out._mimeType = in.mime_type();
-    out._mid = in.mid();
-    out._codecs = rconv<SimulcastCodecInfo, livekit::SimulcastCodecInfo>(in.codecs());
+    out._layers = rconv<VideoLayer, livekit::VideoLayer>(take(in.mutable_layers()));
+    out._mimeType = take(in.mutable_mime_type());
+    out._mid = take(in.mutable_mid());
+    out._codecs = rconv<SimulcastCodecInfo, livekit::SimulcastCodecInfo>(take(in.mutable_codecs()));
     out._stereo = in.stereo();
     out._disableRed = in.disable_red();
     out._encryption = map(in.encryption());
-    out._stream = in.stream();
+    out._stream = take(in.mutable_stream());
     if (in.has_version()) {
-        out._version = map(in.version());
+        out._version = map(take(in.mutable_version()));
     }
-    out._audioFeatures = rconv<AudioTrackFeature, livekit::AudioTrackFeature>(in.audio_features());
+    out._audioFeatures = rconv<AudioTrackFeature, livekit::AudioTrackFeature>(take(in.mutable_audio_features()));
     out._backupCodecPolicy = map(in.backup_codec_policy());
     return out;
 }
@@ -951,7 +926,7 @@ livekit::VideoQuality ProtoMarshaller::map(VideoQuality in) const
     return livekit::LOW;
 }
 
-VideoLayer ProtoMarshaller::map(livekit::VideoLayer in) const
+VideoLayer ProtoMarshaller::map(livekit::VideoLayer&& in) const
 {
     VideoLayer out;
     out._quality = map(in.quality());
@@ -1005,13 +980,13 @@ livekit::TrackType ProtoMarshaller::map(TrackType in) const
     return livekit::AUDIO;
 }
 
-SimulcastCodecInfo ProtoMarshaller::map(livekit::SimulcastCodecInfo in) const
+SimulcastCodecInfo ProtoMarshaller::map(livekit::SimulcastCodecInfo&& in) const
 {
     SimulcastCodecInfo out;
-    out._mimeType = in.mime_type();
-    out._mid = in.mid();
-    out._cid = in.cid();
-    out._layers = rconv<VideoLayer, livekit::VideoLayer>(in.layers());
+    out._mimeType = take(in.mutable_mime_type());
+    out._mid = take(in.mutable_mid());
+    out._cid = take(in.mutable_cid());
+    out._layers = rconv<VideoLayer, livekit::VideoLayer>(take(in.mutable_layers()));
     return out;
 }
 
@@ -1149,26 +1124,26 @@ ClientConfigSetting ProtoMarshaller::map(livekit::ClientConfigSetting in) const
     return ClientConfigSetting::Unset;
 }
 
-ClientConfiguration ProtoMarshaller::map(livekit::ClientConfiguration in) const
+ClientConfiguration ProtoMarshaller::map(livekit::ClientConfiguration&& in) const
 {
     ClientConfiguration out;
-    out._video = map(in.video());
-    out._screen = map(in.screen());
+    out._video = map(take(in.mutable_video()));
+    out._screen = map(take(in.mutable_screen()));
     out._resumeConnection = map(in.resume_connection());
-    out._disabledCodecs = map(in.disabled_codecs());
+    out._disabledCodecs = map(take(in.mutable_disabled_codecs()));
     out._forceRelay = map(in.force_relay());
     return out;
 }
 
-DisabledCodecs ProtoMarshaller::map(livekit::DisabledCodecs in) const
+DisabledCodecs ProtoMarshaller::map(livekit::DisabledCodecs&& in) const
 {
     DisabledCodecs out;
-    out._codecs = rconv<Codec, livekit::Codec>(in.codecs());
-    out._publish = rconv<Codec, livekit::Codec>(in.publish());
+    out._codecs = rconv<Codec, livekit::Codec>(take(in.mutable_codecs()));
+    out._publish = rconv<Codec, livekit::Codec>(take(in.mutable_publish()));
     return out;
 }
 
-VideoConfiguration ProtoMarshaller::map(livekit::VideoConfiguration in) const
+VideoConfiguration ProtoMarshaller::map(livekit::VideoConfiguration&& in) const
 {
     VideoConfiguration out;
     out._hardwareEncoder = map(in.hardware_encoder());
@@ -1189,15 +1164,15 @@ ServerEdition ProtoMarshaller::map(livekit::ServerInfo_Edition in) const
     return ServerEdition::Standard;
 }
 
-ServerInfo ProtoMarshaller::map(livekit::ServerInfo in) const
+ServerInfo ProtoMarshaller::map(livekit::ServerInfo&& in) const
 {
     ServerInfo out;
     out._edition = map(in.edition());
-    out._version = in.version();
+    out._version = take(in.mutable_version());
     out._protocol = in.protocol();
-    out._region = in.region();
-    out._nodeId = in.node_id();
-    out._debugInfo = in.debug_info();
+    out._region = take(in.mutable_region());
+    out._nodeId = take(in.mutable_node_id());
+    out._debugInfo = take(in.mutable_debug_info());
     out._agentProtocol = in.agent_protocol();
     return out;
 }
@@ -1262,11 +1237,11 @@ livekit::LeaveRequest_Action ProtoMarshaller::map(LeaveRequestAction in) const
     return livekit::LeaveRequest_Action_DISCONNECT;
 }
 
-RegionInfo ProtoMarshaller::map(livekit::RegionInfo in) const
+RegionInfo ProtoMarshaller::map(livekit::RegionInfo&& in) const
 {
     RegionInfo out;
-    out._region = in.region();
-    out._url = in.url();
+    out._region = take(in.mutable_region());
+    out._url = take(in.mutable_url());
     out._distance = in.distance();
     return out;
 }
@@ -1280,10 +1255,10 @@ livekit::RegionInfo ProtoMarshaller::map(RegionInfo in) const
     return out;
 }
 
-RegionSettings ProtoMarshaller::map(livekit::RegionSettings in) const
+RegionSettings ProtoMarshaller::map(livekit::RegionSettings&& in) const
 {
     RegionSettings out;
-    out._regions = rconv<RegionInfo, livekit::RegionInfo>(in.regions());
+    out._regions = rconv<RegionInfo, livekit::RegionInfo>(take(in.mutable_regions()));
     return out;
 }
 
@@ -1294,10 +1269,10 @@ livekit::RegionSettings ProtoMarshaller::map(RegionSettings in) const
     return out;
 }
 
-SpeakerInfo ProtoMarshaller::map(livekit::SpeakerInfo in) const
+SpeakerInfo ProtoMarshaller::map(livekit::SpeakerInfo&& in) const
 {
     SpeakerInfo out;
-    out._sid = in.sid();
+    out._sid = take(in.mutable_sid());
     out._level = in.level();
     out._active = in.active();
     return out;
@@ -1321,10 +1296,10 @@ ConnectionQuality ProtoMarshaller::map(livekit::ConnectionQuality in) const
     return ConnectionQuality::Poor;
 }
 
-ConnectionQualityInfo ProtoMarshaller::map(livekit::ConnectionQualityInfo in) const
+ConnectionQualityInfo ProtoMarshaller::map(livekit::ConnectionQualityInfo&& in) const
 {
     ConnectionQualityInfo out;
-    out._participantSid = in.participant_sid();
+    out._participantSid = take(in.mutable_participant_sid());
     out._quality = map(in.quality());
     out._score = in.score();
     return out;
@@ -1344,16 +1319,16 @@ StreamState ProtoMarshaller::map(livekit::StreamState in) const
     return StreamState::Active;
 }
 
-StreamStateInfo ProtoMarshaller::map(livekit::StreamStateInfo in) const
+StreamStateInfo ProtoMarshaller::map(livekit::StreamStateInfo&& in) const
 {
     StreamStateInfo out;
-    out._participantSid = in.participant_sid();
-    out._trackSid = in.track_sid();
+    out._participantSid = take(in.mutable_participant_sid());
+    out._trackSid = take(in.mutable_track_sid());
     out._state = map(in.state());
     return out;
 }
 
-SubscribedQuality ProtoMarshaller::map(livekit::SubscribedQuality in) const
+SubscribedQuality ProtoMarshaller::map(livekit::SubscribedQuality&& in) const
 {
     SubscribedQuality out;
     out._quality = map(in.quality());
@@ -1361,20 +1336,20 @@ SubscribedQuality ProtoMarshaller::map(livekit::SubscribedQuality in) const
     return out;
 }
 
-SubscribedCodec ProtoMarshaller::map(livekit::SubscribedCodec in) const
+SubscribedCodec ProtoMarshaller::map(livekit::SubscribedCodec&& in) const
 {
     SubscribedCodec out;
-    out._codec = in.codec();
-    out._qualities = rconv<SubscribedQuality, livekit::SubscribedQuality>(in.qualities());
+    out._codec = take(in.mutable_codec());
+    out._qualities = rconv<SubscribedQuality, livekit::SubscribedQuality>(take(in.mutable_qualities()));
     return out;
 }
 
-ICEServer ProtoMarshaller::map(livekit::ICEServer in) const
+ICEServer ProtoMarshaller::map(livekit::ICEServer&& in) const
 {
     ICEServer out;
-    out._urls = rconv<std::string>(in.urls());
-    out._username = in.username();
-    out._credential = in.credential();
+    out._urls = rconv<std::string>(take(in.mutable_urls()));
+    out._username = take(in.mutable_username());
+    out._credential = take(in.mutable_credential());
     return out;
 }
 
@@ -1412,11 +1387,11 @@ SubscriptionError ProtoMarshaller::map(livekit::SubscriptionError in) const
     return SubscriptionError::Unknown;
 }
 
-SimulcastCodec ProtoMarshaller::map(livekit::SimulcastCodec in) const
+SimulcastCodec ProtoMarshaller::map(livekit::SimulcastCodec&& in) const
 {
     SimulcastCodec out;
-    out._cid = in.cid();
-    out._codec = in.codec();
+    out._cid = take(in.mutable_cid());
+    out._codec = take(in.mutable_codec());
     return out;
 }
 
@@ -1428,11 +1403,11 @@ livekit::SimulcastCodec ProtoMarshaller::map(SimulcastCodec in) const
     return out;
 }
 
-ParticipantTracks ProtoMarshaller::map(livekit::ParticipantTracks in) const
+ParticipantTracks ProtoMarshaller::map(livekit::ParticipantTracks&& in) const
 {
     ParticipantTracks out;
-    out._participantSid = in.participant_sid();
-    out._trackSids = rconv<std::string>(in.track_sids());
+    out._participantSid = take(in.mutable_participant_sid());
+    out._trackSids = rconv<std::string>(take(in.mutable_track_sids()));
     return out;
 }
 
@@ -1444,13 +1419,13 @@ livekit::ParticipantTracks ProtoMarshaller::map(ParticipantTracks in) const
     return out;
 }
 
-TrackPermission ProtoMarshaller::map(livekit::TrackPermission in) const
+TrackPermission ProtoMarshaller::map(livekit::TrackPermission&& in) const
 {
     TrackPermission out;
-    out._participantSid = in.participant_sid();
+    out._participantSid = take(in.mutable_participant_sid());
     out._allAracks = in.all_tracks();
-    out._trackSids = rconv<std::string>(in.track_sids());
-    out._participantIdentity = in.participant_identity();
+    out._trackSids = rconv<std::string>(take(in.mutable_track_sids()));
+    out._participantIdentity = take(in.mutable_participant_identity());
     return out;
 }
 
@@ -1464,10 +1439,10 @@ livekit::TrackPermission ProtoMarshaller::map(TrackPermission in) const
     return out;
 }
 
-DataChannelInfo ProtoMarshaller::map(livekit::DataChannelInfo in) const
+DataChannelInfo ProtoMarshaller::map(livekit::DataChannelInfo&& in) const
 {
     DataChannelInfo out;
-    out._label = in.label();
+    out._label = take(in.mutable_label());
     out._id = in.id();
     out._target = map(in.target());
     return out;
@@ -1615,27 +1590,27 @@ livekit::DataPacket ProtoMarshaller::map(DataPacket in) const
     return out;
 }
 
-DataPacket ProtoMarshaller::map(livekit::DataPacket in) const
+DataPacket ProtoMarshaller::map(livekit::DataPacket&& in) const
 {
     DataPacket out;
     out._kind = map(in.kind());
-    out._participantIdentity = in.participant_identity();
-    out._destinationIdentities = rconv<std::string>(in.destination_identities());
+    out._participantIdentity = take(in.mutable_participant_identity());
+    out._destinationIdentities = rconv<std::string>(take(in.mutable_destination_identities()));
     switch (in.value_case()) {
         case livekit::DataPacket::kUser:
-            out._value = map(in.user());
+            out._value = map(take(in.mutable_user()));
             break;
         case livekit::DataPacket::kChatMessage:
-            out._value = map(in.chat_message());
+            out._value = map(take(in.mutable_chat_message()));
             break;
         case livekit::DataPacket::kStreamHeader:
-            out._value = map(in.stream_header());
+            out._value = map(take(in.mutable_stream_header()));
             break;
         case livekit::DataPacket::kStreamChunk:
-            out._value = map(in.stream_chunk());
+            out._value = map(take(in.mutable_stream_chunk()));
             break;
         case livekit::DataPacket::kStreamTrailer:
-            out._value = map(in.stream_trailer());
+            out._value = map(take(in.mutable_stream_trailer()));
             break;
         default:
             if (canLogWarning()) {
@@ -1700,19 +1675,19 @@ livekit::UserPacket ProtoMarshaller::map(UserPacket in) const
     return out;
 }
 
-UserPacket ProtoMarshaller::map(livekit::UserPacket in) const
+UserPacket ProtoMarshaller::map(livekit::UserPacket&& in) const
 {
     UserPacket out;
-    out._participantSid = in.participant_sid();
-    out._participantIdentity = in.participant_identity();
-    out._payload = in.payload();
-    out._destinationSids = rconv<std::string>(in.destination_sids());
-    out._destinationIdentities = rconv<std::string>(in.destination_identities());
+    out._participantSid = take(in.mutable_participant_sid());
+    out._participantIdentity = take(in.mutable_participant_identity());
+    out._payload = take(in.mutable_payload());
+    out._destinationSids = rconv<std::string>(take(in.mutable_destination_sids()));
+    out._destinationIdentities = rconv<std::string>(take(in.mutable_destination_identities()));
     if (in.has_topic()) {
-        out._topic = in.topic();
+        out._topic = take(in.mutable_topic());
     }
     if (in.has_id()) {
-        out._id = in.id();
+        out._id = take(in.mutable_id());
     }
     if (in.has_start_time()) {
         out._startTime = in.start_time();
@@ -1720,7 +1695,7 @@ UserPacket ProtoMarshaller::map(livekit::UserPacket in) const
     if (in.has_end_time()) {
         out._endTime = in.end_time();
     }
-    out._nonce = in.nonce();
+    out._nonce = take(in.mutable_nonce());
     return out;
 }
 
@@ -1729,6 +1704,7 @@ livekit::ChatMessage ProtoMarshaller::map(ChatMessage in) const
     livekit::ChatMessage out;
     out.set_id(std::move(in._id));
     out.set_timestamp(in._timestamp);
+    out.set_message(std::move(in._message));
     if (in._editTimestamp.has_value()) {
         out.set_edit_timestamp(in._editTimestamp.value());
     }
@@ -1737,11 +1713,12 @@ livekit::ChatMessage ProtoMarshaller::map(ChatMessage in) const
     return out;
 }
 
-ChatMessage ProtoMarshaller::map(livekit::ChatMessage in) const
+ChatMessage ProtoMarshaller::map(livekit::ChatMessage&& in) const
 {
     ChatMessage out;
-    out._id = in.id();
+    out._id = take(in.mutable_id());
     out._timestamp = in.timestamp();
+    out._message = take(in.mutable_message());
     if (in.has_edit_timestamp()) {
         out._editTimestamp = in.edit_timestamp();
     }
@@ -1793,10 +1770,10 @@ livekit::DataStream::ByteHeader ProtoMarshaller::map(DataStreamByteHeader in) co
     return out;
 }
 
-DataStreamByteHeader ProtoMarshaller::map(livekit::DataStream::ByteHeader in) const
+DataStreamByteHeader ProtoMarshaller::map(livekit::DataStream::ByteHeader&& in) const
 {
     DataStreamByteHeader out;
-    out._name = in.name();
+    out._name = take(in.mutable_name());
     return out;
 }
 
@@ -1813,15 +1790,15 @@ livekit::DataStream::Chunk ProtoMarshaller::map(DataStreamChunk in) const
     return out;
 }
 
-DataStreamChunk ProtoMarshaller::map(livekit::DataStream::Chunk in) const
+DataStreamChunk ProtoMarshaller::map(livekit::DataStream::Chunk&& in) const
 {
     DataStreamChunk out;
-    out._streamId = in.stream_id();
+    out._streamId = take(in.mutable_stream_id());
     out._chunkIndex = in.chunk_index();
-    out._content = in.content();
+    out._content = take(in.mutable_content());
     out._version = in.version();
     if (in.has_iv()) {
-        out._iv = in.iv();
+        out._iv = take(in.mutable_iv());
     }
     return out;
 }
@@ -1837,13 +1814,13 @@ livekit::DataStream::TextHeader ProtoMarshaller::map(DataStreamTextHeader in) co
     return out;
 }
 
-DataStreamTextHeader ProtoMarshaller::map(livekit::DataStream::TextHeader in) const
+DataStreamTextHeader ProtoMarshaller::map(livekit::DataStream::TextHeader&& in) const
 {
     DataStreamTextHeader out;
     out._operationType = map(in.operation_type());
     out._version = in.version();
-    out._replyToStreamId = in.reply_to_stream_id();
-    out._attachedStreamIds = rconv<std::string>(in.attached_stream_ids());
+    out._replyToStreamId = take(in.mutable_reply_to_stream_id());
+    out._attachedStreamIds = rconv<std::string>(take(in.mutable_attached_stream_ids()));
     out._generated = in.generated();
     return out;
 }
@@ -1871,24 +1848,24 @@ livekit::DataStream::Header ProtoMarshaller::map(DataStreamHeader in) const
     return out;
 }
 
-DataStreamHeader ProtoMarshaller::map(livekit::DataStream::Header in) const
+DataStreamHeader ProtoMarshaller::map(livekit::DataStream::Header&& in) const
 {
     DataStreamHeader out;
-    out._streamId = in.stream_id();
+    out._streamId = take(in.mutable_stream_id());
     out._timestamp = in.timestamp();
-    out._topic = in.topic();
-    out._mimeType = in.mime_type();
+    out._topic = take(in.mutable_topic());
+    out._mimeType = take(in.mutable_mime_type());
     if (in.has_total_length()) {
         out._totalLength = in.total_length();
     }
     out._encryptionType = map(in.encryption_type());
-    out._attributes = mconv(in.attributes());
+    out._attributes = mconv(take(in.mutable_attributes()));
     switch (in.content_header_case()) {
         case livekit::DataStream_Header::kTextHeader:
-            out._contentHeader = map(in.text_header());
+            out._contentHeader = map(take(in.mutable_text_header()));
             break;
         case livekit::DataStream_Header::kByteHeader:
-            out._contentHeader = map(in.byte_header());
+            out._contentHeader = map(take(in.mutable_byte_header()));
             break;
         default:
             if (canLogWarning()) {
@@ -1908,26 +1885,26 @@ livekit::DataStream::Trailer ProtoMarshaller::map(DataStreamTrailer in) const
     return out;
 }
 
-DataStreamTrailer ProtoMarshaller::map(livekit::DataStream::Trailer in) const
+DataStreamTrailer ProtoMarshaller::map(livekit::DataStream::Trailer&& in) const
 {
     DataStreamTrailer out;
-    out._streamId = in.stream_id();
-    out._reason = in.reason();
-    out._attributes = mconv(in.attributes());
+    out._streamId = take(in.mutable_stream_id());
+    out._reason = take(in.mutable_reason());
+    out._attributes = mconv(take(in.mutable_attributes()));
     return out;
 }
 
-RoomMovedResponse ProtoMarshaller::map(livekit::RoomMovedResponse in) const
+RoomMovedResponse ProtoMarshaller::map(livekit::RoomMovedResponse&& in) const
 {
     RoomMovedResponse out;
     if (in.has_room()) {
-        out._room = map(in.room());
+        out._room = map(take(in.mutable_room()));
     }
-    out._token = in.token();
+    out._token = take(in.mutable_token());
     if (in.has_participant()) {
-        out._participant = map(in.participant());
+        out._participant = map(take(in.mutable_participant()));
     }
-    out._otherParticipants = rconv<ParticipantInfo, livekit::ParticipantInfo>(in.other_participants());
+    out._otherParticipants = rconv<ParticipantInfo, livekit::ParticipantInfo>(take(in.mutable_other_participants()));
     return out;
 }
 
@@ -1938,9 +1915,22 @@ std::string_view ProtoMarshaller::logCategory() const
 }
 
 template <typename TOut, typename TIn, class TProtoBufRepeated>
-std::vector<TOut> ProtoMarshaller::rconv(TProtoBufRepeated in) const
-{
-    return fromProtoRepeated<TOut>(std::move(in), [this](auto v) { return map(TIn(std::move(v))); });
+std::vector<TOut> ProtoMarshaller::rconv(TProtoBufRepeated&& in) const
+{
+    std::vector<TOut> out;
+    if (const auto size = in.size()) {
+        out.reserve(size_t(size));
+        for (auto& v : in) {
+            if constexpr (std::is_enum_v<TIn>) {
+                // repeated enums are stored as integers
+                out.push_back(map(TIn(v)));
+            }
+            else {
+                out.push_back(map(std::move(v)));
+            }
+        }
+    }
+    return out;
 }
 
 template <typename TCppRepeated, class TProtoBufRepeated>
@@ -1952,9 +1942,17 @@ void ProtoMarshaller::rconv(TCppRepeated from, TProtoBufRepeated* to) const
 }
 
 template <typename K, typename V>
-std::unordered_map<K, V> ProtoMarshaller::mconv(google::protobuf::Map<K, V> in) const
-{
-    return fromProtoMap(std::move(in));
+std::unordered_map<K, V> ProtoMarshaller::mconv(google::protobuf::Map<K, V>&& in) const
+{
+    std::unordered_map<K, V> out;
+    if (const auto size = in.size()) {
+        out.reserve(size);
+        for (auto it = in.begin(); it != in.end(); ++it) {
+            // keys of proto map are immutable
+            out.emplace(it->first, std::move(it->second));
+        }
+    }
+    return out;
 }
 
 template <typename K, typename V>
@@ -58,78 +58,80 @@ class ProtoMarshaller : public Bricks::LoggableR<>
 {
 public:
     ProtoMarshaller(Bricks::Logger* logger = nullptr);
-    // responses & requests
-    JoinResponse map(livekit::JoinResponse in) const;
-    SessionDescription map(livekit::SessionDescription in) const;
-    livekit::SessionDescription map(SessionDescription in) const;
-    TrickleRequest map(livekit::TrickleRequest in) const;
-    livekit::TrickleRequest map(TrickleRequest in) const;
-    ParticipantUpdate map(livekit::ParticipantUpdate in) const;
-    TrackPublishedResponse map(livekit::TrackPublishedResponse in) const;
+    // responses & requests, incoming proto messages are consumed:
+    // strings, nested messages & repeated fields are moved out,
+    // outgoing requests are written in place to empty (or cleared) [out] message
+    JoinResponse map(livekit::JoinResponse&& in) const;
+    SessionDescription map(livekit::SessionDescription&& in) const;
+    void map(SessionDescription in, livekit::SessionDescription* out) const;
+    TrickleRequest map(livekit::TrickleRequest&& in) const;
+    void map(TrickleRequest in, livekit::TrickleRequest* out) const;
+    ParticipantUpdate map(livekit::ParticipantUpdate&& in) const;
+    TrackPublishedResponse map(livekit::TrackPublishedResponse&& in) const;
     livekit::TrackPublishedResponse map(TrackPublishedResponse in) const;
-    TrackUnpublishedResponse map(livekit::TrackUnpublishedResponse in) const;
-    LeaveRequest map(livekit::LeaveRequest in) const;
-    livekit::LeaveRequest map(LeaveRequest in) const;
-    MuteTrackRequest map(livekit::MuteTrackRequest in) const;
-    livekit::MuteTrackRequest map(MuteTrackRequest in) const;
-    SpeakersChanged map(livekit::SpeakersChanged in) const;
-    RoomUpdate map(livekit::RoomUpdate in) const;
-    ConnectionQualityUpdate map(livekit::ConnectionQualityUpdate in) const;
-    StreamStateUpdate map(livekit::StreamStateUpdate in) const;
-    SubscribedQualityUpdate map(livekit::SubscribedQualityUpdate in) const;
-    ReconnectResponse map(livekit::ReconnectResponse in) const;
-    TrackSubscribed map(livekit::TrackSubscribed in) const;
-    RequestResponse map(livekit::RequestResponse in) const;
-    SubscriptionResponse map(livekit::SubscriptionResponse in) const;
-    SubscriptionPermissionUpdate map(livekit::SubscriptionPermissionUpdate in) const;
-    AddTrackRequest map(livekit::AddTrackRequest in) const;
-    livekit::AddTrackRequest map(AddTrackRequest in) const;
-    UpdateSubscription map(livekit::UpdateSubscription in) const;
-    livekit::UpdateSubscription map(UpdateSubscription in) const;
-    UpdateTrackSettings map(livekit::UpdateTrackSettings in) const;
-    livekit::UpdateTrackSettings map(UpdateTrackSettings in) const;
-    UpdateVideoLayers map(livekit::UpdateVideoLayers in) const;
-    livekit::UpdateVideoLayers map(UpdateVideoLayers in) const;
-    SubscriptionPermission map(livekit::SubscriptionPermission in) const;
-    livekit::SubscriptionPermission map(SubscriptionPermission in) const;
-    SyncState map(livekit::SyncState in) const;
-    livekit::SyncState map(SyncState in) const;
-    SimulateScenario map(livekit::SimulateScenario in) const;
-    livekit::SimulateScenario map(SimulateScenario in) const;
-    UpdateParticipantMetadata map(livekit::UpdateParticipantMetadata in) const;
-    livekit::UpdateParticipantMetadata map(UpdateParticipantMetadata in) const;
-    Ping map(livekit::Ping in) const;
-    livekit::Ping map(Ping in) const;
-    Pong map(livekit::Pong in) const;
+    TrackUnpublishedResponse map(livekit::TrackUnpublishedResponse&& in) const;
+    LeaveRequest map(livekit::LeaveRequest&& in) const;
+    void map(LeaveRequest in, livekit::LeaveRequest* out) const;
+    MuteTrackRequest map(livekit::MuteTrackRequest&& in) const;
+    void map(MuteTrackRequest in, livekit::MuteTrackRequest* out) const;
+    SpeakersChanged map(livekit::SpeakersChanged&& in) const;
+    RoomUpdate map(livekit::RoomUpdate&& in) const;
+    ConnectionQualityUpdate map(livekit::ConnectionQualityUpdate&& in) const;
+    StreamStateUpdate map(livekit::StreamStateUpdate&& in) const;
+    SubscribedQualityUpdate map(livekit::SubscribedQualityUpdate&& in) const;
+    ReconnectResponse map(livekit::ReconnectResponse&& in) const;
+    TrackSubscribed map(livekit::TrackSubscribed&& in) const;
+    RequestResponse map(livekit::RequestResponse&& in) const;
+    SubscriptionResponse map(livekit::SubscriptionResponse&& in) const;
+    SubscriptionPermissionUpdate map(livekit::SubscriptionPermissionUpdate&& in) const;
+    AddTrackRequest map(livekit::AddTrackRequest&& in) const;
+    void map(AddTrackRequest in, livekit::AddTrackRequest* out) const;
+    UpdateSubscription map(livekit::UpdateSubscription&& in) const;
+    void map(UpdateSubscription in, livekit::UpdateSubscription* out) const;
+    UpdateTrackSettings map(livekit::UpdateTrackSettings&& in) const;
+    void map(UpdateTrackSettings in, livekit::UpdateTrackSettings* out) const;
+    UpdateVideoLayers map(livekit::UpdateVideoLayers&& in) const;
+    void map(UpdateVideoLayers in, livekit::UpdateVideoLayers* out) const;
+    SubscriptionPermission map(livekit::SubscriptionPermission&& in) const;
+    void map(SubscriptionPermission in, livekit::SubscriptionPermission* out) const;
+    SyncState map(livekit::SyncState&& in) const;
+    void map(SyncState in, livekit::SyncState* out) const;
+    SimulateScenario map(livekit::SimulateScenario&& in) const;
+    void map(SimulateScenario in, livekit::SimulateScenario* out) const;
+    UpdateParticipantMetadata map(livekit::UpdateParticipantMetadata&& in) const;
+    void map(UpdateParticipantMetadata in, livekit::UpdateParticipantMetadata* out) const;
+    Ping map(livekit::Ping&& in) const;
+    void map(Ping in, livekit::Ping* out) const;
+    Pong map(livekit::Pong&& in) const;
     livekit::Pong map(Pong in) const;
-    UpdateLocalAudioTrack map(livekit::UpdateLocalAudioTrack in) const;
-    livekit::UpdateLocalAudioTrack map(UpdateLocalAudioTrack in) const;
-    UpdateLocalVideoTrack map(livekit::UpdateLocalVideoTrack in) const;
-    livekit::UpdateLocalVideoTrack map(UpdateLocalVideoTrack in) const;
-    ClientInfo map(livekit::ClientInfo in) const;
+    UpdateLocalAudioTrack map(livekit::UpdateLocalAudioTrack&& in) const;
+    void map(UpdateLocalAudioTrack in, livekit::UpdateLocalAudioTrack* out) const;
+    UpdateLocalVideoTrack map(livekit::UpdateLocalVideoTrack&& in) const;
+    void map(UpdateLocalVideoTrack in, livekit::UpdateLocalVideoTrack* out) const;
+    ClientInfo map(livekit::ClientInfo&& in) const;
     livekit::ClientInfo map(ClientInfo in) const;
     // data
-    RoomInfo map(livekit::Room in) const;
-    Codec map(livekit::Codec in) const;
-    TimedVersion map(livekit::TimedVersion in) const;
+    RoomInfo map(livekit::Room&& in) const;
+    Codec map(livekit::Codec&& in) const;
+    TimedVersion map(livekit::TimedVersion&& in) const;
     livekit::TimedVersion map(TimedVersion in) const;
-    ParticipantInfo map(livekit::ParticipantInfo in) const;
+    ParticipantInfo map(livekit::ParticipantInfo&& in) const;
     ParticipantKind map(livekit::ParticipantInfo_Kind in) const;
     ParticipantState map(livekit::ParticipantInfo_State in) const;
-    ParticipantPermission map(livekit::ParticipantPermission in) const;
+    ParticipantPermission map(livekit::ParticipantPermission&& in) const;
     DisconnectReason map(livekit::DisconnectReason in) const;
     livekit::DisconnectReason map(DisconnectReason in) const;
     TrackSource map(livekit::TrackSource in) const;
     livekit::TrackSource map(TrackSource in) const;
-    TrackInfo map(livekit::TrackInfo in) const;
+    TrackInfo map(livekit::TrackInfo&& in) const;
     livekit::TrackInfo map(TrackInfo in) const;
     VideoQuality map(livekit::VideoQuality in) const;
     livekit::VideoQuality map(VideoQuality in) const;
-    VideoLayer map(livekit::VideoLayer in) const;
+    VideoLayer map(livekit::VideoLayer&& in) const;
     livekit::VideoLayer map(VideoLayer in) const;
     TrackType map(livekit::TrackType in) const;
     livekit::TrackType map(TrackType in) const;
-    SimulcastCodecInfo map(livekit::SimulcastCodecInfo in) const;
+    SimulcastCodecInfo map(livekit::SimulcastCodecInfo&& in) const;
     livekit::SimulcastCodecInfo map(SimulcastCodecInfo in) const;
     BackupCodecPolicy map(livekit::BackupCodecPolicy in) const;
     livekit::BackupCodecPolicy map(BackupCodecPolicy in) const;
@@ -138,62 +140,62 @@ public:
     AudioTrackFeature map(livekit::AudioTrackFeature in) const;
     livekit::AudioTrackFeature map(AudioTrackFeature in) const;
     ClientConfigSetting map(livekit::ClientConfigSetting in) const;
-    ClientConfiguration map(livekit::ClientConfiguration in) const;
-    DisabledCodecs map(livekit::DisabledCodecs in) const;
-    VideoConfiguration map(livekit::VideoConfiguration in) const;
+    ClientConfiguration map(livekit::ClientConfiguration&& in) const;
+    DisabledCodecs map(livekit::DisabledCodecs&& in) const;
+    VideoConfiguration map(livekit::VideoConfiguration&& in) const;
     ServerEdition map(livekit::ServerInfo_Edition in) const;
-    ServerInfo map(livekit::ServerInfo in) const;
+    ServerInfo map(livekit::ServerInfo&& in) const;
     SignalTarget map(livekit::SignalTarget in) const;
     livekit::SignalTarget map(SignalTarget in) const;
     LeaveRequestAction map(livekit::LeaveRequest_Action in) const;
     livekit::LeaveRequest_Action map(LeaveRequestAction in) const;
-    RegionInfo map(livekit::RegionInfo in) const;
+    RegionInfo map(livekit::RegionInfo&& in) const;
     livekit::RegionInfo map(RegionInfo in) const;
-    RegionSettings map(livekit::RegionSettings in) const;
+    RegionSettings map(livekit::RegionSettings&& in) const;
     livekit::RegionSettings map(RegionSettings in) const;
-    SpeakerInfo map(livekit::SpeakerInfo in) const;
+    SpeakerInfo map(livekit::SpeakerInfo&& in) const;
     ConnectionQuality map(livekit::ConnectionQuality in) const;
-    ConnectionQualityInfo map(livekit::ConnectionQualityInfo in) const;
+    ConnectionQualityInfo map(livekit::ConnectionQualityInfo&& in) const;
     StreamState map(livekit::StreamState in) const;
-    StreamStateInfo map(livekit::StreamStateInfo in) const;
-    SubscribedQuality map(livekit::SubscribedQuality in) const;
-    SubscribedCodec map(livekit::SubscribedCodec in) const;
-    ICEServer map(livekit::ICEServer in) const;
+    StreamStateInfo map(livekit::StreamStateInfo&& in) const;
+    SubscribedQuality map(livekit::SubscribedQuality&& in) const;
+    SubscribedCodec map(livekit::SubscribedCodec&& in) const;
+    ICEServer map(livekit::ICEServer&& in) const;
     RequestResponseReason map(livekit::RequestResponse_Reason in) const;
     SubscriptionError map(livekit::SubscriptionError in) const;
-    SimulcastCodec map(livekit::SimulcastCodec in) const;
+    SimulcastCodec map(livekit::SimulcastCodec&& in) const;
     livekit::SimulcastCodec map(SimulcastCodec in) const;
-    ParticipantTracks map(livekit::ParticipantTracks in) const;
+    ParticipantTracks map(livekit::ParticipantTracks&& in) const;
     livekit::ParticipantTracks map(ParticipantTracks in) const;
-    TrackPermission map(livekit::TrackPermission in) const;
+    TrackPermission map(livekit::TrackPermission&& in) const;
     livekit::TrackPermission map(TrackPermission in) const;
-    DataChannelInfo map(livekit::DataChannelInfo in) const;
+    DataChannelInfo map(livekit::DataChannelInfo&& in) const;
     livekit::DataChannelInfo map(DataChannelInfo in) const;
     CandidateProtocol map(livekit::CandidateProtocol in) const;
     livekit::CandidateProtocol map(CandidateProtocol in) const;
     livekit::ClientInfo_SDK map(SDK sdk) const;
     SDK map(livekit::ClientInfo_SDK sdk) const;
     livekit::DataPacket map(DataPacket in) const;
-    DataPacket map(livekit::DataPacket in) const;
+    DataPacket map(livekit::DataPacket&& in) const;
     livekit::DataPacket::Kind map(DataPacketKind kind) const;
     DataPacketKind map(livekit::DataPacket::Kind kind) const;
     livekit::UserPacket map(UserPacket in) const;
-    UserPacket map(livekit::UserPacket in) const;
+    UserPacket map(livekit::UserPacket&& in) const;
     livekit::ChatMessage map(ChatMessage in) const;
-    ChatMessage map(livekit::ChatMessage in) const;
+    ChatMessage map(livekit::ChatMessage&& in) const;
     livekit::DataStream::OperationType map(DataStreamTextHeaderOperationType type) const;
     DataStreamTextHeaderOperationType map(livekit::DataStream::OperationType type) const;
     livekit::DataStream::ByteHeader map(DataStreamByteHeader in) const;
-    DataStreamByteHeader map(livekit::DataStream::ByteHeader in) const;
+    DataStreamByteHeader map(livekit::DataStream::ByteHeader&& in) const;
     livekit::DataStream::Chunk map(DataStreamChunk in) const;
-    DataStreamChunk map(livekit::DataStream::Chunk in) const;
+    DataStreamChunk map(livekit::DataStream::Chunk&& in) const;
     livekit::DataStream::TextHeader map(DataStreamTextHeader in) const;
-    DataStreamTextHeader map(livekit::DataStream::TextHeader in) const;
+    DataStreamTextHeader map(livekit::DataStream::TextHeader&& in) const;
     livekit::DataStream::Header map(DataStreamHeader in) const;
-    DataStreamHeader map(livekit::DataStream::Header in) const;
+    DataStreamHeader map(livekit::DataStream::Header&& in) const;
     livekit::DataStream::Trailer map(DataStreamTrailer in) const;
-    DataStreamTrailer map(livekit::DataStream::Trailer in) const;
-    RoomMovedResponse map(livekit::RoomMovedResponse in) const;
+    DataStreamTrailer map(livekit::DataStream::Trailer&& in) const;
+    RoomMovedResponse map(livekit::RoomMovedResponse&& in) const;
 protected:
     // overrides of Bricks::LoggableR
     std::string_view logCategory() const final;
@@ -201,12 +203,13 @@ private:
     // helpers
     template <typename T>
     T map(T in) const { return std::move(in); }
+    // elements of [in] are moved out
     template <typename TOut, typename TIn = TOut, class TProtoBufRepeated>
-    std::vector<TOut> rconv(TProtoBufRepeated in) const;
+    std::vector<TOut> rconv(TProtoBufRepeated&& in) const;
     template <typename TCppRepeated, class TProtoBufRepeated>
     void rconv(TCppRepeated from, TProtoBufRepeated* to) const;
     template <typename K, typename V>
-    std::unordered_map<K, V> mconv(google::protobuf::Map<K, V> in) const;
+    std::unordered_map<K, V> mconv(google::protobuf::Map<K, V>&& in) const;
     template <typename K, typename V>
     void mconv(std::unordered_map<K, V> from, google::protobuf::Map<K, V>* to) const;
 };
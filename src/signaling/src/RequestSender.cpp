@@ -13,25 +13,13 @@
 // limitations under the License.
 #include "RequestSender.h"
 #include "MarshalledTypesFwd.h"
-#include "ProtoUtils.h"
-#include "Blob.h"
+#include "SignalBuffersPool.h"
 #include "livekit/signaling/CommandSender.h"
 
 using Request = livekit::SignalRequest;
 
 namespace {
 
-class VectorBlob : public Bricks::Blob
-{
-public:
-    VectorBlob(const std::vector<uint8_t>& data);
-    // impl. of Bricks::Blob
-    size_t size() const final { return _data.size(); }
-    const uint8_t* data() const final { return _data.data(); }
-private:
-    const std::vector<uint8_t>& _data;
-};
-
 template <typename T>
 inline std::string requestTypeName() { static_assert(false, "type name not evaluated"); }
 
@@ -176,10 +164,11 @@ bool RequestSender::send(const TSetMethod& setMethod, TObject object,
 {
     bool ok = false;
     if (canSend()) {
-        Request request;
-        if (const auto target = (request.*setMethod)()) {
-            *target = _marshaller.map(std::move(object));
-            ok = send(request, detectTypename<TObject>(typeName));
+        const auto request = SignalBuffersPool::instance().acquireRequest();
+        if (const auto target = (request.get()->*setMethod)()) {
+            // nested message of the pooled request is filled in place
+            _marshaller.map(std::move(object), target);
+            ok = send(*request, detectTypename<TObject>(typeName));
         }
         else if (canLogError()) {
             logError("proto method not available for set of '" +
@@ -193,9 +182,10 @@ template <class TProtoObject>
 bool RequestSender::send(const TProtoObject& object, const std::string& typeName) const
 {
     bool ok = false;
-    const auto bytes = protoToBytes(object, logger(), logCategory());
-    if (!bytes.empty()) {
-        ok = _commandSender->sendBinary(VectorBlob(bytes));
+    const auto bytes = SignalBuffersPool::instance().serialize(object, logger(), logCategory());
+    if (bytes.size()) {
+        // websocket layer doesn't hold the blob after return, buffer goes back to the pool
+        ok = _commandSender->sendBinary(bytes);
         if (ok) {
             if (canLogVerbose()) {
                 logVerbose("sending '" + typeName + "' to server");
@@ -212,12 +202,3 @@ bool RequestSender::send(const TProtoObject& object, const std::string& typeName
 }
 
 } // namespace LiveKitCpp
-
-namespace {
-
-VectorBlob::VectorBlob(const std::vector<uint8_t>& data)
-    : _data(data)
-{
-}
-
-}
@@ -68,60 +68,60 @@ ResponseReceiver::ResponseReceiver(Bricks::Logger* logger)
 void ResponseReceiver::parseBinary(const void* data, size_t dataLen)
 {
     if (_listener && data && dataLen) {
-        if (const auto response = parseResponse(data, dataLen)) {
+        if (auto response = parseResponse(data, dataLen)) {
             switch (response->message_case()) {
                 case livekit::SignalResponse::kJoin:
-                    handle(response->join());
+                    handle(std::move(*response->mutable_join()));
                     break;
                 case livekit::SignalResponse::kAnswer:
-                    handle(response->answer(), false);
+                    handle(std::move(*response->mutable_answer()), false);
                     break;
                 case livekit::SignalResponse::kOffer:
-                    handle(response->offer(), true);
+                    handle(std::move(*response->mutable_offer()), true);
                     break;
                 case livekit::SignalResponse::kTrickle:
-                    handle(response->trickle());
+                    handle(std::move(*response->mutable_trickle()));
                     break;
                 case livekit::SignalResponse::kUpdate:
-                    handle(response->update());
+                    handle(std::move(*response->mutable_update()));
                     break;
                 case livekit::SignalResponse::kTrackPublished:
-                    handle(response->track_published());
+                    handle(std::move(*response->mutable_track_published()));
                     break;
                 case livekit::SignalResponse::kLeave:
-                    handle(response->leave());
+                    handle(std::move(*response->mutable_leave()));
                     break;
                 case livekit::SignalResponse::kMute:
-                    handle(response->mute());
+                    handle(std::move(*response->mutable_mute()));
                     break;
                 case livekit::SignalResponse::kSpeakersChanged:
-                    handle(response->speakers_changed());
+                    handle(std::move(*response->mutable_speakers_changed()));
                     break;
                 case livekit::SignalResponse::kRoomUpdate:
-                    handle(response->room_update());
+                    handle(std::move(*response->mutable_room_update()));
                     break;
                 case livekit::SignalResponse::kConnectionQuality:
-                    handle(response->connection_quality());
+                    handle(std::move(*response->mutable_connection_quality()));
                     break;
                 case livekit::SignalResponse::kStreamStateUpdate:
-                    handle(response->stream_state_update());
+                    handle(std::move(*response->mutable_stream_state_update()));
                     break;
                 case livekit::SignalResponse::kSubscribedQualityUpdate:
-                    handle(response->subscribed_quality_update());
+                    handle(std::move(*response->mutable_subscribed_quality_update()));
                     break;
                 case livekit::SignalResponse::kSubscriptionPermissionUpdate:
-                    handle(response->subscription_permission_update());
+                    handle(std::move(*response->mutable_subscription_permission_update()));
                     break;
                 case livekit::SignalResponse::kRefreshToken:
                     if (response->has_refresh_token()) {
                         if (canLogVerbose()) {
                             logVerbose(formatVerboseMsg("RefreshToken"));
                         }
-                        notify(&ResponsesListener::onRefreshToken, response->refresh_token());
+                        notify(&ResponsesListener::onRefreshToken, std::move(*response->mutable_refresh_token()));
                     }
                     break;
                 case livekit::SignalResponse::kTrackUnpublished:
-                    handle(response->track_unpublished());
+                    handle(std::move(*response->mutable_track_unpublished()));
                     break;
                 case livekit::SignalResponse::kPong: // deprecated
                     if (response->has_pong()) {
@@ -134,30 +134,30 @@ void ResponseReceiver::parseBinary(const void* data, size_t dataLen)
                     }
                     break;
                 case livekit::SignalResponse::kReconnect:
-                    handle(response->reconnect());
+                    handle(std::move(*response->mutable_reconnect()));
                     break;
                 case livekit::SignalResponse::kPongResp:
-                    handle(response->pong_resp());
+                    handle(std::move(*response->mutable_pong_resp()));
                     break;
                 case livekit::SignalResponse::kSubscriptionResponse:
-                    handle(response->subscription_response());
+                    handle(std::move(*response->mutable_subscription_response()));
                     break;
                 case livekit::SignalResponse::kRequestResponse:
-                    handle(response->request_response());
+                    handle(std::move(*response->mutable_request_response()));
                     break;
                 case livekit::SignalResponse::kTrackSubscribed:
-                    handle(response->track_subscribed());
+                    handle(std::move(*response->mutable_track_subscribed()));
                     break;
                 case livekit::SignalResponse::kRoomMoved:
-                    handle(response->room_moved());
+                    handle(std::move(*response->mutable_room_moved()));
                     break;
                 default:
                     // TODO: dump response to log
                     break;
             }
         }
-        else if (const auto dataPacket = parseDataPacket(data, dataLen)) {
-            handle(dataPacket.value());
+        else if (auto dataPacket = parseDataPacket(data, dataLen)) {
+            handle(std::move(*dataPacket));
         }
         else {
             notifyAboutError("unknown proto packet, size is " + std::to_string(dataLen) + " bytes");
@@ -182,7 +182,7 @@ std::optional<livekit::SignalResponse> ResponseReceiver::
     return protoFromBytes<livekit::SignalResponse>(data, dataLen);
 }
 
-std::optional<livekit::DataPacket>  ResponseReceiver::
+std::optional<livekit::DataPacket> ResponseReceiver::
     parseDataPacket(const void* data, size_t dataLen) const
 {
     return protoFromBytes<livekit::DataPacket>(data, dataLen);
@@ -195,24 +195,24 @@ void ResponseReceiver::notify(const Method& method, Args&&... args) const
 }
 
 template <class Method, class TLiveKitType>
-void ResponseReceiver::signal(const Method& method, TLiveKitType sig,
+void ResponseReceiver::signal(const Method& method, TLiveKitType&& sig,
                               std::string typeName) const
 {
     if (canLogVerbose()) {
         if (typeName.empty()) {
-            typeName = marshalledTypeName<TLiveKitType>();
+            typeName = marshalledTypeName<std::decay_t<TLiveKitType>>();
         }
         logVerbose(formatVerboseMsg(typeName));
     }
     notify(method, _marshaller.map(std::move(sig)));
 }
 
-void ResponseReceiver::handle(livekit::JoinResponse response) const
+void ResponseReceiver::handle(livekit::JoinResponse&& response) const
 {
     signal(&ResponsesListener::onJoin, std::move(response));
 }
 
-void ResponseReceiver::handle(livekit::SessionDescription desc, bool offer) const
+void ResponseReceiver::handle(livekit::SessionDescription&& desc, bool offer) const
 {
     auto typeName = marshalledTypeName<livekit::SessionDescription>();
     if (offer) {
@@ -223,97 +223,97 @@ void ResponseReceiver::handle(livekit::SessionDescription desc, bool offer) cons
     }
 }
 
-void ResponseReceiver::handle(livekit::TrickleRequest request) const
+void ResponseReceiver::handle(livekit::TrickleRequest&& request) const
 {
     signal(&ResponsesListener::onTrickle, std::move(request));
 }
 
-void ResponseReceiver::handle(livekit::ParticipantUpdate update) const
+void ResponseReceiver::handle(livekit::ParticipantUpdate&& update) const
 {
     signal(&ResponsesListener::onUpdate, std::move(update));
 }
 
-void ResponseReceiver::handle(livekit::TrackPublishedResponse response) const
+void ResponseReceiver::handle(livekit::TrackPublishedResponse&& response) const
 {
     signal(&ResponsesListener::onTrackPublished, std::move(response));
 }
 
-void ResponseReceiver::handle(livekit::LeaveRequest request) const
+void ResponseReceiver::handle(livekit::LeaveRequest&& request) const
 {
     signal(&ResponsesListener::onLeave, std::move(request));
 }
 
-void ResponseReceiver::handle(livekit::MuteTrackRequest request) const
+void ResponseReceiver::handle(livekit::MuteTrackRequest&& request) const
 {
     signal(&ResponsesListener::onMute, std::move(request));
 }
 
-void ResponseReceiver::handle(livekit::SpeakersChanged changed) const
+void ResponseReceiver::handle(livekit::SpeakersChanged&& changed) const
 {
     signal(&ResponsesListener::onSpeakersChanged, std::move(changed));
 }
 
-void ResponseReceiver::handle(livekit::RoomUpdate update) const
+void ResponseReceiver::handle(livekit::RoomUpdate&& update) const
 {
     signal(&ResponsesListener::onRoomUpdate, std::move(update));
 }
 
-void ResponseReceiver::handle(livekit::ConnectionQualityUpdate update) const
+void ResponseReceiver::handle(livekit::ConnectionQualityUpdate&& update) const
 {
     signal(&ResponsesListener::onConnectionQuality, std::move(update));
 }
 
-void ResponseReceiver::handle(livekit::StreamStateUpdate update) const
+void ResponseReceiver::handle(livekit::StreamStateUpdate&& update) const
 {
     signal(&ResponsesListener::onStreamStateUpdate, std::move(update));
 }
 
-void ResponseReceiver::handle(livekit::SubscribedQualityUpdate update) const
+void ResponseReceiver::handle(livekit::SubscribedQualityUpdate&& update) const
 {
     signal(&ResponsesListener::onSubscribedQualityUpdate, std::move(update));
 }
 
-void ResponseReceiver::handle(livekit::SubscriptionPermissionUpdate update) const
+void ResponseReceiver::handle(livekit::SubscriptionPermissionUpdate&& update) const
 {
     signal(&ResponsesListener::onSubscriptionPermission, std::move(update));
 }
 
-void ResponseReceiver::handle(livekit::TrackUnpublishedResponse response) const
+void ResponseReceiver::handle(livekit::TrackUnpublishedResponse&& response) const
 {
     signal(&ResponsesListener::onTrackUnpublished, std::move(response));
 }
 
-void ResponseReceiver::handle(livekit::ReconnectResponse response) const
+void ResponseReceiver::handle(livekit::ReconnectResponse&& response) const
 {
     signal(&ResponsesListener::onReconnect, std::move(response));
 }
 
-void ResponseReceiver::handle(livekit::SubscriptionResponse response) const
+void ResponseReceiver::handle(livekit::SubscriptionResponse&& response) const
 {
     signal(&ResponsesListener::onSubscriptionResponse, std::move(response));
 }
 
-void ResponseReceiver::handle(livekit::RequestResponse response) const
+void ResponseReceiver::handle(livekit::RequestResponse&& response) const
 {
     signal(&ResponsesListener::onRequestResponse, std::move(response));
 }
 
-void ResponseReceiver::handle(livekit::TrackSubscribed subscribed) const
+void ResponseReceiver::handle(livekit::TrackSubscribed&& subscribed) const
 {
     signal(&ResponsesListener::onTrackSubscribed, std::move(subscribed));
 }
 
-void ResponseReceiver::handle(livekit::Pong pong) const
+void ResponseReceiver::handle(livekit::Pong&& pong) const
 {
     signal(&ResponsesListener::onPong, std::move(pong));
 }
 
-void ResponseReceiver::handle(livekit::DataPacket packet) const
+void ResponseReceiver::handle(livekit::DataPacket&& packet) const
 {
     signal(&ResponsesListener::onDataPacket, std::move(packet));
 }
 
-void ResponseReceiver::handle(livekit::RoomMovedResponse response) const
+void ResponseReceiver::handle(livekit::RoomMovedResponse&& response) const
 {
     signal(&ResponsesListener::onRoomMovedResponse, std::move(response));
 }
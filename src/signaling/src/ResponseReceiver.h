@@ -34,35 +34,38 @@ protected:
     // overrides of Bricks::LoggableR
     std::string_view logCategory() const final;
 private:
+    // messages are parsed on the heap (not on arena), so strings,
+    // repeated fields & sub-messages can be moved out of them without copying
     std::optional<livekit::SignalResponse> parseResponse(const void* data, size_t dataLen) const;
     std::optional<livekit::DataPacket> parseDataPacket(const void* data, size_t dataLen) const;
     template <class Method, typename... Args>
     void notify(const Method& method, Args&&... args) const;
     template <class Method, class TLiveKitType>
-    void signal(const Method& method, TLiveKitType sig, std::string typeName = {}) const;
+    void signal(const Method& method, TLiveKitType&& sig, std::string typeName = {}) const;
     // all responses are defined in 'SignalResponse':
     // https://github.com/livekit/protocol/blob/main/protobufs/livekit_rtc.proto#L61
-    void handle(livekit::JoinResponse response) const;
-    void handle(livekit::SessionDescription desc, bool offer) const;
-    void handle(livekit::TrickleRequest request) const;
-    void handle(livekit::ParticipantUpdate update) const;
-    void handle(livekit::TrackPublishedResponse response) const;
-    void handle(livekit::LeaveRequest request) const;
-    void handle(livekit::MuteTrackRequest request) const;
-    void handle(livekit::SpeakersChanged changed) const;
-    void handle(livekit::RoomUpdate update) const;
-    void handle(livekit::ConnectionQualityUpdate update) const;
-    void handle(livekit::StreamStateUpdate update) const;
-    void handle(livekit::SubscribedQualityUpdate update) const;
-    void handle(livekit::SubscriptionPermissionUpdate update) const;
-    void handle(livekit::TrackUnpublishedResponse response) const;
-    void handle(livekit::ReconnectResponse response) const;
-    void handle(livekit::SubscriptionResponse response) const;
-    void handle(livekit::RequestResponse response) const;
-    void handle(livekit::TrackSubscribed subscribed) const;
-    void handle(livekit::Pong pong) const;
-    void handle(livekit::DataPacket packet) const;
-    void handle(livekit::RoomMovedResponse response) const;
+    // content of messages is moved into marshalled types
+    void handle(livekit::JoinResponse&& response) const;
+    void handle(livekit::SessionDescription&& desc, bool offer) const;
+    void handle(livekit::TrickleRequest&& request) const;
+    void handle(livekit::ParticipantUpdate&& update) const;
+    void handle(livekit::TrackPublishedResponse&& response) const;
+    void handle(livekit::LeaveRequest&& request) const;
+    void handle(livekit::MuteTrackRequest&& request) const;
+    void handle(livekit::SpeakersChanged&& changed) const;
+    void handle(livekit::RoomUpdate&& update) const;
+    void handle(livekit::ConnectionQualityUpdate&& update) const;
+    void handle(livekit::StreamStateUpdate&& update) const;
+    void handle(livekit::SubscribedQualityUpdate&& update) const;
+    void handle(livekit::SubscriptionPermissionUpdate&& update) const;
+    void handle(livekit::TrackUnpublishedResponse&& response) const;
+    void handle(livekit::ReconnectResponse&& response) const;
+    void handle(livekit::SubscriptionResponse&& response) const;
+    void handle(livekit::RequestResponse&& response) const;
+    void handle(livekit::TrackSubscribed&& subscribed) const;
+    void handle(livekit::Pong&& pong) const;
+    void handle(livekit::DataPacket&& packet) const;
+    void handle(livekit::RoomMovedResponse&& response) const;
 private:
     const ProtoMarshaller _marshaller;
     Bricks::Listener<ResponsesListener*> _listener;
@@ -0,0 +1,162 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "SignalBuffersPool.h"
+#include <google/protobuf/descriptor.h>
+#include <limits>
+#include <string>
+
+namespace LiveKitCpp
+{
+
+SignalBuffersPool& SignalBuffersPool::instance()
+{
+    static SignalBuffersPool pool;
+    return pool;
+}
+
+SignalBuffersPool::Request SignalBuffersPool::acquireRequest()
+{
+    std::unique_ptr<livekit::SignalRequest> request;
+    {
+        const std::lock_guard guard(_mutex);
+        if (!_freeRequests.empty()) {
+            request = std::move(_freeRequests.back());
+            _freeRequests.pop_back();
+        }
+    }
+    if (!request) {
+        request = std::make_unique<livekit::SignalRequest>();
+    }
+    return Request(request.release());
+}
+
+SignalBuffersPool::Buffer SignalBuffersPool::serialize(const google::protobuf::MessageLite& proto,
+                                                      Bricks::Logger* logger,
+                                                      std::string_view category)
+{
+    if (const auto size = proto.ByteSizeLong()) {
+        if (size <= size_t(std::numeric_limits<int>::max())) {
+            auto storage = acquireStorage(size);
+            // sizes are cached by ByteSizeLong() above
+            const auto end = proto.SerializeWithCachedSizesToArray(storage.data());
+            if (end == storage.data() + size) {
+                return Buffer(std::move(storage), size);
+            }
+            releaseStorage(std::move(storage));
+        }
+        if (logger && logger->canLogError()) {
+            logger->logError(std::string("failed serialize of ") + proto.GetTypeName() +
+                             " to blob, size is " + std::to_string(size) + " bytes", category);
+        }
+    }
+    return {};
+}
+
+size_t SignalBuffersPool::sizeClass(size_t size)
+{
+    size_t index = 0U;
+    while (index < _classesCount && (size_t(1U) << (index + _minClassBits)) < size) {
+        ++index;
+    }
+    return index;
+}
+
+std::vector<uint8_t> SignalBuffersPool::acquireStorage(size_t size)
+{
+    std::vector<uint8_t> storage;
+    const auto index = sizeClass(size);
+    if (index < _classesCount) {
+        {
+            const std::lock_guard guard(_mutex);
+            auto& freeBuffers = _freeBuffers[index];
+            if (!freeBuffers.empty()) {
+                storage = std::move(freeBuffers.back());
+                freeBuffers.pop_back();
+            }
+        }
+        if (storage.empty()) {
+            storage.resize(size_t(1U) << (index + _minClassBits));
+        }
+    }
+    else {
+        storage.resize(size);
+    }
+    return storage;
+}
+
+void SignalBuffersPool::releaseStorage(std::vector<uint8_t> storage)
+{
+    if (!storage.empty()) {
+        // only full-sized buffers of own classes are accepted
+        const auto index = sizeClass(storage.size());
+        if (index < _classesCount && storage.size() == (size_t(1U) << (index + _minClassBits))) {
+            const std::lock_guard guard(_mutex);
+            auto& freeBuffers = _freeBuffers[index];
+            if (freeBuffers.size() < _maxFreeBuffers) {
+                freeBuffers.push_back(std::move(storage));
+            }
+        }
+    }
+}
+
+void SignalBuffersPool::clearRequest(livekit::SignalRequest& request)
+{
+    // SignalRequest::Clear() destroys the active member of 'message' oneof,
+    // clear only its content, so strings, repeated & nested fields keep their memory
+    const auto field = livekit::SignalRequest::descriptor()->FindFieldByNumber(int(request.message_case()));
+    if (field && google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE == field->cpp_type()) {
+        request.GetReflection()->MutableMessage(&request, field)->Clear();
+    }
+    else {
+        request.Clear();
+    }
+}
+
+void SignalBuffersPool::releaseRequest(livekit::SignalRequest* request)
+{
+    if (request) {
+        std::unique_ptr<livekit::SignalRequest> holder(request);
+        clearRequest(*holder);
+        const std::lock_guard guard(_mutex);
+        if (_freeRequests.size() < _maxFreeRequests) {
+            _freeRequests.push_back(std::move(holder));
+        }
+    }
+}
+
+void SignalBuffersPool::RequestDeleter::operator() (livekit::SignalRequest* request) const
+{
+    SignalBuffersPool::instance().releaseRequest(request);
+}
+
+SignalBuffersPool::Buffer::Buffer(std::vector<uint8_t> storage, size_t size)
+    : _storage(std::move(storage))
+    , _size(size)
+{
+}
+
+SignalBuffersPool::Buffer::Buffer(Buffer&& tmp) noexcept
+    : _storage(std::move(tmp._storage))
+    , _size(tmp._size)
+{
+    tmp._storage.clear();
+    tmp._size = 0U;
+}
+
+SignalBuffersPool::Buffer::~Buffer()
+{
+    SignalBuffersPool::instance().releaseStorage(std::move(_storage));
+}
+
+} // namespace LiveKitCpp
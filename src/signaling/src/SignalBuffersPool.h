@@ -0,0 +1,87 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once // SignalBuffersPool.h
+#include "Blob.h"
+#include "Logger.h"
+#include "livekit_rtc.pb.h"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace LiveKitCpp
+{
+
+// process-wide freelists of outgoing signal requests and size-classed serialization buffers,
+// steady flow of small signals (mute, track settings, pings) doesn't touch the heap
+class SignalBuffersPool
+{
+    class RequestDeleter;
+public:
+    class Buffer;
+    using Request = std::unique_ptr<livekit::SignalRequest, RequestDeleter>;
+public:
+    static SignalBuffersPool& instance();
+    // empty request, returned back to the pool on destruction,
+    // nested message of the last request type is kept allocated for reuse via mutable_* accessors
+    Request acquireRequest();
+    // serialized [proto] in pooled storage or empty buffer if serialization failed,
+    // storage is returned back to the pool once the buffer is destroyed
+    Buffer serialize(const google::protobuf::MessageLite& proto,
+                     Bricks::Logger* logger = nullptr,
+                     std::string_view category = {});
+private:
+    SignalBuffersPool() = default;
+    static size_t sizeClass(size_t size);
+    static void clearRequest(livekit::SignalRequest& request);
+    std::vector<uint8_t> acquireStorage(size_t size);
+    void releaseStorage(std::vector<uint8_t> storage);
+    void releaseRequest(livekit::SignalRequest* request);
+private:
+    // 128 bytes ... 64 Kb, bigger buffers are not pooled
+    static constexpr size_t _minClassBits = 7U;
+    static constexpr size_t _classesCount = 10U;
+    static constexpr size_t _maxFreeBuffers = 16U;
+    static constexpr size_t _maxFreeRequests = 16U;
+    std::mutex _mutex;
+    std::array<std::vector<std::vector<uint8_t>>, _classesCount> _freeBuffers;
+    std::vector<std::unique_ptr<livekit::SignalRequest>> _freeRequests;
+};
+
+class SignalBuffersPool::RequestDeleter
+{
+public:
+    void operator() (livekit::SignalRequest* request) const;
+};
+
+class SignalBuffersPool::Buffer : public Bricks::Blob
+{
+public:
+    Buffer() = default;
+    Buffer(std::vector<uint8_t> storage, size_t size);
+    Buffer(Buffer&& tmp) noexcept;
+    Buffer(const Buffer&) = delete;
+    ~Buffer() override;
+    Buffer& operator = (const Buffer&) = delete;
+    Buffer& operator = (Buffer&&) = delete;
+    // impl. of Bricks::Blob
+    size_t size() const final { return _size; }
+    const uint8_t* data() const final { return _storage.data(); }
+private:
+    std::vector<uint8_t> _storage;
+    size_t _size = 0U;
+};
+
+} // namespace LiveKitCpp
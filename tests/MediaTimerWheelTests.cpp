@@ -0,0 +1,218 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "MediaTimerWheel.h"
+#include <api/location.h>
+#include <rtc_base/time_utils.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+// manually advanced time for [webrtc::TimeMillis]
+class ManualClock : public webrtc::ClockInterface
+{
+public:
+    ManualClock(int64_t nowMs);
+    ~ManualClock() override;
+    int64_t nowMs() const noexcept { return _nowMs; }
+    void setNowMs(int64_t nowMs) noexcept { _nowMs = nowMs; }
+    // impl. of webrtc::ClockInterface
+    int64_t TimeNanos() const final { return _nowMs * webrtc::kNumNanosecsPerMillisec; }
+private:
+    webrtc::ClockInterface* const _previous;
+    int64_t _nowMs;
+};
+
+// delayed tasks are executed by [runDue] only, in order of their due time
+class ManualTaskQueue : public webrtc::TaskQueueBase
+{
+    struct DelayedTask
+    {
+        int64_t _dueMs;
+        uint64_t _order;
+        absl::AnyInvocable<void() &&> _task;
+    };
+public:
+    ManualTaskQueue(const ManualClock& clock);
+    static std::shared_ptr<webrtc::TaskQueueBase> create(const ManualClock& clock);
+    void runDue();
+    // impl. of webrtc::TaskQueueBase
+    void Delete() final { delete this; }
+protected:
+    void PostTaskImpl(absl::AnyInvocable<void() &&> task, const PostTaskTraits& traits,
+                      const webrtc::Location& location) final;
+    void PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task, webrtc::TimeDelta delay,
+                             const PostDelayedTaskTraits& traits,
+                             const webrtc::Location& location) final;
+private:
+    const ManualClock& _clock;
+    uint64_t _order = 0ULL;
+    std::vector<DelayedTask> _tasks;
+};
+
+class MediaTimerWheelTest : public ::testing::Test
+{
+protected:
+    // slots of the lowest level are 1 ms, level blocks are 64 ms, 4096 ms, etc.
+    static constexpr int64_t _startMs = 1000;
+    MediaTimerWheelTest();
+    std::shared_ptr<MediaTimerWheel::Entry> schedule(int64_t deadlineMs, int64_t intervalMs = 0);
+    void cancel(const std::shared_ptr<MediaTimerWheel::Entry>& entry) { _wheel->cancel(entry); }
+    // moves time by 1 ms until [toMs] inclusive
+    void runUntil(int64_t toMs);
+    const std::vector<int64_t>& fired() const noexcept { return _fired; }
+private:
+    ManualClock _clock;
+    const std::shared_ptr<webrtc::TaskQueueBase> _queue;
+    const std::shared_ptr<MediaTimerWheel> _wheel;
+    std::vector<int64_t> _fired;
+};
+
+}
+
+namespace LiveKitCpp
+{
+
+TEST_F(MediaTimerWheelTest, FiresOnTimeAtLowestLevel)
+{
+    schedule(_startMs + 1);
+    schedule(_startMs + 10);
+    schedule(_startMs + 63);
+    runUntil(_startMs + 100);
+    EXPECT_EQ(fired(), std::vector<int64_t>({_startMs + 1, _startMs + 10, _startMs + 63}));
+}
+
+TEST_F(MediaTimerWheelTest, FiresOnTimeAtBlockBoundary)
+{
+    // 1088 & 1152 are multiples of 64, entries are cascaded from the 2nd level right at these ticks
+    schedule(1088);
+    schedule(1152);
+    runUntil(1200);
+    EXPECT_EQ(fired(), std::vector<int64_t>({1088, 1152}));
+}
+
+TEST_F(MediaTimerWheelTest, FiresOnTimeAfterMultiLevelCascade)
+{
+    // 8192 is a boundary of 3rd level block, 8262 is cascaded through all levels
+    schedule(8192);
+    schedule(8193);
+    schedule(8262);
+    runUntil(8300);
+    EXPECT_EQ(fired(), std::vector<int64_t>({8192, 8193, 8262}));
+}
+
+TEST_F(MediaTimerWheelTest, PeriodicTimerKeepsPhase)
+{
+    const auto entry = schedule(1024 + 64, 64);
+    runUntil(1024 + 64 * 5);
+    EXPECT_EQ(fired(), std::vector<int64_t>({1088, 1152, 1216, 1280, 1344}));
+    ASSERT_TRUE(entry);
+    EXPECT_FALSE(entry->cancelled());
+}
+
+TEST_F(MediaTimerWheelTest, CancelledTimerDoesNotFire)
+{
+    const auto cancelled = schedule(1088);
+    const auto periodic = schedule(1030, 30);
+    schedule(1089);
+    runUntil(1050);
+    cancel(cancelled);
+    cancel(periodic);
+    runUntil(1100);
+    EXPECT_EQ(fired(), std::vector<int64_t>({1030, 1089}));
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+ManualClock::ManualClock(int64_t nowMs)
+    : _previous(webrtc::SetClockForTesting(this))
+    , _nowMs(nowMs)
+{
+}
+
+ManualClock::~ManualClock()
+{
+    webrtc::SetClockForTesting(_previous);
+}
+
+ManualTaskQueue::ManualTaskQueue(const ManualClock& clock)
+    : _clock(clock)
+{
+}
+
+std::shared_ptr<webrtc::TaskQueueBase> ManualTaskQueue::create(const ManualClock& clock)
+{
+    return std::shared_ptr<webrtc::TaskQueueBase>(new ManualTaskQueue(clock), [](webrtc::TaskQueueBase* queue) {
+        queue->Delete();
+    });
+}
+
+void ManualTaskQueue::runDue()
+{
+    // tasks may post new tasks
+    for (;;) {
+        const auto it = std::min_element(_tasks.begin(), _tasks.end(), [](const auto& l, const auto& r) {
+            return l._dueMs < r._dueMs || (l._dueMs == r._dueMs && l._order < r._order);
+        });
+        if (it == _tasks.end() || it->_dueMs > _clock.nowMs()) {
+            break;
+        }
+        auto task = std::move(it->_task);
+        _tasks.erase(it);
+        std::move(task)();
+    }
+}
+
+void ManualTaskQueue::PostTaskImpl(absl::AnyInvocable<void() &&> task, const PostTaskTraits&,
+                                   const webrtc::Location&)
+{
+    _tasks.push_back({_clock.nowMs(), _order++, std::move(task)});
+}
+
+void ManualTaskQueue::PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task, webrtc::TimeDelta delay,
+                                          const PostDelayedTaskTraits&,
+                                          const webrtc::Location&)
+{
+    _tasks.push_back({_clock.nowMs() + delay.ms(), _order++, std::move(task)});
+}
+
+MediaTimerWheelTest::MediaTimerWheelTest()
+    : _clock(_startMs)
+    , _queue(ManualTaskQueue::create(_clock))
+    , _wheel(MediaTimerWheel::get(_queue))
+{
+}
+
+std::shared_ptr<MediaTimerWheel::Entry> MediaTimerWheelTest::schedule(int64_t deadlineMs, int64_t intervalMs)
+{
+    return _wheel->schedule([this]() { _fired.push_back(_clock.nowMs()); },
+                            uint64_t(deadlineMs - _clock.nowMs()), uint64_t(intervalMs));
+}
+
+void MediaTimerWheelTest::runUntil(int64_t toMs)
+{
+    while (_clock.nowMs() < toMs) {
+        _clock.setNowMs(_clock.nowMs() + 1);
+        static_cast<ManualTaskQueue*>(_queue.get())->runDue();
+    }
+}
+
+}
@@ -0,0 +1,154 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/metrics/MetricsEndpoint.h"
+#include "livekit/rtc/metrics/MetricsRegistry.h"
+#include <gtest/gtest.h>
+#include <string>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+#ifdef _WIN32
+using Socket = SOCKET;
+const Socket g_invalidSocket = INVALID_SOCKET;
+#else
+using Socket = int;
+const Socket g_invalidSocket = -1;
+#endif
+
+class MetricsEndpointTest : public ::testing::Test
+{
+protected:
+    MetricsEndpointTest();
+    ~MetricsEndpointTest() override;
+    // sends [request] to the endpoint on localhost, returns the whole response
+    std::string request(const std::string& request) const;
+    std::string get(const std::string& path) const;
+    MetricsEndpoint _endpoint;
+private:
+    const bool _registryWasEnabled;
+};
+
+void closeSocket(Socket socket);
+
+}
+
+namespace LiveKitCpp
+{
+
+TEST_F(MetricsEndpointTest, ServesExposition)
+{
+    ASSERT_TRUE(_endpoint.start());
+    ASSERT_NE(0U, _endpoint.port());
+    const auto response = get("/metrics");
+    EXPECT_EQ(0U, response.find("HTTP/1.1 200 OK\r\n"));
+    EXPECT_NE(std::string::npos, response.find("Content-Type: application/openmetrics-text"));
+    EXPECT_NE(std::string::npos, response.find("# TYPE livekit_data_send_errors counter\n"));
+    EXPECT_NE(std::string::npos, response.find("# TYPE livekit_video_encode_seconds histogram\n"));
+    EXPECT_EQ(response.size() - 6U, response.rfind("# EOF\n"));
+}
+
+TEST_F(MetricsEndpointTest, RejectsUnknownPathAndMethod)
+{
+    ASSERT_TRUE(_endpoint.start());
+    EXPECT_EQ(0U, get("/other").find("HTTP/1.1 404 Not Found\r\n"));
+    EXPECT_EQ(0U, request("POST /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n").find("HTTP/1.1 405 "));
+    EXPECT_EQ(0U, request("garbage\r\n\r\n").find("HTTP/1.1 400 "));
+    // the endpoint still serves after bad requests
+    EXPECT_EQ(0U, get("/metrics?name=x").find("HTTP/1.1 200 OK\r\n"));
+}
+
+TEST_F(MetricsEndpointTest, StopRestoresRegistryState)
+{
+    MetricsRegistry::setEnabled(false);
+    ASSERT_TRUE(_endpoint.start());
+    EXPECT_TRUE(MetricsRegistry::enabled());
+    _endpoint.stop();
+    EXPECT_FALSE(_endpoint.started());
+    EXPECT_FALSE(MetricsRegistry::enabled());
+    MetricsRegistry::setEnabled(true);
+    ASSERT_TRUE(_endpoint.start());
+    _endpoint.stop();
+    EXPECT_TRUE(MetricsRegistry::enabled());
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+MetricsEndpointTest::MetricsEndpointTest()
+    : _registryWasEnabled(MetricsRegistry::enabled())
+{
+}
+
+MetricsEndpointTest::~MetricsEndpointTest()
+{
+    _endpoint.stop();
+    MetricsRegistry::setEnabled(_registryWasEnabled);
+}
+
+std::string MetricsEndpointTest::request(const std::string& request) const
+{
+    // sockets API is initialized by the endpoint on Windows
+    std::string response;
+    const auto socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (g_invalidSocket != socket) {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(_endpoint.port());
+        ::inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        if (0 == ::connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) &&
+            static_cast<int>(request.size()) == ::send(socket, request.data(), static_cast<int>(request.size()), 0)) {
+            // the endpoint closes connection after the response
+            char buffer[4096];
+            for (;;) {
+                const auto result = ::recv(socket, buffer, sizeof(buffer), 0);
+                if (result <= 0) {
+                    break;
+                }
+                response.append(buffer, static_cast<size_t>(result));
+            }
+        }
+        closeSocket(socket);
+    }
+    return response;
+}
+
+std::string MetricsEndpointTest::get(const std::string& path) const
+{
+    return request("GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n");
+}
+
+void closeSocket(Socket socket)
+{
+#ifdef _WIN32
+    ::closesocket(socket);
+#else
+    ::close(socket);
+#endif
+}
+
+}
@@ -0,0 +1,145 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/stats/StatsDecoder.h"
+#include "livekit/rtc/stats/StatsEncoder.h"
+#include "livekit/rtc/stats/StatsListener.h"
+#include "StatsBinary.h"
+#include "StatsSourceImpl.h"
+#include <api/make_ref_counted.h>
+#include <api/stats/rtc_stats_report.h>
+#include <api/stats/rtcstats_objects.h>
+#include <gtest/gtest.h>
+#include <map>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+
+// keeps the last delivered report
+class ReportCapture : public StatsListener
+{
+public:
+    const StatsReport& report() const noexcept { return _report; }
+    // impl. of StatsListener
+    void onStats(const StatsReport& report) final { _report = report; }
+private:
+    StatsReport _report;
+};
+
+class StatsBinaryTest : public ::testing::Test
+{
+protected:
+    // report with attributes of scalar, string, vector & map types,
+    // values depend on [query]
+    static StatsReport makeReport(uint64_t query);
+    // encoded & decoded report must be the same as original
+    void expectRoundTrip(const StatsReport& report);
+    StatsEncoder _encoder;
+    StatsDecoder _decoder;
+};
+
+}
+
+namespace LiveKitCpp
+{
+
+TEST_F(StatsBinaryTest, ReportRoundTrip)
+{
+    expectRoundTrip(makeReport(1ULL));
+}
+
+TEST_F(StatsBinaryTest, ReportRoundTripWithDictionaryContinuation)
+{
+    // the 2nd report refers to strings interned by the 1st one
+    expectRoundTrip(makeReport(1ULL));
+    expectRoundTrip(makeReport(2ULL));
+}
+
+TEST_F(StatsBinaryTest, MissedReportIsNotDecoded)
+{
+    const auto first = _encoder.encode(makeReport(1ULL));
+    _encoder.encode(makeReport(2ULL));
+    const auto third = _encoder.encode(makeReport(3ULL));
+    ASSERT_TRUE(_decoder.decode(first).has_value());
+    EXPECT_FALSE(_decoder.decode(third).has_value());
+}
+
+TEST_F(StatsBinaryTest, OtherFormatVersionIsRejected)
+{
+    auto data = _encoder.encode(makeReport(1ULL));
+    // header is magic (2 bytes), version & flags
+    ASSERT_GT(data.size(), 4U);
+    data[2] = StatsBinary::_version + 1U;
+    EXPECT_FALSE(_decoder.decode(data).has_value());
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+StatsReport StatsBinaryTest::makeReport(uint64_t query)
+{
+    const auto timestamp = webrtc::Timestamp::Millis(static_cast<int64_t>(1000ULL * query));
+    auto report = webrtc::RTCStatsReport::Create(timestamp);
+    auto codec = std::make_unique<webrtc::RTCCodecStats>("CIT01_111", timestamp);
+    codec->payload_type = 111U;
+    codec->mime_type = "audio/opus";
+    codec->clock_rate = 48000U;
+    codec->channels = 2U;
+    codec->sdp_fmtp_line = "minptime=10;useinbandfec=1";
+    report->AddStats(std::move(codec));
+    auto outbound = std::make_unique<webrtc::RTCOutboundRtpStreamStats>("OT01V1", timestamp);
+    outbound->ssrc = 1234567U;
+    outbound->kind = "video";
+    outbound->codec_id = "CIT01_96";
+    outbound->bytes_sent = 1000ULL * query;
+    outbound->packets_sent = static_cast<uint64_t>(10ULL * query);
+    outbound->frames_encoded = static_cast<uint32_t>(30U * query);
+    outbound->total_encode_time = 0.25 * static_cast<double>(query);
+    outbound->quality_limitation_reason = "bandwidth";
+    outbound->quality_limitation_durations = std::map<std::string, double>{
+        {"bandwidth", 0.5 * static_cast<double>(query)}, {"cpu", 0.}, {"none", 1.}, {"other", 0.}};
+    outbound->active = true;
+    report->AddStats(std::move(outbound));
+    auto pair = std::make_unique<webrtc::RTCIceCandidatePairStats>("CP01", timestamp);
+    pair->transport_id = "T01";
+    pair->local_candidate_id = "I01";
+    pair->remote_candidate_id = "I02";
+    pair->nominated = true;
+    pair->bytes_sent = 5000ULL * query;
+    pair->bytes_received = 7000ULL * query;
+    pair->current_round_trip_time = 0.012;
+    pair->available_outgoing_bitrate = 2500000.;
+    report->AddStats(std::move(pair));
+    const auto capture = std::make_shared<ReportCapture>();
+    webrtc::make_ref_counted<StatsSourceImpl>(capture)->OnStatsDelivered(report);
+    return capture->report();
+}
+
+void StatsBinaryTest::expectRoundTrip(const StatsReport& report)
+{
+    ASSERT_TRUE(report);
+    const auto data = _encoder.encode(report);
+    ASSERT_FALSE(data.empty());
+    const auto decoded = _decoder.decode(data);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(report.size(), decoded->size());
+    EXPECT_EQ(report.timestamp(), decoded->timestamp());
+    // JSON of webrtc stats lists all attributes with values
+    EXPECT_EQ(report.json(), decoded->json());
+}
+
+}
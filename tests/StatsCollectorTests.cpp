@@ -0,0 +1,187 @@
+// Copyright 2025 Artiom Khachaturian
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "livekit/rtc/stats/StatsCollector.h"
+#include "livekit/rtc/stats/StatsSource.h"
+#include "StatsSourceImpl.h"
+#include <api/make_ref_counted.h>
+#include <api/stats/rtc_stats_report.h>
+#include <api/stats/rtcstats_objects.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <thread>
+
+namespace
+{
+
+using namespace LiveKitCpp;
+using namespace std::chrono_literals;
+
+// emulates session: each query is answered by 2 reports,
+// publisher (outbound stream) & subscriber (inbound stream);
+// source without per-query delivery answers only to added listeners
+class SessionStatsSource : public StatsSource
+{
+public:
+    static constexpr std::string_view _outboundId = "OT01V1";
+    static constexpr std::string_view _inboundId = "IT01A1";
+    // subscriber report is empty after this number of queries
+    void setInboundQueries(uint64_t queries) { _inboundQueries = queries; }
+    void setPerQueryDelivery(bool perQuery) { _perQuery = perQuery; }
+    uint64_t queries() const { return _queries; }
+    // impl. of StatsSource
+    void addStatsListener(StatsListener* listener) final { _fanOut->addListener(listener); }
+    void removeStatsListener(StatsListener* listener) final { _fanOut->removeListener(listener); }
+    void queryStats() const final;
+    bool queryStats(const std::shared_ptr<StatsListener>& listener) const final;
+private:
+    void deliver(const webrtc::scoped_refptr<StatsSourceImpl>& callback) const;
+private:
+    const webrtc::scoped_refptr<StatsSourceImpl> _fanOut = webrtc::make_ref_counted<StatsSourceImpl>();
+    std::atomic_bool _perQuery = true;
+    mutable std::atomic<uint64_t> _queries = 0ULL;
+    std::atomic<uint64_t> _inboundQueries = std::numeric_limits<uint64_t>::max();
+};
+
+class StatsCollectorTest : public ::testing::Test
+{
+protected:
+    StatsCollectorTest();
+    ~StatsCollectorTest() override { _collector.stop(); }
+    // polls until [condition] is true or timeout
+    static bool waitFor(const std::function<bool()>& condition);
+    SessionStatsSource _source;
+    StatsCollector _collector;
+};
+
+}
+
+namespace LiveKitCpp
+{
+
+TEST_F(StatsCollectorTest, DeltasOfBothReportsOfPoll)
+{
+    _collector.start();
+    ASSERT_TRUE(waitFor([this]() { return 2U == _collector.lastDeltas().size(); }));
+    const auto outbound = _collector.lastDelta(std::string(SessionStatsSource::_outboundId));
+    const auto inbound = _collector.lastDelta(std::string(SessionStatsSource::_inboundId));
+    ASSERT_TRUE(outbound.has_value());
+    ASSERT_TRUE(inbound.has_value());
+    EXPECT_EQ(StatsType::OutboundRtp, outbound->_type);
+    EXPECT_EQ(StatsType::InboundRtp, inbound->_type);
+    // counters grow by the same amount on each query
+    EXPECT_EQ(1000ULL, outbound->_bytes);
+    EXPECT_EQ(2000ULL, inbound->_bytes);
+    EXPECT_GT(outbound->_bitrate, 0.);
+    EXPECT_GT(inbound->_bitrate, 0.);
+}
+
+TEST_F(StatsCollectorTest, StatsOfOneReportAreKeptByAnotherOne)
+{
+    _collector.start();
+    ASSERT_TRUE(waitFor([this]() { return _source.queries() > 5U; }));
+    _collector.stop();
+    EXPECT_GT(_collector.history(std::string(SessionStatsSource::_outboundId)).size(), 2U);
+    EXPECT_GT(_collector.history(std::string(SessionStatsSource::_inboundId)).size(), 2U);
+}
+
+TEST_F(StatsCollectorTest, GoneStreamIsExpired)
+{
+    _source.setInboundQueries(3U);
+    _collector.start();
+    ASSERT_TRUE(waitFor([this]() {
+        return _source.queries() > 3U &&
+               _collector.history(std::string(SessionStatsSource::_inboundId)).empty();
+    }));
+    EXPECT_FALSE(_collector.history(std::string(SessionStatsSource::_outboundId)).empty());
+}
+
+TEST_F(StatsCollectorTest, SourceWithoutPerQueryDelivery)
+{
+    _source.setPerQueryDelivery(false);
+    _collector.start();
+    ASSERT_TRUE(waitFor([this]() { return 2U == _collector.lastDeltas().size(); }));
+    const auto outbound = _collector.lastDelta(std::string(SessionStatsSource::_outboundId));
+    ASSERT_TRUE(outbound.has_value());
+    EXPECT_EQ(1000ULL, outbound->_bytes);
+}
+
+} // namespace LiveKitCpp
+
+namespace
+{
+
+void SessionStatsSource::queryStats() const
+{
+    if (!_perQuery) {
+        deliver(_fanOut);
+    }
+}
+
+bool SessionStatsSource::queryStats(const std::shared_ptr<StatsListener>& listener) const
+{
+    if (_perQuery) {
+        deliver(webrtc::make_ref_counted<StatsSourceImpl>(listener));
+        return true;
+    }
+    return false;
+}
+
+void SessionStatsSource::deliver(const webrtc::scoped_refptr<StatsSourceImpl>& callback) const
+{
+    const auto query = ++_queries;
+    const auto timestamp = webrtc::Timestamp::Millis(static_cast<int64_t>(1000ULL * query));
+    auto publisher = webrtc::RTCStatsReport::Create(timestamp);
+    auto outbound = std::make_unique<webrtc::RTCOutboundRtpStreamStats>(std::string(_outboundId), timestamp);
+    outbound->bytes_sent = static_cast<uint64_t>(1000ULL * query);
+    outbound->packets_sent = static_cast<uint64_t>(10ULL * query);
+    outbound->frames_encoded = static_cast<uint32_t>(30U * query);
+    publisher->AddStats(std::move(outbound));
+    callback->OnStatsDelivered(publisher);
+    auto subscriber = webrtc::RTCStatsReport::Create(timestamp);
+    if (query <= _inboundQueries) {
+        auto inbound = std::make_unique<webrtc::RTCInboundRtpStreamStats>(std::string(_inboundId), timestamp);
+        inbound->bytes_received = static_cast<uint64_t>(2000ULL * query);
+        inbound->packets_received = static_cast<uint64_t>(20ULL * query);
+        inbound->packets_lost = 0;
+        inbound->frames_decoded = static_cast<uint32_t>(30U * query);
+        subscriber->AddStats(std::move(inbound));
+    }
+    else {
+        // empty reports are not delivered, keep subscriber alive with a candidate pair
+        subscriber->AddStats(std::make_unique<webrtc::RTCIceCandidatePairStats>("CP01", timestamp));
+    }
+    callback->OnStatsDelivered(subscriber);
+}
+
+StatsCollectorTest::StatsCollectorTest()
+    : _collector(&_source, StatsCollectorOptions{5ULL, 10U})
+{
+}
+
+bool StatsCollectorTest::waitFor(const std::function<bool()>& condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+}